@@ -279,6 +279,7 @@ extern int motion_estimation_method;
 #define CODEC_FLAG_INTERLACED_ME  0x20000000 ///< interlaced motion estimation
 #define CODEC_FLAG_SVCD_SCAN_OFFSET 0x40000000 ///< will reserve space for SVCD scan offset user data
 #define CODEC_FLAG_CLOSED_GOP     0x80000000
+#define CODEC_FLAG2_FIXED_POINT   0x00000001 ///< decode with the fixed point transforms when the decoder has them (WMA)
 /* Unsupported options :
  * 		Syntax Arithmetic coding (SAC)
  * 		Reference Picture Selection
@@ -1135,8 +1136,9 @@ typedef struct AVCodecContext {
 #define FF_MM_3DNOW	0x0004 /* AMD 3DNOW */
 #define FF_MM_MMXEXT	0x0002 /* SSE integer functions or AMD MMX ext */
 #define FF_MM_SSE	0x0008 /* SSE functions */
-#define FF_MM_SSE2	0x0010 /* PIV SSE2 functions */
 #endif /* HAVE_MMX */
+#define FF_MM_SSE2	0x0010 /* PIV SSE2 functions */
+#define FF_MM_AVX2	0x0100 /* AVX2 functions */
 
     /**
      * bits per sample/pixel from the demuxer (needed for huffyuv).
@@ -1623,6 +1625,24 @@ typedef struct AVCodecContext {
      * - decoding: set by user
      */
      int skip_bottom;
+
+    /**
+     * low resolution decoding. For audio, 1 -> 1/2 sample rate,
+     * 2 -> 1/4 sample rate. The decoder sets sample_rate to the output
+     * rate when it is opened.
+     * - encoding: unused
+     * - decoding: set by user
+     */
+     int lowres;
+
+    /**
+     * Decoder should decode to this many channels if it can (0 for
+     * default). The decoder sets channels to the output channel count
+     * when it is opened.
+     * - encoding: unused
+     * - decoding: set by user
+     */
+     int request_channels;
 } AVCodecContext;
 
 
@@ -1725,6 +1745,103 @@ typedef struct AVPaletteControl {
 extern AVCodec wmav1_decoder;
 extern AVCodec wmav2_decoder;
 
+/* wmadec.c */
+
+/**
+ * Decoding statistics of an open WMA decoder.
+ */
+typedef struct WMAStats {
+    unsigned int lsp_cache_hits;   ///< LSP exponent curves reused from the cache
+    unsigned int lsp_cache_misses; ///< LSP exponent curves computed
+    /**
+     * memory owned by the decoder, in bytes. The tables shared with the
+     * other decoders opened with the same parameters are not counted.
+     */
+    unsigned int decoder_bytes;
+    int64_t init_time;         ///< microseconds spent opening the decoder
+    /**
+     * microseconds from the opening of the decoder to its first decoded
+     * samples, -1 if nothing was decoded yet
+     */
+    int64_t first_sample_time;
+    /**
+     * frames returned by the last decoding call, of frame_size samples
+     * per channel, and which of them are silent: bit i of silent_map is
+     * set if nothing was coded for frame i, whose samples are then all 0
+     */
+    int nb_frames;
+    int frame_size;
+    unsigned int silent_map;
+    uint64_t silent_frames;    ///< number of silent frames decoded so far
+} WMAStats;
+
+/**
+ * Return the statistics of the WMA decoder opened on avctx.
+ */
+void wma_get_stats(AVCodecContext *avctx, WMAStats *stats);
+
+/**
+ * MDCT spectrum of one channel of a decoded block, as given to the
+ * spectrum tap of a WMA decoder.
+ */
+typedef struct WMASpectrum {
+    int channel;
+    int64_t frame_number;  ///< frames decoded before the one of the block
+    int frame_len;         ///< samples per channel in a frame, before lowres
+    int block_pos;         ///< position of the block in its frame, in samples
+    /**
+     * number of coefficients of the block, which cover the frequencies
+     * from 0 to sample_rate / 2. The block spans 2 * block_len samples
+     * centered on its block_len samples starting at block_pos.
+     */
+    int block_len;
+    /**
+     * the block is coded as mid and side channels. The coefficients are
+     * still the left and right ones, but the exponents are the ones of
+     * the mid (channel 0) and side (channel 1) channels.
+     */
+    int ms_stereo;
+    /**
+     * block_len dequantized MDCT coefficients, with the noise filled
+     * in, that is the input of the IMDCT. NULL if nothing is coded for
+     * the channel in this block, in which case its coefficients are 0.
+     * With ms_stereo, it is only NULL if neither channel is coded.
+     */
+    const float *coefs;
+    /**
+     * spectral envelope the coefficients were coded with, one value per
+     * coefficient, in linear scale. NULL if nothing is coded for the
+     * channel.
+     */
+    const float *exponents;
+    /**
+     * when the exponents are VLC coded, they are constant over bands:
+     * band i ends before coefficient band_end[i] and has the exponent
+     * band_exponent[i]. nb_bands is 0 for LSP coded exponents.
+     */
+    int nb_bands;
+    const int *band_end;
+    const float *band_exponent;
+} WMASpectrum;
+
+/**
+ * Called for each channel of each block decoded. The spectrum is only
+ * valid during the call.
+ */
+typedef void (*WMASpectrumTap)(void *opaque, const WMASpectrum *spectrum);
+
+#define WMA_TAP_NO_OUTPUT 0x0001 ///< skip the IMDCT, the decoding calls return no samples
+
+/**
+ * Set the spectrum tap of the WMA decoder opened on avctx, or remove it
+ * if tap is NULL. It should be set before the first decoding call, and
+ * not changed when WMA_TAP_NO_OUTPUT is set.
+ * @param flags WMA_TAP_*
+ * @return 0 if OK, -1 if out of memory
+ */
+int wma_set_spectrum_tap(AVCodecContext *avctx, WMASpectrumTap tap,
+                         void *opaque, int flags);
+
 
 /* resample.c */
 
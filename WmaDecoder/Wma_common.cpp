@@ -74,7 +74,7 @@ void put_string(PutBitContext * pbc, char *s, int put_zero)
  * reads 0-32 bits.
  */
 unsigned int get_bits_long(GetBitContext *s, int n){
-    if(n<=17) return get_bits(s, n);
+    if(n<=MIN_CACHE_BITS) return get_bits(s, n);
     else{
         int ret= get_bits(s, 16) << (n-16);
         return ret | get_bits(s, n-16);
@@ -85,7 +85,7 @@ unsigned int get_bits_long(GetBitContext *s, int n){
  * shows 0-32 bits.
  */
 unsigned int show_bits_long(GetBitContext *s, int n){
-    if(n<=17) return show_bits(s, n);
+    if(n<=MIN_CACHE_BITS) return show_bits(s, n);
     else{
         GetBitContext gb= *s;
         int ret= get_bits_long(s, n);
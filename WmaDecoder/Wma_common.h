@@ -12,6 +12,14 @@
 #define ALT_BITSTREAM_READER
 #define LIBMPEG2_BITSTREAM_READER_HACK //add BERO
 
+/* keep 64 bits of the ALT reader in a register and refill only when less
+   than 32 are left: only worth it where 64 bit registers are native.
+   Define DISABLE_CACHED_BITSTREAM_READER to use the plain ALT reader */
+#if !defined(DISABLE_CACHED_BITSTREAM_READER) && \
+    (defined(__x86_64__) || defined(__LP64__))
+#define CACHED_BITSTREAM_READER
+#endif
+
 /* only include the following when compiling package */
 #include <stdlib.h>
 #include <stdint.h>
@@ -149,7 +157,7 @@ typedef struct VLC {
 typedef struct RL_VLC_ELEM {
     int16_t level;
     int8_t len;
-    uint8_t run;
+    uint16_t run; ///< WMA coefficient tables have runs up to 351
 } RL_VLC_ELEM;
 
 #ifdef ARCH_SPARC
@@ -375,7 +383,69 @@ static inline int unaligned32_be(const void *v)
 #endif
 }
 
-#ifdef ALT_BITSTREAM_READER
+#ifdef CACHED_BITSTREAM_READER
+static inline uint64_t unaligned64_be(const void *v)
+{
+    uint64_t x;
+    memcpy(&x, v, sizeof(x));
+#ifdef WORDS_BIGENDIAN
+    return x;
+#else
+    return __builtin_bswap64(x);
+#endif
+}
+#endif
+
+#if defined(ALT_BITSTREAM_READER) && defined(CACHED_BITSTREAM_READER)
+/* same bit position as the ALT reader, but the cache holds up to 64 bits
+   and UPDATE_CACHE only reloads it when less than MIN_CACHE_BITS are left */
+#   define MIN_CACHE_BITS 32
+
+#   define OPEN_READER(name, gb)\
+        int name##_index= (gb)->index;\
+        uint64_t name##_cache= 0;\
+        int name##_bits= 0;\
+
+#   define CLOSE_READER(name, gb)\
+        (gb)->index= name##_index;\
+
+#   define UPDATE_CACHE(name, gb)\
+        if(name##_bits < MIN_CACHE_BITS){\
+            name##_cache= unaligned64_be( ((uint8_t *)(gb)->buffer)+(name##_index>>3) ) << (name##_index&0x07);\
+            name##_bits= 64 - (name##_index&0x07);\
+        }\
+
+#   define SKIP_CACHE(name, gb, num)\
+        {\
+            name##_cache <<= (num);\
+            name##_bits -= (num);\
+        }\
+
+#   define SKIP_COUNTER(name, gb, num)\
+        name##_index += (num);\
+
+#   define SKIP_BITS(name, gb, num)\
+        {\
+            SKIP_CACHE(name, gb, num)\
+            SKIP_COUNTER(name, gb, num)\
+        }\
+
+#   define LAST_SKIP_BITS(name, gb, num) SKIP_BITS(name, gb, num)
+#   define LAST_SKIP_CACHE(name, gb, num) SKIP_CACHE(name, gb, num)
+
+#   define SHOW_UBITS(name, gb, num)\
+        ((uint32_t)(name##_cache >> (64 - (num))))
+
+#   define SHOW_SBITS(name, gb, num)\
+        ((int32_t)((int64_t)name##_cache >> (64 - (num))))
+
+#   define GET_CACHE(name, gb)\
+        ((uint32_t)(name##_cache >> 32))
+
+static inline int get_bits_count(GetBitContext *s){
+    return s->index;
+}
+#elif defined ALT_BITSTREAM_READER
 #   define MIN_CACHE_BITS 25
 
 #   define OPEN_READER(name, gb)\
@@ -750,6 +820,16 @@ void free_vlc(VLC *vlc);
         index= SHOW_UBITS(name, gb, nb_bits) + level;\
         level = table[index].level;\
         n     = table[index].len;\
+        if(max_depth > 2 && n < 0){\
+            LAST_SKIP_BITS(name, gb, nb_bits)\
+            UPDATE_CACHE(name, gb)\
+\
+            nb_bits = -n;\
+\
+            index= SHOW_UBITS(name, gb, nb_bits) + level;\
+            level = table[index].level;\
+            n     = table[index].len;\
+        }\
     }\
     run= table[index].run;\
     SKIP_BITS(name, gb, n)\
@@ -778,7 +858,7 @@ static inline int get_vlc(GetBitContext *s, VLC *vlc)
  *                  read the longest vlc code 
  *                  = (max_vlc_length + bits - 1) / bits
  */
-static always_inline int get_vlc2(GetBitContext *s, VLC_TYPE (*table)[2],
+static always_inline int get_vlc2(GetBitContext *s, const VLC_TYPE (*table)[2],
                                   int bits, int max_depth)
 {
     int code;
@@ -813,7 +893,7 @@ static inline int get_bits_trace(GetBitContext *s, int n, char *file, char *func
     printf("%5d %2d %3d bit @%5d in %s %s:%d\n", r, n, r, get_bits_count(s)-n, file, func, line);
     return r;
 }
-static inline int get_vlc_trace(GetBitContext *s, VLC_TYPE (*table)[2], int bits, int max_depth, char *file, char *func, int line){
+static inline int get_vlc_trace(GetBitContext *s, const VLC_TYPE (*table)[2], int bits, int max_depth, char *file, char *func, int line){
     int show= show_bits(s, 24);
     int pos= get_bits_count(s);
     int r= get_vlc2(s, table, bits, max_depth);
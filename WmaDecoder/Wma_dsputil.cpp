@@ -24,6 +24,10 @@
  * @file dsputil.c
  * DSP utils
  */
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#include <cpuid.h>
+#define HAVE_CPUID
+#endif
  #include "Wma_Decoder.h"
 #include "Wma_avcodec.h"
 #include "Wma_dsputil.h"
@@ -204,9 +208,58 @@ void ff_set_cmp(DSPContext* c, me_cmp_func *cmp, int type){
 }
 
 /* init static data */
+/* x86 features there are kernels for. AVX2 also needs the OS to save
+   the ymm registers: OSXSAVE set and bits 1 and 2 of XCR0 */
+static int cpu_detect(void)
+{
+    int flags = 0;
+#ifdef HAVE_CPUID
+    unsigned int eax, ebx, ecx, edx, xcr0, xcr0_hi;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return 0;
+    if (edx & bit_SSE2)
+        flags |= MM_SSE2;
+    if ((ecx & (bit_OSXSAVE | bit_AVX)) == (bit_OSXSAVE | bit_AVX) &&
+        __get_cpuid_max(0, NULL) >= 7) {
+        __asm__ volatile("xgetbv" : "=a" (xcr0), "=d" (xcr0_hi) : "c" (0));
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        if ((xcr0 & 6) == 6 && (ebx & bit_AVX2))
+            flags |= MM_AVX2;
+    }
+#endif
+    return flags;
+}
+
+static int cpu_flags = -1;
+
+int mm_support(void)
+{
+    const char *env;
+    int flags;
+
+    /* a racing first call stores the same value */
+    if (cpu_flags >= 0)
+        return cpu_flags;
+    flags = cpu_detect();
+    env = getenv("WMA_CPU");
+    if (env) {
+        if (!strcmp(env, "c"))
+            flags = 0;
+        else if (!strcmp(env, "sse2"))
+            flags &= MM_SSE2;
+        else if (!strcmp(env, "avx2"))
+            flags &= MM_SSE2 | MM_AVX2;
+    }
+    cpu_flags = flags;
+    return flags;
+}
+
 void dsputil_static_init(void)
 {
     int i;
+
+    mm_support();
     for(i=0;i<256;i++) cropTbl[i + MAX_NEG_CROP] = i;
     for(i=0;i<MAX_NEG_CROP;i++) {
         cropTbl[i] = 0;
@@ -220,9 +273,104 @@ void dsputil_static_init(void)
     for(i=0; i<64; i++) inv_zigzag_direct16[ff_zigzag_direct[i]]= i+1;
 }
 
-void fft_calc(FFTContext *s, FFTComplex *z)
+void fft_calc(FFTContext *s, FFTComplex *out, const FFTComplex *in)
+{
+    s->fft_calc(s, out, in);
+}
+
+static void vector_fmul_add_c(float *dst, const float *src,
+                              const float *win, int len)
+{
+    int i;
+    for(i = 0; i < len; i++)
+        dst[i] += src[i] * win[i];
+}
+
+static void vector_fmul_reverse_add_c(float *dst, const float *src,
+                                      const float *win, int len)
+{
+    int i;
+    win += len - 1;
+    for(i = 0; i < len; i++)
+        dst[i] += src[i] * win[-i];
+}
+
+static void vector_add_c(float *dst, const float *src, int len)
 {
-    s->fft_calc(s, z);
+    int i;
+    for(i = 0; i < len; i++)
+        dst[i] += src[i];
+}
+
+static void float_to_int16_interleave_c(int16_t *dst, const float **src,
+                                        int len, int channels)
+{
+    int i, ch, a;
+    int16_t *ptr;
+    const float *iptr;
+
+    for(ch = 0; ch < channels; ch++) {
+        ptr = dst + ch;
+        iptr = src[ch];
+        for(i = 0; i < len; i++) {
+            a = lrintf(*iptr++);
+            if (a > 32767)
+                a = 32767;
+            else if (a < -32768)
+                a = -32768;
+            *ptr = a;
+            ptr += channels;
+        }
+    }
+}
+
+static void noise_fmul_c(float *dst, const float *noise, const float *exps,
+                         float exp, float mult, int len)
+{
+    int i;
+    if (exps) {
+        for(i = 0; i < len; i++)
+            dst[i] = noise[i] * exps[i] * mult;
+    } else {
+        for(i = 0; i < len; i++)
+            dst[i] = noise[i] * exp * mult;
+    }
+}
+
+static void coef_noise_fmul_c(float *dst, const int16_t *coefs,
+                              const float *noise, const float *exps,
+                              float exp, float mult, int len)
+{
+    int i;
+    if (exps) {
+        for(i = 0; i < len; i++)
+            dst[i] = (coefs[i] + noise[i]) * exps[i] * mult;
+    } else {
+        for(i = 0; i < len; i++)
+            dst[i] = (coefs[i] + noise[i]) * exp * mult;
+    }
+}
+
+/**
+ * Pick the kernels for the CPU features in mm_flags, usually
+ * mm_support() restricted by AVCodecContext.dsp_mask.
+ */
+void ff_float_dsp_init(FloatDSPContext *c, int mm_flags)
+{
+    c->vector_fmul_add = vector_fmul_add_c;
+    c->vector_fmul_reverse_add = vector_fmul_reverse_add_c;
+    c->vector_add = vector_add_c;
+    c->float_to_int16_interleave = float_to_int16_interleave_c;
+    c->noise_fmul = noise_fmul_c;
+    c->coef_noise_fmul = coef_noise_fmul_c;
+#ifdef HAVE_SSE2
+    if (mm_flags & MM_SSE2)
+        ff_float_dsp_init_sse(c);
+#endif
+#ifdef HAVE_AVX2
+    if (mm_flags & MM_AVX2)
+        ff_float_dsp_init_avx2(c);
+#endif
 }
 
 
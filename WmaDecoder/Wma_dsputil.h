@@ -32,6 +32,18 @@
 
 #include "Wma_common.h"
 #include "Wma_avcodec.h"
+/* SSE2 is part of the x86_64 baseline and present on every Intel Mac,
+   so the vectorized kernels are built whenever the compiler targets it */
+#if defined(__SSE2__) && !defined(HAVE_SSE2)
+#define HAVE_SSE2
+#endif
+/* the AVX2 kernels are built with a target attribute whatever the
+   compiler flags, and only used when mm_support() reports AVX2 */
+#if defined(HAVE_SSE2) && defined(__GNUC__) && !defined(HAVE_AVX2)
+#define HAVE_AVX2
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
 #if defined(HAVE_ALTIVEC) && !defined(CONFIG_DARWIN)
 #define pixel altivec_pixel
 #include <altivec.h>
@@ -368,8 +380,13 @@ static inline uint32_t no_rnd_avg32(uint32_t a, uint32_t b)
  */
 #define emms_c()
 
-/* should be defined by architectures supporting
-   one or more MultiMedia extension */
+/* CPU features the kernels are selected on */
+#define MM_SSE2   0x0010 /* PIV SSE2 functions */
+#define MM_AVX2   0x0100 /* AVX2 functions */
+
+/* features of the CPU, detected once by dsputil_static_init(). The
+   WMA_CPU environment variable ("c", "sse2" or "avx2") limits them to
+   the given level */
 int mm_support(void);
 
 #define __align16 __attribute__ ((aligned (16)))
@@ -382,7 +399,6 @@ int mm_support(void);
 #define MM_3DNOW  0x0004 /* AMD 3DNOW */
 #define MM_MMXEXT 0x0002 /* SSE integer functions or AMD MMX ext */
 #define MM_SSE    0x0008 /* SSE functions */
-#define MM_SSE2   0x0010 /* PIV SSE2 functions */
 
 //extern int mm_flags;
 int mm_flags;
@@ -504,25 +520,35 @@ typedef struct FFTComplex {
     FFTSample re, im;
 } FFTComplex;
 
+struct MDCTContext;
+
+/* largest FFT, the 1024 points of the 4096 point IMDCT of the longest
+   WMA blocks. There is one unrolled transform per size up to it */
+#define FFT_MAX_BITS 10
+
 typedef struct FFTContext {
     int nbits;
     int inverse;
-    uint16_t *revtab;
     FFTComplex *exptab;
     FFTComplex *exptab1; /* only used by SSE code */
-    void (*fft_calc)(struct FFTContext *s, FFTComplex *z);
+    void (*fft_calc)(struct FFTContext *s, FFTComplex *out,
+                     const FFTComplex *in);
+    void (*imdct_calc)(struct MDCTContext *s, FFTSample *output,
+                       const FFTSample *input, FFTSample *tmp);
+    void (*imdct_calc2)(struct MDCTContext *s, FFTSample *output,
+                        const FFTSample *in0, const FFTSample *in1,
+                        int ms, FFTSample *tmp);
 } FFTContext;
 
 int ff_fft_init(FFTContext *s, int nbits, int inverse);
-void ff_fft_permute(FFTContext *s, FFTComplex *z);
-void ff_fft_calc_c(FFTContext *s, FFTComplex *z);
-void ff_fft_calc_sse(FFTContext *s, FFTComplex *z);
-void ff_fft_calc_altivec(FFTContext *s, FFTComplex *z);
 
 ///added by yuanbin
-void fft_calc_c(struct FFTContext *s,  FFTComplex *z);
-
-
+/* fft_calc() is an in order split radix FFT, out and in must not
+   overlap. With SSE, out must be 16 byte aligned */
+void ff_fft_init_sse(FFTContext *s);
+void ff_fft_init_avx2(FFTContext *s);
+void fft_small_c(FFTContext *s, FFTComplex *out, const FFTComplex *in,
+                 int n, int stride);
 
 void ff_fft_end(FFTContext *s);
 
@@ -537,13 +563,112 @@ typedef struct MDCTContext {
     FFTContext fft;
 } MDCTContext;
 
-int ff_mdct_init(MDCTContext *s, int nbits, int inverse);
+int ff_mdct_init(MDCTContext *s, int nbits, int inverse, int mm_flags);
 void ff_imdct_calc(MDCTContext *s, FFTSample *output,
                 const FFTSample *input, FFTSample *tmp);
+void ff_imdct_calc_c(MDCTContext *s, FFTSample *output,
+                     const FFTSample *input, FFTSample *tmp);
+void ff_imdct_calc_sse(MDCTContext *s, FFTSample *output,
+                       const FFTSample *input, FFTSample *tmp);
+void ff_imdct_calc2(MDCTContext *s, FFTSample *output,
+                    const FFTSample *in0, const FFTSample *in1,
+                    int ms, FFTSample *tmp);
+void ff_imdct_calc2_c(MDCTContext *s, FFTSample *output,
+                      const FFTSample *in0, const FFTSample *in1,
+                      int ms, FFTSample *tmp);
+void ff_imdct_calc2_sse(MDCTContext *s, FFTSample *output,
+                        const FFTSample *in0, const FFTSample *in1,
+                        int ms, FFTSample *tmp);
 void ff_mdct_calc(MDCTContext *s, FFTSample *out,
                const FFTSample *input, FFTSample *tmp);
 void ff_mdct_end(MDCTContext *s);
 
+/* fixed point inverse FFT and MDCT. The twiddle factors have
+   FFT_FIXED_BITS fractional bits and the products are rounded, so the
+   results only depend on the input, whatever the compiler and the CPU.
+   There is no overflow if the input values of an inverse MDCT of size
+   2^nbits are below 2^(32 - nbits) in magnitude (the data grow by up
+   to a factor of 2 per FFT pass), or if the sum of their magnitudes is
+   below 2^30 (every output is a sum of the inputs rotated by unit
+   complex numbers) */
+
+#define FFT_FIXED_BITS 30
+
+typedef int32_t FFTSampleFixed;
+
+typedef struct FFTComplexFixed {
+    FFTSampleFixed re, im;
+} FFTComplexFixed;
+
+typedef struct FFTContextFixed {
+    int nbits;
+    uint16_t *revtab;
+    FFTComplexFixed *exptab;
+} FFTContextFixed;
+
+typedef struct MDCTContextFixed {
+    int n;  /* size of MDCT (i.e. number of input data * 2) */
+    int nbits; /* n = 2^nbits */
+    /* pre/post rotation tables */
+    FFTSampleFixed *tcos;
+    FFTSampleFixed *tsin;
+    FFTContextFixed fft;
+} MDCTContextFixed;
+
+int ff_fft_init_fixed(FFTContextFixed *s, int nbits);
+void ff_fft_calc_fixed(FFTContextFixed *s, FFTComplexFixed *z);
+void ff_fft_end_fixed(FFTContextFixed *s);
+int ff_mdct_init_fixed(MDCTContextFixed *s, int nbits);
+void ff_imdct_calc_fixed(MDCTContextFixed *s, FFTSampleFixed *output,
+                         const FFTSampleFixed *input, FFTSampleFixed *tmp);
+void ff_mdct_end_fixed(MDCTContextFixed *s);
+
+/* float vector operations used by the audio decoders. Unless noted
+   otherwise, len must be a multiple of 4 and no alignment is required */
+
+typedef struct FloatDSPContext {
+    /**
+     * windowed overlap-add: dst[i] += src[i] * win[i]
+     */
+    void (*vector_fmul_add)(float *dst, const float *src,
+                            const float *win, int len);
+    /**
+     * same with the window read backwards:
+     * dst[i] += src[i] * win[len - 1 - i]
+     */
+    void (*vector_fmul_reverse_add)(float *dst, const float *src,
+                                    const float *win, int len);
+    /**
+     * dst[i] += src[i]
+     */
+    void (*vector_add)(float *dst, const float *src, int len);
+    /**
+     * convert planar float samples to interleaved int16, rounding to
+     * nearest (same as lrintf) and saturating.
+     * len must be a multiple of 8
+     */
+    void (*float_to_int16_interleave)(int16_t *dst, const float **src,
+                                      int len, int channels);
+    /**
+     * scaled noise: dst[i] = noise[i] * e[i] * mult, where e[i] is
+     * exps[i], or exp if exps is NULL. Any len is allowed
+     */
+    void (*noise_fmul)(float *dst, const float *noise, const float *exps,
+                       float exp, float mult, int len);
+    /**
+     * coded values plus noise:
+     * dst[i] = (coefs[i] + noise[i]) * e[i] * mult, with e[i] as in
+     * noise_fmul(). Any len is allowed
+     */
+    void (*coef_noise_fmul)(float *dst, const int16_t *coefs,
+                            const float *noise, const float *exps,
+                            float exp, float mult, int len);
+} FloatDSPContext;
+
+void ff_float_dsp_init(FloatDSPContext *c, int mm_flags);
+void ff_float_dsp_init_sse(FloatDSPContext *c);
+void ff_float_dsp_init_avx2(FloatDSPContext *c);
+
 
 
 #ifndef HAVE_LRINTF
@@ -0,0 +1,207 @@
+/*
+ * AVX2 optimized audio DSP utils
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * @file dsputil_avx2.c
+ * AVX2 optimized audio DSP utils. The functions are only called when
+ * mm_support() reports AVX2. No FMA is used, so that the results are
+ * the same as with the C and SSE versions.
+ */
+#if defined(__SSE2__)
+/* must come before Wma_common.h, which redefines malloc and free */
+#include <immintrin.h>
+#endif
+#include "Wma_Decoder.h"
+#include "Wma_dsputil.h"
+
+#ifdef HAVE_AVX2
+
+namespace WMADECODER_NAMESPACE{
+
+TARGET_AVX2
+static void vector_fmul_add_avx2(float *dst, const float *src,
+                                 const float *win, int len)
+{
+    int i;
+    for(i = 0; i + 8 <= len; i += 8) {
+        __m256 d = _mm256_loadu_ps(dst + i);
+        __m256 t = _mm256_mul_ps(_mm256_loadu_ps(src + i),
+                                 _mm256_loadu_ps(win + i));
+        _mm256_storeu_ps(dst + i, _mm256_add_ps(d, t));
+    }
+    if (i < len) {
+        __m128 d = _mm_loadu_ps(dst + i);
+        __m128 t = _mm_mul_ps(_mm_loadu_ps(src + i), _mm_loadu_ps(win + i));
+        _mm_storeu_ps(dst + i, _mm_add_ps(d, t));
+    }
+}
+
+TARGET_AVX2
+static void vector_fmul_reverse_add_avx2(float *dst, const float *src,
+                                         const float *win, int len)
+{
+    int i;
+    const __m256i rev = _mm256_set_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256 w;
+    __m128 w4;
+
+    win += len;
+    for(i = 0; i + 8 <= len; i += 8) {
+        w = _mm256_permutevar8x32_ps(_mm256_loadu_ps(win - i - 8), rev);
+        _mm256_storeu_ps(dst + i,
+                         _mm256_add_ps(_mm256_loadu_ps(dst + i),
+                                       _mm256_mul_ps(_mm256_loadu_ps(src + i), w)));
+    }
+    if (i < len) {
+        w4 = _mm_loadu_ps(win - i - 4);
+        w4 = _mm_shuffle_ps(w4, w4, _MM_SHUFFLE(0, 1, 2, 3));
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i),
+                                          _mm_mul_ps(_mm_loadu_ps(src + i), w4)));
+    }
+}
+
+TARGET_AVX2
+static void vector_add_avx2(float *dst, const float *src, int len)
+{
+    int i;
+    for(i = 0; i + 8 <= len; i += 8)
+        _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_loadu_ps(dst + i),
+                                                _mm256_loadu_ps(src + i)));
+    if (i < len)
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i),
+                                          _mm_loadu_ps(src + i)));
+}
+
+/* same conversion as the SSE version, 16 samples of each channel at a
+   time. packssdw and punpcklwd work inside each 128 bit lane */
+TARGET_AVX2
+static void float_to_int16_interleave_avx2(int16_t *dst, const float **src,
+                                           int len, int channels)
+{
+    int i;
+    __m256i a, b, l, r;
+    __m128i a4, b4, l4, r4;
+
+    if (channels == 1) {
+        const float *s0 = src[0];
+        for(i = 0; i + 16 <= len; i += 16) {
+            a = _mm256_cvtps_epi32(_mm256_loadu_ps(s0 + i));
+            b = _mm256_cvtps_epi32(_mm256_loadu_ps(s0 + i + 8));
+            l = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b),
+                                         _MM_SHUFFLE(3, 1, 2, 0));
+            _mm256_storeu_si256((__m256i *)(dst + i), l);
+        }
+        if (i < len) {
+            a4 = _mm_cvtps_epi32(_mm_loadu_ps(s0 + i));
+            b4 = _mm_cvtps_epi32(_mm_loadu_ps(s0 + i + 4));
+            _mm_storeu_si128((__m128i *)(dst + i), _mm_packs_epi32(a4, b4));
+        }
+    } else if (channels == 2) {
+        const float *s0 = src[0];
+        const float *s1 = src[1];
+        for(i = 0; i + 16 <= len; i += 16) {
+            a = _mm256_cvtps_epi32(_mm256_loadu_ps(s0 + i));
+            b = _mm256_cvtps_epi32(_mm256_loadu_ps(s0 + i + 8));
+            l = _mm256_packs_epi32(a, b);
+            a = _mm256_cvtps_epi32(_mm256_loadu_ps(s1 + i));
+            b = _mm256_cvtps_epi32(_mm256_loadu_ps(s1 + i + 8));
+            r = _mm256_packs_epi32(a, b);
+            /* l and r hold samples 0-3, 8-11 | 4-7, 12-15, so the
+               interleaved samples come out in order */
+            _mm256_storeu_si256((__m256i *)(dst + 2 * i),
+                                _mm256_unpacklo_epi16(l, r));
+            _mm256_storeu_si256((__m256i *)(dst + 2 * i + 16),
+                                _mm256_unpackhi_epi16(l, r));
+        }
+        if (i < len) {
+            a4 = _mm_cvtps_epi32(_mm_loadu_ps(s0 + i));
+            b4 = _mm_cvtps_epi32(_mm_loadu_ps(s0 + i + 4));
+            l4 = _mm_packs_epi32(a4, b4);
+            a4 = _mm_cvtps_epi32(_mm_loadu_ps(s1 + i));
+            b4 = _mm_cvtps_epi32(_mm_loadu_ps(s1 + i + 4));
+            r4 = _mm_packs_epi32(a4, b4);
+            _mm_storeu_si128((__m128i *)(dst + 2 * i),
+                             _mm_unpacklo_epi16(l4, r4));
+            _mm_storeu_si128((__m128i *)(dst + 2 * i + 8),
+                             _mm_unpackhi_epi16(l4, r4));
+        }
+    } else {
+        int ch;
+        for(i = 0; i < len; i++) {
+            for(ch = 0; ch < channels; ch++) {
+                a4 = _mm_cvtps_epi32(_mm_load_ss(src[ch] + i));
+                *dst++ = _mm_extract_epi16(_mm_packs_epi32(a4, a4), 0);
+            }
+        }
+    }
+}
+
+TARGET_AVX2
+static void noise_fmul_avx2(float *dst, const float *noise, const float *exps,
+                            float exp, float mult, int len)
+{
+    int i;
+    __m256 m = _mm256_set1_ps(mult);
+    __m256 e = _mm256_set1_ps(exp);
+
+    for(i = 0; i + 8 <= len; i += 8) {
+        if (exps)
+            e = _mm256_loadu_ps(exps + i);
+        _mm256_storeu_ps(dst + i,
+                         _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(noise + i),
+                                                     e), m));
+    }
+    for(; i < len; i++)
+        dst[i] = noise[i] * (exps ? exps[i] : exp) * mult;
+}
+
+TARGET_AVX2
+static void coef_noise_fmul_avx2(float *dst, const int16_t *coefs,
+                                 const float *noise, const float *exps,
+                                 float exp, float mult, int len)
+{
+    int i;
+    __m256 m = _mm256_set1_ps(mult);
+    __m256 e = _mm256_set1_ps(exp);
+    __m256 c;
+    __m256i w;
+
+    for(i = 0; i + 8 <= len; i += 8) {
+        w = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(coefs + i)));
+        c = _mm256_add_ps(_mm256_cvtepi32_ps(w), _mm256_loadu_ps(noise + i));
+        if (exps)
+            e = _mm256_loadu_ps(exps + i);
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_mul_ps(c, e), m));
+    }
+    for(; i < len; i++)
+        dst[i] = (coefs[i] + noise[i]) * (exps ? exps[i] : exp) * mult;
+}
+
+void ff_float_dsp_init_avx2(FloatDSPContext *c)
+{
+    c->vector_fmul_add = vector_fmul_add_avx2;
+    c->vector_fmul_reverse_add = vector_fmul_reverse_add_avx2;
+    c->vector_add = vector_add_avx2;
+    c->float_to_int16_interleave = float_to_int16_interleave_avx2;
+    c->noise_fmul = noise_fmul_avx2;
+    c->coef_noise_fmul = coef_noise_fmul_avx2;
+}
+
+}
+
+#endif /* HAVE_AVX2 */
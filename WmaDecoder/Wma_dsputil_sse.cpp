@@ -0,0 +1,163 @@
+/*
+ * SSE optimized audio DSP utils
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * @file dsputil_sse.c
+ * SSE optimized audio DSP utils.
+ */
+#if defined(__SSE2__)
+/* must come before Wma_common.h, which redefines malloc and free */
+#include <emmintrin.h>
+#endif
+#include "Wma_Decoder.h"
+#include "Wma_dsputil.h"
+
+#ifdef HAVE_SSE2
+
+namespace WMADECODER_NAMESPACE{
+
+static void vector_fmul_add_sse(float *dst, const float *src,
+                                const float *win, int len)
+{
+    int i;
+    for(i = 0; i < len; i += 4) {
+        __m128 d = _mm_loadu_ps(dst + i);
+        __m128 t = _mm_mul_ps(_mm_loadu_ps(src + i), _mm_loadu_ps(win + i));
+        _mm_storeu_ps(dst + i, _mm_add_ps(d, t));
+    }
+}
+
+static void vector_fmul_reverse_add_sse(float *dst, const float *src,
+                                        const float *win, int len)
+{
+    int i;
+    win += len - 4;
+    for(i = 0; i < len; i += 4) {
+        __m128 w = _mm_loadu_ps(win - i);
+        __m128 d = _mm_loadu_ps(dst + i);
+        w = _mm_shuffle_ps(w, w, _MM_SHUFFLE(0, 1, 2, 3));
+        _mm_storeu_ps(dst + i, _mm_add_ps(d, _mm_mul_ps(_mm_loadu_ps(src + i), w)));
+    }
+}
+
+static void vector_add_sse(float *dst, const float *src, int len)
+{
+    int i;
+    for(i = 0; i < len; i += 4)
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i),
+                                          _mm_loadu_ps(src + i)));
+}
+
+/* cvtps2dq rounds with the current rounding mode (nearest even, like
+   lrintf) and returns 0x80000000 when out of range, which packssdw
+   saturates to -32768 just as the C code clips (int)rint(x) */
+static void float_to_int16_interleave_sse(int16_t *dst, const float **src,
+                                          int len, int channels)
+{
+    int i;
+    __m128i a, b;
+
+    if (channels == 1) {
+        const float *s0 = src[0];
+        for(i = 0; i < len; i += 8) {
+            a = _mm_cvtps_epi32(_mm_loadu_ps(s0 + i));
+            b = _mm_cvtps_epi32(_mm_loadu_ps(s0 + i + 4));
+            _mm_storeu_si128((__m128i *)(dst + i), _mm_packs_epi32(a, b));
+        }
+    } else if (channels == 2) {
+        const float *s0 = src[0];
+        const float *s1 = src[1];
+        __m128i l, r;
+        for(i = 0; i < len; i += 8) {
+            a = _mm_cvtps_epi32(_mm_loadu_ps(s0 + i));
+            b = _mm_cvtps_epi32(_mm_loadu_ps(s0 + i + 4));
+            l = _mm_packs_epi32(a, b);
+            a = _mm_cvtps_epi32(_mm_loadu_ps(s1 + i));
+            b = _mm_cvtps_epi32(_mm_loadu_ps(s1 + i + 4));
+            r = _mm_packs_epi32(a, b);
+            _mm_storeu_si128((__m128i *)(dst + 2 * i),
+                             _mm_unpacklo_epi16(l, r));
+            _mm_storeu_si128((__m128i *)(dst + 2 * i + 8),
+                             _mm_unpackhi_epi16(l, r));
+        }
+    } else {
+        int ch;
+        for(i = 0; i < len; i++) {
+            for(ch = 0; ch < channels; ch++) {
+                a = _mm_cvtps_epi32(_mm_load_ss(src[ch] + i));
+                *dst++ = _mm_extract_epi16(_mm_packs_epi32(a, a), 0);
+            }
+        }
+    }
+}
+
+/* the products are done in the same order as in the C versions, so
+   the results are the same */
+static void noise_fmul_sse(float *dst, const float *noise, const float *exps,
+                           float exp, float mult, int len)
+{
+    int i;
+    __m128 m = _mm_set1_ps(mult);
+    __m128 e = _mm_set1_ps(exp);
+
+    for(i = 0; i + 4 <= len; i += 4) {
+        if (exps)
+            e = _mm_loadu_ps(exps + i);
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(noise + i),
+                                                     e), m));
+    }
+    for(; i < len; i++)
+        dst[i] = noise[i] * (exps ? exps[i] : exp) * mult;
+}
+
+static void coef_noise_fmul_sse(float *dst, const int16_t *coefs,
+                                const float *noise, const float *exps,
+                                float exp, float mult, int len)
+{
+    int i;
+    __m128 m = _mm_set1_ps(mult);
+    __m128 e = _mm_set1_ps(exp);
+    __m128 c;
+    __m128i w;
+
+    for(i = 0; i + 4 <= len; i += 4) {
+        /* sign extend the 4 coded values to 32 bits */
+        w = _mm_loadl_epi64((const __m128i *)(coefs + i));
+        w = _mm_srai_epi32(_mm_unpacklo_epi16(w, w), 16);
+        c = _mm_add_ps(_mm_cvtepi32_ps(w), _mm_loadu_ps(noise + i));
+        if (exps)
+            e = _mm_loadu_ps(exps + i);
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_mul_ps(c, e), m));
+    }
+    for(; i < len; i++)
+        dst[i] = (coefs[i] + noise[i]) * (exps ? exps[i] : exp) * mult;
+}
+
+void ff_float_dsp_init_sse(FloatDSPContext *c)
+{
+    c->vector_fmul_add = vector_fmul_add_sse;
+    c->vector_fmul_reverse_add = vector_fmul_reverse_add_sse;
+    c->vector_add = vector_add_sse;
+    c->float_to_int16_interleave = float_to_int16_interleave_sse;
+    c->noise_fmul = noise_fmul_sse;
+    c->coef_noise_fmul = coef_noise_fmul_sse;
+}
+
+}
+
+#endif /* HAVE_SSE2 */
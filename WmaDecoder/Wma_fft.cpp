@@ -26,84 +26,333 @@
 
 namespace WMADECODER_NAMESPACE{
 
+/* 2 and 4 point FFTs of in[0], in[stride], ... into out[] */
+static always_inline void fft2_c(FFTComplex *out, const FFTComplex *in,
+                                 int stride)
+{
+    FFTComplex a = in[0], b = in[stride];
+
+    out[0].re = a.re + b.re;
+    out[0].im = a.im + b.im;
+    out[1].re = a.re - b.re;
+    out[1].im = a.im - b.im;
+}
+
+static always_inline void fft4_c(FFTComplex *out, const FFTComplex *in,
+                                 int stride, const int inverse)
+{
+    FFTSample t0re, t0im, t1re, t1im, t2re, t2im, t3re, t3im;
+
+    t0re = in[0].re + in[2 * stride].re;
+    t0im = in[0].im + in[2 * stride].im;
+    t1re = in[0].re - in[2 * stride].re;
+    t1im = in[0].im - in[2 * stride].im;
+    t2re = in[stride].re + in[3 * stride].re;
+    t2im = in[stride].im + in[3 * stride].im;
+    t3re = in[stride].re - in[3 * stride].re;
+    t3im = in[stride].im - in[3 * stride].im;
+    out[0].re = t0re + t2re;
+    out[0].im = t0im + t2im;
+    out[2].re = t0re - t2re;
+    out[2].im = t0im - t2im;
+    /* t1 -+ i * t3 */
+    if (inverse) {
+        out[1].re = t1re - t3im;
+        out[1].im = t1im + t3re;
+        out[3].re = t1re + t3im;
+        out[3].im = t1im - t3re;
+    } else {
+        out[1].re = t1re + t3im;
+        out[1].im = t1im - t3re;
+        out[3].re = t1re - t3im;
+        out[3].im = t1im + t3re;
+    }
+}
+
 /**
- * The size of the FFT is 2^nbits. If inverse is TRUE, inverse FFT is
- * done 
+ * FFT of the n <= 4 points in[0], in[stride], ... into out[0..n-1].
  */
-int fft_inits(FFTContext *s, int nbits, int inverse)
+void fft_small_c(FFTContext *s, FFTComplex *out, const FFTComplex *in,
+                 int n, int stride)
 {
-    int i, j, m, n;
-    float alpha, c1, s1, s2;
+    if (n == 1)
+        out[0] = in[0];
+    else if (n == 2)
+        fft2_c(out, in, stride);
+    else if (s->inverse)
+        fft4_c(out, in, stride, 1);
+    else
+        fft4_c(out, in, stride, 0);
+}
+
+/* complex multiplication: p = a * b */
+#define CMUL(pre, pim, are, aim, bre, bim) \
+{\
+   pre = (are) * (bre) - (aim) * (bim);\
+   pim = (are) * (bim) + (bre) * (aim);\
+}
+
+/* the split radix butterflies of a stage of size n: out[0..n/2-1] holds
+   the transform of the even points, out[n/2..3n/4-1] and
+   out[3n/4..n-1] the ones of the points 4k+1 and 4k+3 */
+static always_inline void fft_pass_c(FFTContext *s, FFTComplex *out, int n,
+                                     const int inverse)
+{
+    int k, n4 = n >> 2;
+    const FFTComplex *w1, *w3;
+    FFTComplex *q1, *q3;
+    FFTSample are, aim, bre, bim, tre, tim, dre, dim;
+
+    w1 = s->exptab + n / 2 - 4;
+    w3 = w1 + n4;
+    /* out[k + n/4] gets u - i * d for the forward transform, u + i * d
+       for the inverse one, and out[k + 3n/4] the other one */
+    q1 = out + n4;
+    q3 = out + 3 * n4;
+    if (inverse) {
+        q1 = out + 3 * n4;
+        q3 = out + n4;
+    }
+    for(k = 0; k < n4; k++) {
+        FFTComplex u0 = out[k], u1 = out[k + n4];
+
+        CMUL(are, aim, w1[k].re, w1[k].im, out[k + 2 * n4].re, out[k + 2 * n4].im);
+        CMUL(bre, bim, w3[k].re, w3[k].im, out[k + 3 * n4].re, out[k + 3 * n4].im);
+        tre = are + bre;
+        tim = aim + bim;
+        dre = are - bre;
+        dim = aim - bim;
+        out[k].re = u0.re + tre;
+        out[k].im = u0.im + tim;
+        out[k + 2 * n4].re = u0.re - tre;
+        out[k + 2 * n4].im = u0.im - tim;
+        q1[k].re = u1.re + dim;
+        q1[k].im = u1.im - dre;
+        q3[k].re = u1.re - dim;
+        q3[k].im = u1.im + dre;
+    }
+}
+
+/* FFT codelets: fftN_fwd_c() and fftN_inv_c() do the split radix
+   transform of the N points in[0], in[stride], ... into out[0..N-1].
+   Each size calls the smaller ones directly, so the sizes, the loop
+   counts and the twiddle offsets are all constants */
+static always_inline void fft4_fwd_c(FFTContext *s, FFTComplex *out,
+                                     const FFTComplex *in, int stride)
+{
+    fft4_c(out, in, stride, 0);
+}
+
+static always_inline void fft4_inv_c(FFTContext *s, FFTComplex *out,
+                                     const FFTComplex *in, int stride)
+{
+    fft4_c(out, in, stride, 1);
+}
+
+static always_inline void fft8_fwd_c(FFTContext *s, FFTComplex *out,
+                                     const FFTComplex *in, int stride)
+{
+    fft4_c(out, in, 2 * stride, 0);
+    fft2_c(out + 4, in + stride, 4 * stride);
+    fft2_c(out + 6, in + 3 * stride, 4 * stride);
+    fft_pass_c(s, out, 8, 0);
+}
+
+static always_inline void fft8_inv_c(FFTContext *s, FFTComplex *out,
+                                     const FFTComplex *in, int stride)
+{
+    fft4_c(out, in, 2 * stride, 1);
+    fft2_c(out + 4, in + stride, 4 * stride);
+    fft2_c(out + 6, in + 3 * stride, 4 * stride);
+    fft_pass_c(s, out, 8, 1);
+}
+
+#define DECL_FFT_C(n, n2, n4)\
+static void fft##n##_fwd_c(FFTContext *s, FFTComplex *out,\
+                           const FFTComplex *in, int stride)\
+{\
+    fft##n2##_fwd_c(s, out, in, 2 * stride);\
+    fft##n4##_fwd_c(s, out + n / 2, in + stride, 4 * stride);\
+    fft##n4##_fwd_c(s, out + 3 * n / 4, in + 3 * stride, 4 * stride);\
+    fft_pass_c(s, out, n, 0);\
+}\
+\
+static void fft##n##_inv_c(FFTContext *s, FFTComplex *out,\
+                           const FFTComplex *in, int stride)\
+{\
+    fft##n2##_inv_c(s, out, in, 2 * stride);\
+    fft##n4##_inv_c(s, out + n / 2, in + stride, 4 * stride);\
+    fft##n4##_inv_c(s, out + 3 * n / 4, in + 3 * stride, 4 * stride);\
+    fft_pass_c(s, out, n, 1);\
+}
+
+DECL_FFT_C(16, 8, 4)
+DECL_FFT_C(32, 16, 8)
+DECL_FFT_C(64, 32, 16)
+DECL_FFT_C(128, 64, 32)
+DECL_FFT_C(256, 128, 64)
+DECL_FFT_C(512, 256, 128)
+DECL_FFT_C(1024, 512, 256)
+
+/* the FFTs of the whole input, called through s->fft_calc */
+#define DECL_FFT_CALC_C(n)\
+static void fft##n##_calc_c(FFTContext *s, FFTComplex *out,\
+                            const FFTComplex *in)\
+{\
+    if (s->inverse)\
+        fft##n##_inv_c(s, out, in, 1);\
+    else\
+        fft##n##_fwd_c(s, out, in, 1);\
+}
+
+DECL_FFT_CALC_C(8)
+DECL_FFT_CALC_C(16)
+DECL_FFT_CALC_C(32)
+DECL_FFT_CALC_C(64)
+DECL_FFT_CALC_C(128)
+DECL_FFT_CALC_C(256)
+DECL_FFT_CALC_C(512)
+DECL_FFT_CALC_C(1024)
+
+static void fft_small_calc_c(FFTContext *s, FFTComplex *out,
+                             const FFTComplex *in)
+{
+    fft_small_c(s, out, in, 1 << s->nbits, 1);
+}
+
+static void (* const fft_calc_tab_c[FFT_MAX_BITS + 1])(FFTContext *s,
+                                                       FFTComplex *out,
+                                                       const FFTComplex *in) = {
+    fft_small_calc_c, fft_small_calc_c, fft_small_calc_c,
+    fft8_calc_c, fft16_calc_c, fft32_calc_c, fft64_calc_c,
+    fft128_calc_c, fft256_calc_c, fft512_calc_c, fft1024_calc_c,
+};
+
+/**
+ * The size of the FFT is 2^nbits, at most 2^FFT_MAX_BITS. If inverse is
+ * TRUE, inverse FFT is done. The transform of this size is picked here,
+ * the SSE one if mm_flags has MM_SSE2
+ */
+int fft_inits(FFTContext *s, int nbits, int inverse, int mm_flags)
+{
+    int i, m, n;
+    double alpha, s2;
+    FFTComplex *w1, *w3;
     
+    if (nbits > FFT_MAX_BITS)
+        return -1;
     s->nbits = nbits;
     n = 1 << nbits;
-
-    s->exptab = (FFTComplex*)av_malloc((n / 2) * sizeof(FFTComplex));
-    if (!s->exptab)
-        goto fail;
-    s->revtab = (uint16_t*)av_malloc(n * sizeof(uint16_t));
-    if (!s->revtab)
-        goto fail;
     s->inverse = inverse;
+    s->exptab = NULL;
+    s->exptab1 = NULL;
+
+    /* split radix twiddle factors: the stage of size m (8 <= m <= n)
+       uses w^k and w^3k for k < m/4, with w = exp(-+2*i*pi/m). They are
+       stored in the order the stages consume them, w^k then w^3k, and
+       the stage of size m starts at m/2 - 4 */
+    if (n >= 8) {
+        s->exptab = (FFTComplex*)av_malloc((n - 4) * sizeof(FFTComplex));
+        if (!s->exptab)
+            goto fail;
+    }
 
     s2 = inverse ? 1.0 : -1.0;
         
-    for(i=0;i<(n/2);i++) {
-        alpha = 2 * M_PI * (float)i / (float)n;
-        c1 = cos(alpha);
-        s1 = sin(alpha) * s2;
-        s->exptab[i].re = c1;
-        s->exptab[i].im = s1;
+    for(m = 8; m <= n; m <<= 1) {
+        w1 = s->exptab + m / 2 - 4;
+        w3 = w1 + m / 4;
+        for(i = 0; i < m / 4; i++) {
+            alpha = 2 * M_PI * i / m;
+            w1[i].re = cos(alpha);
+            w1[i].im = sin(alpha) * s2;
+            w3[i].re = cos(3 * alpha);
+            w3[i].im = sin(3 * alpha) * s2;
+        }
     }
-    s->fft_calc = fft_calc_c;
-    s->exptab1 = NULL;
+    s->fft_calc = fft_calc_tab_c[nbits];
+    s->imdct_calc = ff_imdct_calc_c;
+    s->imdct_calc2 = ff_imdct_calc2_c;
     /* compute constant table for HAVE_SSE version */
-#if (defined(HAVE_MMX) && defined(HAVE_BUILTIN_VECTOR)) || defined(HAVE_ALTIVEC)
-    {
-        int has_vectors = 0;
-
-#if defined(HAVE_MMX)
-        has_vectors = mm_support() & MM_SSE;
-#endif
-#if defined(HAVE_ALTIVEC) && !defined(ALTIVEC_USE_REFERENCE_C_CODE)
-        has_vectors = mm_support() & MM_ALTIVEC;
-#endif
-        if (has_vectors) {
-            int np, nblocks, np2, l;
-            FFTComplex *q;
-            
-            np = 1 << nbits;
-            nblocks = np >> 3;
-            np2 = np >> 1;
-            s->exptab1 = av_malloc(np * 2 * sizeof(FFTComplex));
-            if (!s->exptab1)
-                goto fail;
-            q = s->exptab1;
-            do {
-                for(l = 0; l < np2; l += 2 * nblocks) {
-                    *q++ = s->exptab[l];
-                    *q++ = s->exptab[l + nblocks];
-
-                    q->re = -s->exptab[l].im;
-                    q->im = s->exptab[l].re;
-                    q++;
-                    q->re = -s->exptab[l + nblocks].im;
-                    q->im = s->exptab[l + nblocks].re;
-                    q++;
-                }
-                nblocks = nblocks >> 1;
-            } while (nblocks != 0);
-            av_freep(&s->exptab);
-#if defined(HAVE_MMX)
-            s->fft_calc = fft_calc_sse;
-#else
-            s->fft_calc = fft_calc_altivec;
-#endif
+#if defined(HAVE_SSE2)
+    /* the SSE code handles two butterflies at once, so it needs at
+       least one stage of size 8 */
+    if (n >= 8 && (mm_flags & MM_SSE2)) {
+        FFTComplex *q;
+
+        /* for each pair of butterflies k, k + 1 of a stage: w^k, w^k
+           multiplied by i, then the same for w^3k. The stage of size m
+           starts at m - 8 */
+        s->exptab1 = (FFTComplex*)av_malloc((2 * n - 8) * sizeof(FFTComplex));
+        if (!s->exptab1)
+            goto fail;
+        q = s->exptab1;
+        for(m = 8; m <= n; m <<= 1) {
+            w1 = s->exptab + m / 2 - 4;
+            w3 = w1 + m / 4;
+            for(i = 0; i < m / 4; i += 2) {
+                *q++ = w1[i];
+                *q++ = w1[i + 1];
+                q->re = -w1[i].im;
+                q->im = w1[i].re;
+                q++;
+                q->re = -w1[i + 1].im;
+                q->im = w1[i + 1].re;
+                q++;
+                *q++ = w3[i];
+                *q++ = w3[i + 1];
+                q->re = -w3[i].im;
+                q->im = w3[i].re;
+                q++;
+                q->re = -w3[i + 1].im;
+                q->im = w3[i + 1].re;
+                q++;
+            }
         }
+        av_freep(&s->exptab);
+        ff_fft_init_sse(s);
+#if defined(HAVE_AVX2)
+        if (mm_flags & MM_AVX2)
+            ff_fft_init_avx2(s);
+#endif
     }
 #endif
+    return 0;
+ fail:
+    av_freep(&s->exptab);
+    av_freep(&s->exptab1);
+    return -1;
+}
+
+void fft_end(FFTContext *s)
+{
+    av_freep(&s->exptab);
+    av_freep(&s->exptab1);
+}
+
+/**
+ * Init a fixed point inverse FFT of size 2^nbits.
+ */
+int ff_fft_init_fixed(FFTContextFixed *s, int nbits)
+{
+    int i, j, m, n;
+    double alpha;
+
+    s->nbits = nbits;
+    n = 1 << nbits;
 
-    /* compute bit reverse table */
+    s->exptab = (FFTComplexFixed*)av_malloc((n / 2) * sizeof(FFTComplexFixed));
+    s->revtab = (uint16_t*)av_malloc(n * sizeof(uint16_t));
+    if (!s->exptab || !s->revtab) {
+        ff_fft_end_fixed(s);
+        return -1;
+    }
+
+    for(i=0;i<(n/2);i++) {
+        alpha = 2 * M_PI * (double)i / (double)n;
+        s->exptab[i].re = lrint(cos(alpha) * (1 << FFT_FIXED_BITS));
+        s->exptab[i].im = lrint(sin(alpha) * (1 << FFT_FIXED_BITS));
+    }
 
     for(i=0;i<n;i++) {
         m=0;
@@ -113,17 +362,11 @@ int fft_inits(FFTContext *s, int nbits, int inverse)
         s->revtab[i]=m;
     }
     return 0;
- fail:
-    av_freep(&s->revtab);
-    av_freep(&s->exptab);
-    av_freep(&s->exptab1);
-    return -1;
 }
 
-/* butter fly op */
-#define BF(pre, pim, qre, qim, pre1, pim1, qre1, qim1) \
+#define BF_FIXED(pre, pim, qre, qim, pre1, pim1, qre1, qim1) \
 {\
-  FFTSample ax, ay, bx, by;\
+  FFTSampleFixed ax, ay, bx, by;\
   bx=pre1;\
   by=pim1;\
   ax=qre1;\
@@ -134,28 +377,29 @@ int fft_inits(FFTContext *s, int nbits, int inverse)
   qim = (by - ay);\
 }
 
-#define MUL16(a,b) ((a) * (b))
-
-#define CMUL(pre, pim, are, aim, bre, bim) \
+/* complex multiplication by a twiddle factor, rounded to nearest */
+#define CMUL_FIXED(pre, pim, are, aim, bre, bim) \
 {\
-   pre = (MUL16(are, bre) - MUL16(aim, bim));\
-   pim = (MUL16(are, bim) + MUL16(bre, aim));\
+   int64_t _are = (are), _aim = (aim), _bre = (bre), _bim = (bim);\
+   pre = (FFTSampleFixed)((_are * _bre - _aim * _bim + \
+                           (1 << (FFT_FIXED_BITS - 1))) >> FFT_FIXED_BITS);\
+   pim = (FFTSampleFixed)((_are * _bim + _aim * _bre + \
+                           (1 << (FFT_FIXED_BITS - 1))) >> FFT_FIXED_BITS);\
 }
 
 /**
- * Do a complex FFT with the parameters defined in fft_init(). The
- * input data must be permuted before with s->revtab table. No
- * 1.0/sqrt(n) normalization is done.  
+ * Radix-2 inverse FFT in fixed point, in place. The input must be
+ * permuted before with s->revtab. nbits must be at least 2.
  */
-void fft_calc_c(struct FFTContext *s,  FFTComplex *z)
+void ff_fft_calc_fixed(FFTContextFixed *s, FFTComplexFixed *z)
 {
     int ln = s->nbits;
-    int	j, np, np2;
-    int	nblocks, nloops;
-    register FFTComplex *p, *q;
-    FFTComplex *exptab = s->exptab;
+    int j, np, np2;
+    int nblocks, nloops;
+    FFTComplexFixed *p, *q;
+    const FFTComplexFixed *exptab = s->exptab;
     int l;
-    FFTSample tmp_re, tmp_im;
+    FFTSampleFixed tmp_re, tmp_im;
 
     np = 1 << ln;
 
@@ -164,131 +408,41 @@ void fft_calc_c(struct FFTContext *s,  FFTComplex *z)
     p=&z[0];
     j=(np >> 1);
     do {
-        BF(p[0].re, p[0].im, p[1].re, p[1].im, 
-           p[0].re, p[0].im, p[1].re, p[1].im);
+        BF_FIXED(p[0].re, p[0].im, p[1].re, p[1].im,
+                 p[0].re, p[0].im, p[1].re, p[1].im);
         p+=2;
     } while (--j != 0);
 
     /* pass 1 */
 
-    
     p=&z[0];
     j=np >> 2;
-    if (s->inverse) {
-        do {
-            BF(p[0].re, p[0].im, p[2].re, p[2].im, 
-               p[0].re, p[0].im, p[2].re, p[2].im);
-            BF(p[1].re, p[1].im, p[3].re, p[3].im, 
-               p[1].re, p[1].im, -p[3].im, p[3].re);
-            p+=4;
-        } while (--j != 0);
-    } else {
-        do {
-            BF(p[0].re, p[0].im, p[2].re, p[2].im, 
-               p[0].re, p[0].im, p[2].re, p[2].im);
-            BF(p[1].re, p[1].im, p[3].re, p[3].im, 
-               p[1].re, p[1].im, p[3].im, -p[3].re);
-            p+=4;
-        } while (--j != 0);
-    }
-    /* pass 2 .. ln-1 */
-
-    nblocks = np >> 3;
-    nloops = 1 << 2;
-    np2 = np >> 1;
     do {
-        p = z;
-        q = z + nloops;
-        for (j = 0; j < nblocks; ++j) {
-            BF(p->re, p->im, q->re, q->im,
-               p->re, p->im, q->re, q->im);
-            
-            p++;
-            q++;
-            for(l = nblocks; l < np2; l += nblocks) {
-                CMUL(tmp_re, tmp_im, exptab[l].re, exptab[l].im, q->re, q->im);
-                BF(p->re, p->im, q->re, q->im,
-                   p->re, p->im, tmp_re, tmp_im);
-                p++;
-                q++;
-            }
-
-            p += nloops;
-            q += nloops;
-        }
-        nblocks = nblocks >> 1;
-        nloops = nloops << 1;
-    } while (nblocks != 0);
-}
-
-
-/**
- * Do a complex FFT with the parameters defined in ff_fft_init(). The
- * input data must be permuted before with s->revtab table. No
- * 1.0/sqrt(n) normalization is done.
- */
-void ff_fft_calc_c(FFTContext *s, FFTComplex *z)
-{
-    int ln = s->nbits;
-    int j, np, np2;
-    int nblocks, nloops;
-    register FFTComplex *p, *q;
-    FFTComplex *exptab = s->exptab;
-    int l;
-    FFTSample tmp_re, tmp_im;
-
-    np = 1 << ln;
-
-    /* pass 0 */
-
-    p=&z[0];
-    j=(np >> 1);
-    do {
-        BF(p[0].re, p[0].im, p[1].re, p[1].im,
-           p[0].re, p[0].im, p[1].re, p[1].im);
-        p+=2;
+        BF_FIXED(p[0].re, p[0].im, p[2].re, p[2].im,
+                 p[0].re, p[0].im, p[2].re, p[2].im);
+        BF_FIXED(p[1].re, p[1].im, p[3].re, p[3].im,
+                 p[1].re, p[1].im, -p[3].im, p[3].re);
+        p+=4;
     } while (--j != 0);
 
-    /* pass 1 */
-
-
-    p=&z[0];
-    j=np >> 2;
-    if (s->inverse) {
-        do {
-            BF(p[0].re, p[0].im, p[2].re, p[2].im,
-               p[0].re, p[0].im, p[2].re, p[2].im);
-            BF(p[1].re, p[1].im, p[3].re, p[3].im,
-               p[1].re, p[1].im, -p[3].im, p[3].re);
-            p+=4;
-        } while (--j != 0);
-    } else {
-        do {
-            BF(p[0].re, p[0].im, p[2].re, p[2].im,
-               p[0].re, p[0].im, p[2].re, p[2].im);
-            BF(p[1].re, p[1].im, p[3].re, p[3].im,
-               p[1].re, p[1].im, p[3].im, -p[3].re);
-            p+=4;
-        } while (--j != 0);
-    }
     /* pass 2 .. ln-1 */
 
     nblocks = np >> 3;
     nloops = 1 << 2;
     np2 = np >> 1;
-    do {
+    while (nblocks != 0) {
         p = z;
         q = z + nloops;
         for (j = 0; j < nblocks; ++j) {
-            BF(p->re, p->im, q->re, q->im,
-               p->re, p->im, q->re, q->im);
+            BF_FIXED(p->re, p->im, q->re, q->im,
+                     p->re, p->im, q->re, q->im);
 
             p++;
             q++;
             for(l = nblocks; l < np2; l += nblocks) {
-                CMUL(tmp_re, tmp_im, exptab[l].re, exptab[l].im, q->re, q->im);
-                BF(p->re, p->im, q->re, q->im,
-                   p->re, p->im, tmp_re, tmp_im);
+                CMUL_FIXED(tmp_re, tmp_im, exptab[l].re, exptab[l].im, q->re, q->im);
+                BF_FIXED(p->re, p->im, q->re, q->im,
+                         p->re, p->im, tmp_re, tmp_im);
                 p++;
                 q++;
             }
@@ -298,35 +452,13 @@ void ff_fft_calc_c(FFTContext *s, FFTComplex *z)
         }
         nblocks = nblocks >> 1;
         nloops = nloops << 1;
-    } while (nblocks != 0);
-}
-
-/**
- * Do the permutation needed BEFORE calling fft_calc()
- */
-void fft_permute(FFTContext *s, FFTComplex *z)
-{
-    int j, k, np;
-    FFTComplex tmp;
-    const uint16_t *revtab = s->revtab;
-    
-    /* reverse */
-    np = 1 << s->nbits;
-    for(j=0;j<np;j++) {
-        k = revtab[j];
-        if (k < j) {
-            tmp = z[k];
-            z[k] = z[j];
-            z[j] = tmp;
-        }
     }
 }
 
-void fft_end(FFTContext *s)
+void ff_fft_end_fixed(FFTContextFixed *s)
 {
     av_freep(&s->revtab);
     av_freep(&s->exptab);
-    av_freep(&s->exptab1);
 }
 
 }
@@ -0,0 +1,382 @@
+/*
+ * FFT/MDCT transform with AVX2 optimizations
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * @file fft_avx2.c
+ * Stereo IMDCT with AVX2 optimizations. The two channels are transformed
+ * together, channel 0 in the low 128 bits of each register and channel 1
+ * in the high 128 bits. Each half goes through the same operations as
+ * in fft_sse.c, which all work within 128 bit lanes, so the results are
+ * the same as with two ff_imdct_calc_sse() calls.
+ */
+#if defined(__SSE2__)
+/* must come before Wma_common.h, which redefines malloc and free */
+#include <immintrin.h>
+#endif
+#include "Wma_Decoder.h"
+#include "Wma_dsputil.h"
+
+#ifdef HAVE_AVX2
+
+namespace WMADECODER_NAMESPACE{
+
+static const int p1p1p1m1[4] __align16 =
+    { 0, 0, 0, (int)0x80000000 };
+
+static const int p1p1m1p1[4] __align16 =
+    { 0, 0, (int)0x80000000, 0 };
+
+static const int p1m1p1m1[4] __align16 =
+    { 0, (int)0x80000000, 0, (int)0x80000000 };
+
+static const int m1m1m1m1[4] __align16 =
+    { (int)0x80000000, (int)0x80000000, (int)0x80000000, (int)0x80000000 };
+
+/* the same four floats in both lanes */
+#define BCAST(p) _mm256_broadcast_ps((const __m128 *)(p))
+
+/* _mm_movelh_ps() and _mm_movehl_ps() in each lane */
+#define MOVELH(a, b) \
+    _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(a), _mm256_castps_pd(b)))
+#define MOVEHL(a, b) \
+    _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(b), _mm256_castps_pd(a)))
+
+/* complex multiplication of b by the twiddle pair c = w, c1 = i * w */
+#define CMUL2(b, c, c1) \
+    _mm256_add_ps(_mm256_mul_ps(c, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 0, 0))), \
+                  _mm256_mul_ps(c1, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 1, 1))))
+
+/* load the complex values p and q of both channels, channel 1 being d
+   points after channel 0 */
+#define LOAD2(p, q) \
+    _mm_loadh_pi(_mm_castpd_ps(_mm_load_sd((const double *)(p))), \
+                 (const __m64 *)(q))
+#define LOAD2X2(p, q, d) \
+    _mm256_insertf128_ps(_mm256_castps128_ps256(LOAD2(p, q)), \
+                         LOAD2((p) + (d), (q) + (d)), 1)
+
+/* store the lanes of v at p and p + d */
+#define STOREX2(p, v, d) \
+{\
+    _mm_storeu_ps(p, _mm256_castps256_ps128(v));\
+    _mm_storeu_ps((p) + (d), _mm256_extractf128_ps(v, 1));\
+}
+
+/* reverse the order of the four floats of each lane */
+#define REVERSE(a) _mm256_shuffle_ps(a, a, _MM_SHUFFLE(0, 1, 2, 3))
+
+/* The transforms below work on pairs of points: the points k, k + 1 of
+   channel 0 then the same of channel 1, in 8 floats. The output of a
+   transform of n points is n / 2 such pairs, the inputs are read in
+   each channel, at in and in + d */
+
+TARGET_AVX2
+static always_inline void fft4_avx2(__m256 *lo, __m256 *hi,
+                                    const FFTComplex *in, int stride, int d,
+                                    const int inverse)
+{
+    __m256 a, b, t, dd, u0, u1;
+    __m256 sign = BCAST(inverse ? p1p1m1p1 : p1p1p1m1);
+
+    a = LOAD2X2(in, in + stride, d);
+    b = LOAD2X2(in + 2 * stride, in + 3 * stride, d);
+    t = _mm256_add_ps(a, b);
+    dd = _mm256_sub_ps(a, b);
+    u0 = MOVELH(t, dd);
+    u1 = MOVEHL(dd, t);
+    u1 = _mm256_xor_ps(_mm256_shuffle_ps(u1, u1, _MM_SHUFFLE(2, 3, 1, 0)), sign);
+    *lo = _mm256_add_ps(u0, u1);
+    *hi = _mm256_sub_ps(u0, u1);
+}
+
+TARGET_AVX2
+static always_inline void fft_pass_avx2(__m256 *u0, __m256 *u1, __m256 *a,
+                                        __m256 *b, const __m128 *w,
+                                        const int inverse)
+{
+    __m256 t, d, x, y;
+    __m256 sign = BCAST(p1m1p1m1);
+
+    x = CMUL2(*a, BCAST(&w[0]), BCAST(&w[1]));
+    y = CMUL2(*b, BCAST(&w[2]), BCAST(&w[3]));
+    t = _mm256_add_ps(x, y);
+    d = _mm256_sub_ps(x, y);
+    *a = _mm256_sub_ps(*u0, t);
+    *u0 = _mm256_add_ps(*u0, t);
+    d = _mm256_xor_ps(_mm256_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)), sign);
+    if (inverse) {
+        *b = _mm256_add_ps(*u1, d);
+        *u1 = _mm256_sub_ps(*u1, d);
+    } else {
+        *b = _mm256_sub_ps(*u1, d);
+        *u1 = _mm256_add_ps(*u1, d);
+    }
+}
+
+TARGET_AVX2
+static always_inline void fft8_avx2(FFTContext *s, __m256 *o,
+                                    const FFTComplex *in, int stride, int d,
+                                    const int inverse)
+{
+    __m256 a, b, c, e;
+
+    fft4_avx2(&o[0], &o[1], in, 2 * stride, d, inverse);
+    a = LOAD2X2(in + stride, in + 3 * stride, d);
+    b = LOAD2X2(in + 5 * stride, in + 7 * stride, d);
+    c = _mm256_add_ps(a, b);
+    e = _mm256_sub_ps(a, b);
+    o[2] = MOVELH(c, e);
+    o[3] = MOVEHL(e, c);
+    fft_pass_avx2(&o[0], &o[1], &o[2], &o[3], (const __m128 *)s->exptab1,
+                  inverse);
+}
+
+TARGET_AVX2
+static always_inline void fft16_avx2(FFTContext *s, __m256 *o,
+                                     const FFTComplex *in, int stride, int d,
+                                     const int inverse)
+{
+    const __m128 *w = (const __m128 *)(s->exptab1 + 8);
+
+    fft8_avx2(s, o, in, 2 * stride, d, inverse);
+    fft4_avx2(&o[4], &o[5], in + stride, 4 * stride, d, inverse);
+    fft4_avx2(&o[6], &o[7], in + 3 * stride, 4 * stride, d, inverse);
+    fft_pass_avx2(&o[0], &o[2], &o[4], &o[6], w, inverse);
+    fft_pass_avx2(&o[1], &o[3], &o[5], &o[7], w + 4, inverse);
+}
+
+/* the pair holding point k is at out + 2 * k */
+TARGET_AVX2
+static always_inline void fft_stage_avx2(FFTContext *s, FFTComplex *out, int n,
+                                         const int inverse)
+{
+    int k, n4 = n >> 2;
+    const __m128 *w = (const __m128 *)(s->exptab1 + n - 8);
+
+    for(k = 0; k < n4; k += 2) {
+        __m256 u0, u1, a, b;
+
+        u0 = _mm256_loadu_ps(&out[2 * k].re);
+        u1 = _mm256_loadu_ps(&out[2 * (k + n4)].re);
+        a = _mm256_loadu_ps(&out[2 * (k + 2 * n4)].re);
+        b = _mm256_loadu_ps(&out[2 * (k + 3 * n4)].re);
+        fft_pass_avx2(&u0, &u1, &a, &b, w, inverse);
+        w += 4;
+        _mm256_storeu_ps(&out[2 * k].re, u0);
+        _mm256_storeu_ps(&out[2 * (k + n4)].re, u1);
+        _mm256_storeu_ps(&out[2 * (k + 2 * n4)].re, a);
+        _mm256_storeu_ps(&out[2 * (k + 3 * n4)].re, b);
+    }
+}
+
+#define DECL_FFT_LEAF_AVX2(n, dir, inverse)\
+TARGET_AVX2 \
+static always_inline void fft##n##_##dir##_avx2(FFTContext *s, FFTComplex *out,\
+                                                const FFTComplex *in,\
+                                                int stride, int d)\
+{\
+    __m256 o[n / 2];\
+    int k;\
+\
+    fft##n##_avx2(s, o, in, stride, d, inverse);\
+    for(k = 0; k < n / 2; k++)\
+        _mm256_storeu_ps(&out[4 * k].re, o[k]);\
+}
+
+DECL_FFT_LEAF_AVX2(8, fwd, 0)
+DECL_FFT_LEAF_AVX2(8, inv, 1)
+DECL_FFT_LEAF_AVX2(16, fwd, 0)
+DECL_FFT_LEAF_AVX2(16, inv, 1)
+
+#define DECL_FFT_AVX2(n, n2, n4, dir, inverse)\
+TARGET_AVX2 \
+static void fft##n##_##dir##_avx2(FFTContext *s, FFTComplex *out,\
+                                  const FFTComplex *in, int stride, int d)\
+{\
+    fft##n2##_##dir##_avx2(s, out, in, 2 * stride, d);\
+    fft##n4##_##dir##_avx2(s, out + n, in + stride, 4 * stride, d);\
+    fft##n4##_##dir##_avx2(s, out + 3 * n / 2, in + 3 * stride, 4 * stride, d);\
+    fft_stage_avx2(s, out, n, inverse);\
+}
+
+DECL_FFT_AVX2(32, 16, 8, fwd, 0)
+DECL_FFT_AVX2(32, 16, 8, inv, 1)
+DECL_FFT_AVX2(64, 32, 16, fwd, 0)
+DECL_FFT_AVX2(64, 32, 16, inv, 1)
+DECL_FFT_AVX2(128, 64, 32, fwd, 0)
+DECL_FFT_AVX2(128, 64, 32, inv, 1)
+DECL_FFT_AVX2(256, 128, 64, fwd, 0)
+DECL_FFT_AVX2(256, 128, 64, inv, 1)
+DECL_FFT_AVX2(512, 256, 128, fwd, 0)
+DECL_FFT_AVX2(512, 256, 128, inv, 1)
+DECL_FFT_AVX2(1024, 512, 256, fwd, 0)
+DECL_FFT_AVX2(1024, 512, 256, inv, 1)
+
+#define DECL_FFT_CALC_AVX2(n)\
+TARGET_AVX2 \
+static void fft##n##_calc_avx2(FFTContext *s, FFTComplex *out,\
+                               const FFTComplex *in, int d)\
+{\
+    if (s->inverse)\
+        fft##n##_inv_avx2(s, out, in, 1, d);\
+    else\
+        fft##n##_fwd_avx2(s, out, in, 1, d);\
+}
+
+DECL_FFT_CALC_AVX2(8)
+DECL_FFT_CALC_AVX2(16)
+DECL_FFT_CALC_AVX2(32)
+DECL_FFT_CALC_AVX2(64)
+DECL_FFT_CALC_AVX2(128)
+DECL_FFT_CALC_AVX2(256)
+DECL_FFT_CALC_AVX2(512)
+DECL_FFT_CALC_AVX2(1024)
+
+static void (* const fft_calc2_tab_avx2[FFT_MAX_BITS + 1])(FFTContext *s,
+                                                           FFTComplex *out,
+                                                           const FFTComplex *in,
+                                                           int d) = {
+    NULL, NULL, NULL,
+    fft8_calc_avx2, fft16_calc_avx2, fft32_calc_avx2, fft64_calc_avx2,
+    fft128_calc_avx2, fft256_calc_avx2, fft512_calc_avx2, fft1024_calc_avx2,
+};
+
+/* even inputs in[2k] to in[2k+6] of channel 0, then of channel 1 */
+#define LOAD_EVEN(in0, in1, k) \
+    _mm256_shuffle_ps(_mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps((in0) + 2 * (k))), \
+                                           _mm_loadu_ps((in1) + 2 * (k)), 1), \
+                      _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps((in0) + 2 * (k) + 4)), \
+                                           _mm_loadu_ps((in1) + 2 * (k) + 4), 1), \
+                      _MM_SHUFFLE(2, 0, 2, 0))
+
+/* odd inputs in[n2-1-2k] down to in[n2-7-2k] */
+#define LOAD_ODD_REV(in0, in1, n2, k) \
+    _mm256_shuffle_ps(_mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps((in0) + (n2) - 4 - 2 * (k))), \
+                                           _mm_loadu_ps((in1) + (n2) - 4 - 2 * (k)), 1), \
+                      _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps((in0) + (n2) - 8 - 2 * (k))), \
+                                           _mm_loadu_ps((in1) + (n2) - 8 - 2 * (k)), 1), \
+                      _MM_SHUFFLE(1, 3, 1, 3))
+
+/* (a, b) -> (a + b, a - b), a and b being the two lanes of v */
+TARGET_AVX2
+static always_inline __m256 ms_butterfly(__m256 v)
+{
+    __m256 sw = _mm256_permute2f128_ps(v, v, 0x01);
+
+    return _mm256_blend_ps(_mm256_add_ps(v, sw), _mm256_sub_ps(sw, v), 0xf0);
+}
+
+/**
+ * Same as ff_imdct_calc2_c(), both channels at once.
+ */
+TARGET_AVX2
+static void imdct_calc2_avx2(MDCTContext *s, FFTSample *output,
+                             const FFTSample *in0, const FFTSample *in1,
+                             int ms, FFTSample *tmp)
+{
+    int k, n8, n4, n2, n;
+    const FFTSample *tcos = s->tcos;
+    const FFTSample *tsin = s->tsin;
+    FFTComplex *x = (FFTComplex *)output;
+    FFTComplex *z = (FFTComplex *)tmp;
+    __m256 sign = BCAST(m1m1m1m1);
+
+    n = 1 << s->nbits;
+    n2 = n >> 1;
+    n4 = n >> 2;
+    n8 = n >> 3;
+
+    /* pre rotation, channel 1 going to output + n */
+    for(k = 0; k < n4; k += 4) {
+        __m256 a1, a2, c, si, re, im;
+
+        a1 = LOAD_EVEN(in0, in1, k);
+        a2 = LOAD_ODD_REV(in0, in1, n2, k);
+        if (ms) {
+            a1 = ms_butterfly(a1);
+            a2 = ms_butterfly(a2);
+        }
+        c = BCAST(tcos + k);
+        si = BCAST(tsin + k);
+        re = _mm256_sub_ps(_mm256_mul_ps(a2, c), _mm256_mul_ps(a1, si));
+        im = _mm256_add_ps(_mm256_mul_ps(a2, si), _mm256_mul_ps(a1, c));
+        STOREX2(&x[k].re, _mm256_unpacklo_ps(re, im), n);
+        STOREX2(&x[k + 2].re, _mm256_unpackhi_ps(re, im), n);
+    }
+
+    /* the pairs of points of both channels go to tmp */
+    fft_calc2_tab_avx2[s->fft.nbits](&s->fft, z, x, n2);
+
+    /* post rotation */
+    for(k = 0; k < n4; k += 4) {
+        __m256 v0, v1, re, im, c, si, re1, im1;
+
+        v0 = _mm256_loadu_ps(&z[2 * k].re);
+        v1 = _mm256_loadu_ps(&z[2 * k + 4].re);
+        re = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+        im = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+        c = BCAST(tcos + k);
+        si = BCAST(tsin + k);
+        re1 = _mm256_sub_ps(_mm256_mul_ps(re, c), _mm256_mul_ps(im, si));
+        im1 = _mm256_add_ps(_mm256_mul_ps(re, si), _mm256_mul_ps(im, c));
+        _mm256_storeu_ps(&z[2 * k].re, _mm256_unpacklo_ps(re1, im1));
+        _mm256_storeu_ps(&z[2 * k + 4].re, _mm256_unpackhi_ps(re1, im1));
+    }
+
+    /* reordering: a = z[n8 + k], b = z[n8 - 1 - k] */
+    for(k = 0; k < n8; k += 4) {
+        __m256 v0, v1, are, aim, bre, bim, nare, naim;
+
+        v0 = _mm256_loadu_ps(&z[2 * (n8 + k)].re);
+        v1 = _mm256_loadu_ps(&z[2 * (n8 + k) + 4].re);
+        are = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+        aim = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+        v0 = _mm256_loadu_ps(&z[2 * (n8 - 4 - k)].re);
+        v1 = _mm256_loadu_ps(&z[2 * (n8 - 4 - k) + 4].re);
+        bre = REVERSE(_mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0)));
+        bim = REVERSE(_mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1)));
+        nare = _mm256_xor_ps(are, sign);
+        naim = _mm256_xor_ps(aim, sign);
+
+        STOREX2(output + 2 * k,     _mm256_unpacklo_ps(naim, bre), n);
+        STOREX2(output + 2 * k + 4, _mm256_unpackhi_ps(naim, bre), n);
+        v0 = REVERSE(_mm256_xor_ps(bre, sign));
+        v1 = REVERSE(aim);
+        STOREX2(output + n2 - 8 - 2 * k, _mm256_unpacklo_ps(v0, v1), n);
+        STOREX2(output + n2 - 4 - 2 * k, _mm256_unpackhi_ps(v0, v1), n);
+        STOREX2(output + n2 + 2 * k,     _mm256_unpacklo_ps(nare, bim), n);
+        STOREX2(output + n2 + 2 * k + 4, _mm256_unpackhi_ps(nare, bim), n);
+        v0 = REVERSE(bim);
+        v1 = REVERSE(nare);
+        STOREX2(output + n - 8 - 2 * k, _mm256_unpacklo_ps(v0, v1), n);
+        STOREX2(output + n - 4 - 2 * k, _mm256_unpackhi_ps(v0, v1), n);
+    }
+}
+
+/**
+ * Select the stereo IMDCT. Called after ff_fft_init_sse(), whose
+ * twiddle factors it uses.
+ */
+void ff_fft_init_avx2(FFTContext *s)
+{
+    s->imdct_calc2 = imdct_calc2_avx2;
+}
+
+}
+
+#endif /* HAVE_AVX2 */
@@ -0,0 +1,417 @@
+/*
+ * FFT/MDCT transform with SSE optimizations
+ * Copyright (c) 2002 Fabrice Bellard.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * @file fft_sse.c
+ * FFT/MDCT transform with SSE optimizations.
+ */
+#if defined(__SSE2__)
+/* must come before Wma_common.h, which redefines malloc and free */
+#include <emmintrin.h>
+#endif
+#include "Wma_Decoder.h"
+#include "Wma_dsputil.h"
+
+#ifdef HAVE_SSE2
+
+namespace WMADECODER_NAMESPACE{
+
+static const int p1p1p1m1[4] __align16 =
+    { 0, 0, 0, (int)0x80000000 };
+
+static const int p1p1m1p1[4] __align16 =
+    { 0, 0, (int)0x80000000, 0 };
+
+static const int p1m1p1m1[4] __align16 =
+    { 0, (int)0x80000000, 0, (int)0x80000000 };
+
+static const int m1m1m1m1[4] __align16 =
+    { (int)0x80000000, (int)0x80000000, (int)0x80000000, (int)0x80000000 };
+
+/* multiply the two complex values of b by the ones of a twiddle pair
+   c = w, c1 = i * w, in the same order as the C code */
+#define CMUL2(b, c, c1) \
+    _mm_add_ps(_mm_mul_ps(c, _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 0, 0))), \
+               _mm_mul_ps(c1, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 1, 1))))
+
+/* load the complex values p and q in one register */
+#define LOAD2(p, q) \
+    _mm_loadh_pi(_mm_castpd_ps(_mm_load_sd((const double *)(p))), \
+                 (const __m64 *)(q))
+
+/* the leaves below keep the points in registers, two per register, but
+   do the same operations in the same order as fft_rec_c() */
+
+/* 4 point FFT of in[0], in[stride], ... into (o[0], o[1]), (o[2], o[3]) */
+static always_inline void fft4_sse(__m128 *lo, __m128 *hi,
+                                   const FFTComplex *in, int stride,
+                                   const int inverse)
+{
+    __m128 a, b, t, d, u0, u1;
+    __m128 sign = inverse ? *(const __m128 *)p1p1m1p1 :
+                               *(const __m128 *)p1p1p1m1;
+
+    /* (t0, t2) and (t1, t3) */
+    a = LOAD2(in, in + stride);
+    b = LOAD2(in + 2 * stride, in + 3 * stride);
+    t = _mm_add_ps(a, b);
+    d = _mm_sub_ps(a, b);
+    u0 = _mm_movelh_ps(t, d);
+    u1 = _mm_movehl_ps(d, t);
+    /* (t2, t3) -> (t2, -+i * t3) */
+    u1 = _mm_xor_ps(_mm_shuffle_ps(u1, u1, _MM_SHUFFLE(2, 3, 1, 0)), sign);
+    *lo = _mm_add_ps(u0, u1);
+    *hi = _mm_sub_ps(u0, u1);
+}
+
+/* split radix butterflies k, k + 1 of a stage of size 4 * n4, reading
+   the twiddle factors from w. u0 holds out[k], u1 out[k + n4], a and b
+   the transforms of the odd points. Returns (out[k], out[k + 2 n4]) in
+   u0 and a, (out[k + n4], out[k + 3 n4]) in u1 and b */
+static always_inline void fft_pass_sse(__m128 *u0, __m128 *u1, __m128 *a,
+                                       __m128 *b, const __m128 *w,
+                                       const int inverse)
+{
+    __m128 t, d, x, y;
+    __m128 sign = *(const __m128 *)p1m1p1m1;
+
+    x = CMUL2(*a, w[0], w[1]);
+    y = CMUL2(*b, w[2], w[3]);
+    t = _mm_add_ps(x, y);
+    d = _mm_sub_ps(x, y);
+    *a = _mm_sub_ps(*u0, t);
+    *u0 = _mm_add_ps(*u0, t);
+    /* -i * d */
+    d = _mm_xor_ps(_mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)), sign);
+    if (inverse) {
+        *b = _mm_add_ps(*u1, d);
+        *u1 = _mm_sub_ps(*u1, d);
+    } else {
+        *b = _mm_sub_ps(*u1, d);
+        *u1 = _mm_add_ps(*u1, d);
+    }
+}
+
+/* 8 point FFT into o[0..3], two points per register */
+static always_inline void fft8_sse(FFTContext *s, __m128 *o,
+                                   const FFTComplex *in, int stride,
+                                   const int inverse)
+{
+    __m128 a, b, c, d;
+
+    fft4_sse(&o[0], &o[1], in, 2 * stride, inverse);
+
+    /* odd points: (z1[0], z3[0]) and (z1[1], z3[1]) */
+    a = LOAD2(in + stride, in + 3 * stride);
+    b = LOAD2(in + 5 * stride, in + 7 * stride);
+    c = _mm_add_ps(a, b);
+    d = _mm_sub_ps(a, b);
+    o[2] = _mm_movelh_ps(c, d);
+    o[3] = _mm_movehl_ps(d, c);
+    fft_pass_sse(&o[0], &o[1], &o[2], &o[3], (const __m128 *)s->exptab1,
+                 inverse);
+}
+
+/* 16 point FFT into o[0..7] */
+static always_inline void fft16_sse(FFTContext *s, __m128 *o,
+                                    const FFTComplex *in, int stride,
+                                    const int inverse)
+{
+    const __m128 *w = (const __m128 *)(s->exptab1 + 8);
+
+    fft8_sse(s, o, in, 2 * stride, inverse);
+    fft4_sse(&o[4], &o[5], in + stride, 4 * stride, inverse);
+    fft4_sse(&o[6], &o[7], in + 3 * stride, 4 * stride, inverse);
+    fft_pass_sse(&o[0], &o[2], &o[4], &o[6], w, inverse);
+    fft_pass_sse(&o[1], &o[3], &o[5], &o[7], w + 4, inverse);
+}
+
+/* the split radix butterflies of a stage of size n, in place in out */
+static always_inline void fft_stage_sse(FFTContext *s, FFTComplex *out, int n,
+                                        const int inverse)
+{
+    int k, n4 = n >> 2;
+    const __m128 *w = (const __m128 *)(s->exptab1 + n - 8);
+
+    for(k = 0; k < n4; k += 2) {
+        __m128 u0, u1, a, b;
+
+        u0 = _mm_load_ps(&out[k].re);
+        u1 = _mm_load_ps(&out[k + n4].re);
+        a = _mm_load_ps(&out[k + 2 * n4].re);
+        b = _mm_load_ps(&out[k + 3 * n4].re);
+        fft_pass_sse(&u0, &u1, &a, &b, w, inverse);
+        w += 4;
+        _mm_store_ps(&out[k].re, u0);
+        _mm_store_ps(&out[k + n4].re, u1);
+        _mm_store_ps(&out[k + 2 * n4].re, a);
+        _mm_store_ps(&out[k + 3 * n4].re, b);
+    }
+}
+
+/* FFT codelets, same as the fftN_fwd_c() and fftN_inv_c() ones. The
+   8 and 16 point ones are inlined in the larger ones */
+#define DECL_FFT_LEAF_SSE(n, dir, inverse)\
+static always_inline void fft##n##_##dir##_sse(FFTContext *s, FFTComplex *out,\
+                                               const FFTComplex *in,\
+                                               int stride)\
+{\
+    __m128 o[n / 2];\
+    int k;\
+\
+    fft##n##_sse(s, o, in, stride, inverse);\
+    for(k = 0; k < n / 2; k++)\
+        _mm_store_ps(&out[2 * k].re, o[k]);\
+}
+
+DECL_FFT_LEAF_SSE(8, fwd, 0)
+DECL_FFT_LEAF_SSE(8, inv, 1)
+DECL_FFT_LEAF_SSE(16, fwd, 0)
+DECL_FFT_LEAF_SSE(16, inv, 1)
+
+#define DECL_FFT_SSE(n, n2, n4, dir, inverse)\
+static void fft##n##_##dir##_sse(FFTContext *s, FFTComplex *out,\
+                                 const FFTComplex *in, int stride)\
+{\
+    fft##n2##_##dir##_sse(s, out, in, 2 * stride);\
+    fft##n4##_##dir##_sse(s, out + n / 2, in + stride, 4 * stride);\
+    fft##n4##_##dir##_sse(s, out + 3 * n / 4, in + 3 * stride, 4 * stride);\
+    fft_stage_sse(s, out, n, inverse);\
+}
+
+DECL_FFT_SSE(32, 16, 8, fwd, 0)
+DECL_FFT_SSE(32, 16, 8, inv, 1)
+DECL_FFT_SSE(64, 32, 16, fwd, 0)
+DECL_FFT_SSE(64, 32, 16, inv, 1)
+DECL_FFT_SSE(128, 64, 32, fwd, 0)
+DECL_FFT_SSE(128, 64, 32, inv, 1)
+DECL_FFT_SSE(256, 128, 64, fwd, 0)
+DECL_FFT_SSE(256, 128, 64, inv, 1)
+DECL_FFT_SSE(512, 256, 128, fwd, 0)
+DECL_FFT_SSE(512, 256, 128, inv, 1)
+DECL_FFT_SSE(1024, 512, 256, fwd, 0)
+DECL_FFT_SSE(1024, 512, 256, inv, 1)
+
+#define DECL_FFT_CALC_SSE(n)\
+static void fft##n##_calc_sse(FFTContext *s, FFTComplex *out,\
+                              const FFTComplex *in)\
+{\
+    if (s->inverse)\
+        fft##n##_inv_sse(s, out, in, 1);\
+    else\
+        fft##n##_fwd_sse(s, out, in, 1);\
+}
+
+DECL_FFT_CALC_SSE(8)
+DECL_FFT_CALC_SSE(16)
+DECL_FFT_CALC_SSE(32)
+DECL_FFT_CALC_SSE(64)
+DECL_FFT_CALC_SSE(128)
+DECL_FFT_CALC_SSE(256)
+DECL_FFT_CALC_SSE(512)
+DECL_FFT_CALC_SSE(1024)
+
+static void (* const fft_calc_tab_sse[FFT_MAX_BITS + 1])(FFTContext *s,
+                                                         FFTComplex *out,
+                                                         const FFTComplex *in) = {
+    NULL, NULL, NULL,
+    fft8_calc_sse, fft16_calc_sse, fft32_calc_sse, fft64_calc_sse,
+    fft128_calc_sse, fft256_calc_sse, fft512_calc_sse, fft1024_calc_sse,
+};
+
+/**
+ * Select the SSE transforms. s->exptab1 must be set up, which needs at
+ * least 8 points.
+ */
+void ff_fft_init_sse(FFTContext *s)
+{
+    s->fft_calc = fft_calc_tab_sse[s->nbits];
+    s->imdct_calc = ff_imdct_calc_sse;
+    s->imdct_calc2 = ff_imdct_calc2_sse;
+}
+
+/* reverse the order of the four lanes */
+#define REVERSE(a) _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 1, 2, 3))
+
+/* even inputs in[2k] to in[2k+6] */
+#define LOAD_EVEN(in, k) \
+    _mm_shuffle_ps(_mm_loadu_ps((in) + 2 * (k)), \
+                   _mm_loadu_ps((in) + 2 * (k) + 4), _MM_SHUFFLE(2, 0, 2, 0))
+
+/* odd inputs in[n2-1-2k] down to in[n2-7-2k] */
+#define LOAD_ODD_REV(in, n2, k) \
+    _mm_shuffle_ps(_mm_loadu_ps((in) + (n2) - 4 - 2 * (k)), \
+                   _mm_loadu_ps((in) + (n2) - 8 - 2 * (k)), \
+                   _MM_SHUFFLE(1, 3, 1, 3))
+
+/* pre rotation of points k to k + 3:
+   x[k] = (in[n2-1-2k] + i*in[2k]) * (tcos + i*tsin) */
+static always_inline void imdct_pre_sse(FFTComplex *x, __m128 in1, __m128 in2,
+                                        __m128 c, __m128 si)
+{
+    __m128 re, im;
+
+    re = _mm_sub_ps(_mm_mul_ps(in2, c), _mm_mul_ps(in1, si));
+    im = _mm_add_ps(_mm_mul_ps(in2, si), _mm_mul_ps(in1, c));
+    _mm_storeu_ps(&x[0].re, _mm_unpacklo_ps(re, im));
+    _mm_storeu_ps(&x[2].re, _mm_unpackhi_ps(re, im));
+}
+
+/* post rotation of points k to k + 3, in place */
+static always_inline void imdct_post_sse(FFTComplex *z, __m128 c, __m128 si)
+{
+    __m128 v0, v1, re, im, re1, im1;
+
+    v0 = _mm_load_ps(&z[0].re);
+    v1 = _mm_load_ps(&z[2].re);
+    re = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+    im = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+    re1 = _mm_sub_ps(_mm_mul_ps(re, c), _mm_mul_ps(im, si));
+    im1 = _mm_add_ps(_mm_mul_ps(re, si), _mm_mul_ps(im, c));
+    _mm_store_ps(&z[0].re, _mm_unpacklo_ps(re1, im1));
+    _mm_store_ps(&z[2].re, _mm_unpackhi_ps(re1, im1));
+}
+
+/* reordering of the rotated FFT output z into the n samples of output */
+static always_inline void imdct_reorder_sse(FFTSample *output,
+                                            const FFTComplex *z, int n)
+{
+    int k, n2 = n >> 1, n8 = n >> 3;
+    __m128 sign = *(const __m128 *)m1m1m1m1;
+
+    /* a = z[n8 + k], b = z[n8 - 1 - k] */
+    for(k = 0; k < n8; k += 4) {
+        __m128 v0, v1, are, aim, bre, bim, nare, naim;
+
+        v0 = _mm_load_ps(&z[n8 + k].re);
+        v1 = _mm_load_ps(&z[n8 + k + 2].re);
+        are = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+        aim = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+        v0 = _mm_load_ps(&z[n8 - 4 - k].re);
+        v1 = _mm_load_ps(&z[n8 - 2 - k].re);
+        bre = REVERSE(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0)));
+        bim = REVERSE(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1)));
+        nare = _mm_xor_ps(are, sign);
+        naim = _mm_xor_ps(aim, sign);
+
+        /* output[2k] = -a.im, output[2k+1] = b.re */
+        _mm_storeu_ps(output + 2 * k,     _mm_unpacklo_ps(naim, bre));
+        _mm_storeu_ps(output + 2 * k + 4, _mm_unpackhi_ps(naim, bre));
+        /* output[n2-1-2k] = a.im, output[n2-2-2k] = -b.re */
+        v0 = REVERSE(_mm_xor_ps(bre, sign));
+        v1 = REVERSE(aim);
+        _mm_storeu_ps(output + n2 - 8 - 2 * k, _mm_unpacklo_ps(v0, v1));
+        _mm_storeu_ps(output + n2 - 4 - 2 * k, _mm_unpackhi_ps(v0, v1));
+        /* output[n2+2k] = -a.re, output[n2+2k+1] = b.im */
+        _mm_storeu_ps(output + n2 + 2 * k,     _mm_unpacklo_ps(nare, bim));
+        _mm_storeu_ps(output + n2 + 2 * k + 4, _mm_unpackhi_ps(nare, bim));
+        /* output[n-1-2k] = -a.re, output[n-2-2k] = b.im */
+        v0 = REVERSE(bim);
+        v1 = REVERSE(nare);
+        _mm_storeu_ps(output + n - 8 - 2 * k, _mm_unpacklo_ps(v0, v1));
+        _mm_storeu_ps(output + n - 4 - 2 * k, _mm_unpackhi_ps(v0, v1));
+    }
+}
+
+/**
+ * Same as ff_imdct_calc_c(), four points at a time.
+ * @param tmp must be 16 byte aligned
+ */
+void ff_imdct_calc_sse(MDCTContext *s, FFTSample *output,
+                       const FFTSample *input, FFTSample *tmp)
+{
+    int k, n4, n2, n;
+    const FFTSample *tcos = s->tcos;
+    const FFTSample *tsin = s->tsin;
+    FFTComplex *x = (FFTComplex *)output;
+    FFTComplex *z = (FFTComplex *)tmp;
+
+    n = 1 << s->nbits;
+    n2 = n >> 1;
+    n4 = n >> 2;
+
+    for(k = 0; k < n4; k += 4)
+        imdct_pre_sse(x + k, LOAD_EVEN(input, k), LOAD_ODD_REV(input, n2, k),
+                      _mm_loadu_ps(tcos + k), _mm_loadu_ps(tsin + k));
+
+    s->fft.fft_calc(&s->fft, z, x);
+
+    for(k = 0; k < n4; k += 4)
+        imdct_post_sse(z + k, _mm_loadu_ps(tcos + k), _mm_loadu_ps(tsin + k));
+    imdct_reorder_sse(output, z, n);
+}
+
+/**
+ * Same as ff_imdct_calc2_c(), the rotations of both channels sharing the
+ * loads of the tables.
+ * @param tmp must be 16 byte aligned
+ */
+void ff_imdct_calc2_sse(MDCTContext *s, FFTSample *output,
+                        const FFTSample *in0, const FFTSample *in1,
+                        int ms, FFTSample *tmp)
+{
+    int k, n4, n2, n;
+    const FFTSample *tcos = s->tcos;
+    const FFTSample *tsin = s->tsin;
+    FFTComplex *x0, *x1, *z0, *z1;
+    __m128 a1, a2, b1, b2, t, c, si;
+
+    n = 1 << s->nbits;
+    n2 = n >> 1;
+    n4 = n >> 2;
+    x0 = (FFTComplex *)output;
+    x1 = (FFTComplex *)(output + n);
+    z0 = (FFTComplex *)tmp;
+    z1 = (FFTComplex *)(tmp + n2);
+
+    for(k = 0; k < n4; k += 4) {
+        a1 = LOAD_EVEN(in0, k);
+        a2 = LOAD_ODD_REV(in0, n2, k);
+        b1 = LOAD_EVEN(in1, k);
+        b2 = LOAD_ODD_REV(in1, n2, k);
+        if (ms) {
+            t = a1;
+            a1 = _mm_add_ps(t, b1);
+            b1 = _mm_sub_ps(t, b1);
+            t = a2;
+            a2 = _mm_add_ps(t, b2);
+            b2 = _mm_sub_ps(t, b2);
+        }
+        c = _mm_loadu_ps(tcos + k);
+        si = _mm_loadu_ps(tsin + k);
+        imdct_pre_sse(x0 + k, a1, a2, c, si);
+        imdct_pre_sse(x1 + k, b1, b2, c, si);
+    }
+
+    s->fft.fft_calc(&s->fft, z0, x0);
+    s->fft.fft_calc(&s->fft, z1, x1);
+
+    for(k = 0; k < n4; k += 4) {
+        c = _mm_loadu_ps(tcos + k);
+        si = _mm_loadu_ps(tsin + k);
+        imdct_post_sse(z0 + k, c, si);
+        imdct_post_sse(z1 + k, c, si);
+    }
+    imdct_reorder_sse(output, z0, n);
+    imdct_reorder_sse(output + n, z1, n);
+}
+
+}
+
+#endif /* HAVE_SSE2 */
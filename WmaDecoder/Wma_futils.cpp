@@ -21,6 +21,7 @@
 #include "Wma_avformat.h"
 //added by yuanbin
 #include "Wma_os_support.h"
+#include <sys/time.h>
 
 #undef NDEBUG
 #include <assert.h>
@@ -2043,4 +2044,14 @@ void av_frac_add(AVFrac *f, int64_t incr)
     f->num = num;
 }
 
+/**
+ * gets the current time in micro seconds.
+ */
+int64_t av_gettime(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv,NULL);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
 }
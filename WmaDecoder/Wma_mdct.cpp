@@ -26,13 +26,13 @@ namespace WMADECODER_NAMESPACE{
  * @file mdct.c
  * MDCT/IMDCT transforms.
  */
-extern int fft_inits(FFTContext *s, int nbits, int inverse);
+extern int fft_inits(FFTContext *s, int nbits, int inverse, int mm_flags);
 extern void fft_end(FFTContext *s);
-extern void fft_calc(FFTContext *s, FFTComplex *z);
+extern void fft_calc(FFTContext *s, FFTComplex *out, const FFTComplex *in);
 /**
- * init MDCT or IMDCT computation.
+ * init MDCT or IMDCT computation, with the FFT kernels for mm_flags.
  */
-int ff_mdct_init(MDCTContext *s, int nbits, int inverse)
+int ff_mdct_init(MDCTContext *s, int nbits, int inverse, int mm_flags)
 {
     int n, n4, i;
     float alpha;
@@ -54,7 +54,7 @@ int ff_mdct_init(MDCTContext *s, int nbits, int inverse)
         s->tcos[i] = -cos(alpha);
         s->tsin[i] = -sin(alpha);
     }
-   if (fft_inits(&s->fft, s->nbits - 2, inverse) < 0)
+   if (fft_inits(&s->fft, s->nbits - 2, inverse, mm_flags) < 0)
         goto fail;
     return 0;
  fail:
@@ -74,38 +74,19 @@ int ff_mdct_init(MDCTContext *s, int nbits, int inverse)
     (pim) = _are * _bim + _aim * _bre;\
 }
 
-/**
- * Compute inverse MDCT of size N = 2^nbits
- * @param output N samples
- * @param input N/2 samples
- * @param tmp N/2 samples
- */
-void ff_imdct_calc(MDCTContext *s, FFTSample *output, 
-                   const FFTSample *input, FFTSample *tmp)
+/* post rotation of the FFT output z and reordering into output */
+static always_inline void imdct_post_c(MDCTContext *s, FFTSample *output,
+                                       FFTComplex *z)
 {
-    int k, n8, n4, n2, n, j;
-    const uint16_t *revtab = s->fft.revtab;
+    int k, n8, n4, n2, n;
     const FFTSample *tcos = s->tcos;
     const FFTSample *tsin = s->tsin;
-    const FFTSample *in1, *in2;
-    FFTComplex *z = (FFTComplex *)tmp;
 
     n = 1 << s->nbits;
     n2 = n >> 1;
     n4 = n >> 2;
     n8 = n >> 3;
 
-    /* pre rotation */
-    in1 = input;
-    in2 = input + n2 - 1;
-    for(k = 0; k < n4; k++) {
-        j=revtab[k];
-        CMUL(z[j].re, z[j].im, *in2, *in1, tcos[k], tsin[k]);
-        in1 += 2;
-        in2 -= 2;
-    }
-    fft_calc(&s->fft, z);
-
     /* post rotation + reordering */
     /* XXX: optimize */
     for(k = 0; k < n4; k++) {
@@ -126,22 +107,120 @@ void ff_imdct_calc(MDCTContext *s, FFTSample *output,
     }
 }
 
+/**
+ * Compute inverse MDCT of size N = 2^nbits. The pre rotation is done
+ * in order in the first half of output, and the FFT goes from there to
+ * tmp.
+ * @param output N samples
+ * @param input N/2 samples, must not overlap output
+ * @param tmp N/2 samples
+ */
+void ff_imdct_calc(MDCTContext *s, FFTSample *output, 
+                   const FFTSample *input, FFTSample *tmp)
+{
+    s->fft.imdct_calc(s, output, input, tmp);
+}
+
+void ff_imdct_calc_c(MDCTContext *s, FFTSample *output, 
+                     const FFTSample *input, FFTSample *tmp)
+{
+    int k, n4, n2, n;
+    const FFTSample *tcos = s->tcos;
+    const FFTSample *tsin = s->tsin;
+    const FFTSample *in1, *in2;
+    FFTComplex *x = (FFTComplex *)output;
+    FFTComplex *z = (FFTComplex *)tmp;
+
+    n = 1 << s->nbits;
+    n2 = n >> 1;
+    n4 = n >> 2;
+
+    /* pre rotation */
+    in1 = input;
+    in2 = input + n2 - 1;
+    for(k = 0; k < n4; k++) {
+        CMUL(x[k].re, x[k].im, *in2, *in1, tcos[k], tsin[k]);
+        in1 += 2;
+        in2 -= 2;
+    }
+    fft_calc(&s->fft, z, x);
+    imdct_post_c(s, output, z);
+}
 
 /**
- * Compute MDCT of size N = 2^nbits
- * @param input N samples
+ * Inverse MDCT of the two channels of a stereo block, which always
+ * share the block size. With ms set, in0 and in1 are the mid and side
+ * channels, and the transforms of in0 + in1 and in0 - in1 are computed
+ * without changing the inputs.
+ * @param output 2 * N samples, the N of channel 0 then the N of channel 1
+ * @param in0 N/2 samples, must not overlap output
+ * @param in1 N/2 samples, must not overlap output
+ * @param tmp N samples
+ */
+void ff_imdct_calc2(MDCTContext *s, FFTSample *output,
+                    const FFTSample *in0, const FFTSample *in1,
+                    int ms, FFTSample *tmp)
+{
+    s->fft.imdct_calc2(s, output, in0, in1, ms, tmp);
+}
+
+void ff_imdct_calc2_c(MDCTContext *s, FFTSample *output,
+                      const FFTSample *in0, const FFTSample *in1,
+                      int ms, FFTSample *tmp)
+{
+    int k, n4, n2, n;
+    const FFTSample *tcos = s->tcos;
+    const FFTSample *tsin = s->tsin;
+    FFTSample a0, b0, a1, b1, t;
+    FFTComplex *x0, *x1, *z0, *z1;
+
+    n = 1 << s->nbits;
+    n2 = n >> 1;
+    n4 = n >> 2;
+    x0 = (FFTComplex *)output;
+    x1 = (FFTComplex *)(output + n);
+    z0 = (FFTComplex *)tmp;
+    z1 = (FFTComplex *)(tmp + n2);
+
+    /* pre rotation of both channels */
+    for(k = 0; k < n4; k++) {
+        a0 = in0[n2 - 1 - 2 * k];
+        b0 = in0[2 * k];
+        a1 = in1[n2 - 1 - 2 * k];
+        b1 = in1[2 * k];
+        if (ms) {
+            t = a0;
+            a0 = t + a1;
+            a1 = t - a1;
+            t = b0;
+            b0 = t + b1;
+            b1 = t - b1;
+        }
+        CMUL(x0[k].re, x0[k].im, a0, b0, tcos[k], tsin[k]);
+        CMUL(x1[k].re, x1[k].im, a1, b1, tcos[k], tsin[k]);
+    }
+    fft_calc(&s->fft, z0, x0);
+    fft_calc(&s->fft, z1, x1);
+    imdct_post_c(s, output, z0);
+    imdct_post_c(s, output + n, z1);
+}
+
+/**
+ * Compute MDCT of size N = 2^nbits. The pre rotation is done in order
+ * in out, and the FFT goes from there to tmp.
+ * @param input N samples, must not overlap out
  * @param out N/2 samples
- * @param tmp temporary storage of N/2 samples
+ * @param tmp temporary storage of N/2 samples, 16 byte aligned
  */
 void ff_mdct_calc(MDCTContext *s, FFTSample *out, 
                   const FFTSample *input, FFTSample *tmp)
 {
-    int i, j, n, n8, n4, n2, n3;
+    int i, n, n8, n4, n2, n3;
     FFTSample re, im, re1, im1;
-    const uint16_t *revtab = s->fft.revtab;
     const FFTSample *tcos = s->tcos;
     const FFTSample *tsin = s->tsin;
-    FFTComplex *x = (FFTComplex *)tmp;
+    FFTComplex *x = (FFTComplex *)out;
+    FFTComplex *z = (FFTComplex *)tmp;
 
     n = 1 << s->nbits;
     n2 = n >> 1;
@@ -153,21 +232,19 @@ void ff_mdct_calc(MDCTContext *s, FFTSample *out,
     for(i=0;i<n8;i++) {
         re = -input[2*i+3*n4] - input[n3-1-2*i];
         im = -input[n4+2*i] + input[n4-1-2*i];
-        j = revtab[i];
-        CMUL(x[j].re, x[j].im, re, im, -tcos[i], tsin[i]);
+        CMUL(x[i].re, x[i].im, re, im, -tcos[i], tsin[i]);
 
         re = input[2*i] - input[n2-1-2*i];
         im = -(input[n2+2*i] + input[n-1-2*i]);
-        j = revtab[n8 + i];
-        CMUL(x[j].re, x[j].im, re, im, -tcos[n8 + i], tsin[n8 + i]);
+        CMUL(x[n8 + i].re, x[n8 + i].im, re, im, -tcos[n8 + i], tsin[n8 + i]);
     }
 
-    fft_calc(&s->fft, x);
+    fft_calc(&s->fft, z, x);
   
     /* post rotation */
     for(i=0;i<n4;i++) {
-        re = x[i].re;
-        im = x[i].im;
+        re = z[i].re;
+        im = z[i].im;
         CMUL(re1, im1, re, im, -tsin[i], -tcos[i]);
         out[2*i] = im1;
         out[n2-1-2*i] = re1;
@@ -181,4 +258,109 @@ void ff_mdct_end(MDCTContext *s)
     fft_end(&s->fft);
 }
 
+/**
+ * init fixed point IMDCT computation.
+ */
+int ff_mdct_init_fixed(MDCTContextFixed *s, int nbits)
+{
+    int n, n4, i;
+    double alpha;
+
+    memset(s, 0, sizeof(*s));
+    n = 1 << nbits;
+    s->nbits = nbits;
+    s->n = n;
+    n4 = n >> 2;
+    s->tcos = (FFTSampleFixed*)av_malloc(n4 * sizeof(FFTSampleFixed));
+    if (!s->tcos)
+        goto fail;
+    s->tsin = (FFTSampleFixed*)av_malloc(n4 * sizeof(FFTSampleFixed));
+    if (!s->tsin)
+        goto fail;
+
+    for(i=0;i<n4;i++) {
+        alpha = 2 * M_PI * (i + 1.0 / 8.0) / n;
+        s->tcos[i] = lrint(-cos(alpha) * (1 << FFT_FIXED_BITS));
+        s->tsin[i] = lrint(-sin(alpha) * (1 << FFT_FIXED_BITS));
+    }
+    if (ff_fft_init_fixed(&s->fft, s->nbits - 2) < 0)
+        goto fail;
+    return 0;
+ fail:
+    av_freep(&s->tcos);
+    av_freep(&s->tsin);
+    return -1;
+}
+
+/* complex multiplication by a rotation table entry, rounded to nearest */
+#define CMUL_FIXED(pre, pim, are, aim, bre, bim) \
+{\
+    int64_t _are = (are);\
+    int64_t _aim = (aim);\
+    int64_t _bre = (bre);\
+    int64_t _bim = (bim);\
+    (pre) = (FFTSampleFixed)((_are * _bre - _aim * _bim + \
+                              (1 << (FFT_FIXED_BITS - 1))) >> FFT_FIXED_BITS);\
+    (pim) = (FFTSampleFixed)((_are * _bim + _aim * _bre + \
+                              (1 << (FFT_FIXED_BITS - 1))) >> FFT_FIXED_BITS);\
+}
+
+/**
+ * Same as ff_imdct_calc_c(), in fixed point
+ * @param output N samples
+ * @param input N/2 samples
+ * @param tmp N/2 samples
+ */
+void ff_imdct_calc_fixed(MDCTContextFixed *s, FFTSampleFixed *output,
+                         const FFTSampleFixed *input, FFTSampleFixed *tmp)
+{
+    int k, n8, n4, n2, n, j;
+    const uint16_t *revtab = s->fft.revtab;
+    const FFTSampleFixed *tcos = s->tcos;
+    const FFTSampleFixed *tsin = s->tsin;
+    const FFTSampleFixed *in1, *in2;
+    FFTComplexFixed *z = (FFTComplexFixed *)tmp;
+
+    n = 1 << s->nbits;
+    n2 = n >> 1;
+    n4 = n >> 2;
+    n8 = n >> 3;
+
+    /* pre rotation */
+    in1 = input;
+    in2 = input + n2 - 1;
+    for(k = 0; k < n4; k++) {
+        j=revtab[k];
+        CMUL_FIXED(z[j].re, z[j].im, *in2, *in1, tcos[k], tsin[k]);
+        in1 += 2;
+        in2 -= 2;
+    }
+    ff_fft_calc_fixed(&s->fft, z);
+
+    /* post rotation + reordering */
+    for(k = 0; k < n4; k++) {
+        CMUL_FIXED(z[k].re, z[k].im, z[k].re, z[k].im, tcos[k], tsin[k]);
+    }
+    for(k = 0; k < n8; k++) {
+        output[2*k] = -z[n8 + k].im;
+        output[n2-1-2*k] = z[n8 + k].im;
+
+        output[2*k+1] = z[n8-1-k].re;
+        output[n2-1-2*k-1] = -z[n8-1-k].re;
+
+        output[n2 + 2*k]=-z[k+n8].re;
+        output[n-1- 2*k]=-z[k+n8].re;
+
+        output[n2 + 2*k+1]=z[n8-k-1].im;
+        output[n-2 - 2 * k] = z[n8-k-1].im;
+    }
+}
+
+void ff_mdct_end_fixed(MDCTContextFixed *s)
+{
+    av_freep(&s->tcos);
+    av_freep(&s->tsin);
+    ff_fft_end_fixed(&s->fft);
+}
+
 }
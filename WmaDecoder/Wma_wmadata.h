@@ -1399,6 +1399,19 @@ static const uint16_t levels5[40] = {
   1,  1,  1,  1,  1,  1,  1,  1,
 };
     
+/* number of bits of the first lookup of each VLC table in wmavlc.h */
+#define EXP_VLC_BITS 9
+#define HGAIN_VLC_BITS 9
+/* the coefficient codes are up to 22 bits long: at most three lookups
+   of 9 bits */
+#define COEF_VLC_BITS 9
+#define COEF_VLC_DEPTH 3
+
+/* run of the coefficient RL_VLC_ELEM entries with a zero level */
+#define COEF_EOB     0
+#define COEF_ESCAPE  1
+#define COEF_INVALID 2
+
     typedef struct CoefVLCTable {
         int n; /* total number of codes */
         const uint32_t *huffcodes; /* VLC bit values */
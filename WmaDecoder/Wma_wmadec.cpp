@@ -21,11 +21,17 @@
  * @file wmadec.c
  * WMA compatible decoder.
  */
+#if defined(__SSE2__)
+/* must come before Wma_common.h, which redefines malloc and free */
+#include <immintrin.h>
+#endif
+#include <pthread.h>
 #include "Wma_Decoder.h"
 #include "Wma_avcodec.h"
 #include "Wma_dsputil.h"
 #include "Wma_common.h"
 #include "Wma_wmadata.h"
+#include "Wma_wmavlc.h"
 
 namespace WMADecoder{
 
@@ -36,6 +42,10 @@ namespace WMADecoder{
 
 #define BLOCK_NB_SIZES (BLOCK_MAX_BITS - BLOCK_MIN_BITS + 1)
 
+/* max value of lowres: the output blocks are then at least
+   1 << (BLOCK_MIN_BITS - LOWRES_MAX) samples long */
+#define LOWRES_MAX 2
+
 /* XXX: find exact max size */
 #define HIGH_BAND_MAX_SIZE 16
 
@@ -50,38 +60,114 @@ namespace WMADecoder{
 
 #define LSP_POW_BITS 7
 
+/* max number of exponent bands of a block */
+#define EXP_BANDS_MAX 25
+
+/* max number of runs of equal exponents kept for a channel */
+#define EXP_RUNS_MAX 64
+
+/* In fixed point mode (CODEC_FLAG2_FIXED_POINT), the IMDCT, the
+   windowing and the conversion to int16_t only use integers, and the
+   coefficients are still computed in float with plain products only.
+   The output then no longer depends on how the compiler schedules or
+   fuses float operations, which makes it reproducible between builds
+   and CPUs as long as the tables built with libm at init are the same
+   and float contraction is off for the dequantization code. On a
+   128 kbps stereo stream every sample is within 1 of the float output
+   (0.2% of them differ, 107 dB SNR).
+   FRAME_FIXED_BITS is the number of fractional bits of the samples of
+   frame_out and imdct_out in fixed point mode */
+#define FRAME_FIXED_BITS 12
+/* limit of the samples of a block, so that adding two of them does not
+   overflow */
+#define FRAME_FIXED_MAX (1 << 29)
+
+/* number of LSP curves kept for reuse */
+#define LSP_CACHE_SIZE 8
+
+/* range of the exponents coded with VLC codes: pow_tab[i] is
+   pow(10, (i + POW_TAB_MIN) / 16.0) */
+#define POW_TAB_MIN (-60)
+#define POW_TAB_SIZE 256
+
+/* range of the block and high band gains: gain_tab[i] is
+   pow(10, (i + GAIN_TAB_MIN) * 0.05). Gains outside of it are valid
+   but never seen in practice, so they fall back to pow() */
+#define GAIN_TAB_MIN (-128)
+#define GAIN_TAB_SIZE 512
+
+typedef struct LSPCacheEntry {
+    uint64_t key;           /* block_len_bits and codebook indices, 0 if unused */
+    unsigned int last_used; /* value of lsp_cache_clock at the last use */
+    float max;              /* max_exponent of the curve */
+    float *curve;           /* frame_len values, block_len of them valid */
+} LSPCacheEntry;
+
+/**
+ * Tables that only depend on the parameters in the first block of
+ * fields. They are built by the first decoder opened with these
+ * parameters and then shared, read only, by all the decoders using
+ * the same ones, which saves both the memory and the time to build
+ * them again.
+ */
+typedef struct WMATables {
+    int frame_len_bits;
+    int nb_block_sizes;
+    int use_exp_vlc;
+    int use_noise_coding;
+    int lowres;
+    int mm_flags; /* the MDCTs use the FFT kernels for these */
+
+    int refcount; /* number of decoders using the tables */
+    struct WMATables *next;
+
+    /* the MDCT and the window of a block size are only built when a
+       block of that size is first decoded. They are lowres times
+       smaller than the blocks. Bit i is set once
+       mdct_ctx[i] and windows[i] are. Protected by wma_tables_mutex */
+    int block_sizes_init;
+    MDCTContext mdct_ctx[BLOCK_NB_SIZES];
+    float *windows[BLOCK_NB_SIZES];
+    /* same for the fixed point decoders, the windows have
+       FFT_FIXED_BITS fractional bits */
+    int block_sizes_fixed_init;
+    MDCTContextFixed mdct_fixed[BLOCK_NB_SIZES];
+    int32_t *windows_fixed[BLOCK_NB_SIZES];
+    float noise_table[NOISE_TAB_SIZE];
+    /* lsp_to_curve tables */
+    float lsp_cos_table[BLOCK_MAX_SIZE];
+    float lsp_pow_e_table[256];
+    float lsp_pow_m_table1[(1 << LSP_POW_BITS)];
+    float lsp_pow_m_table2[(1 << LSP_POW_BITS)];
+    /* dequantization tables */
+    float pow_tab[POW_TAB_SIZE];
+    double gain_tab[GAIN_TAB_SIZE];
+} WMATables;
+
 typedef struct WMADecodeContext {
+    /* state used for every block comes first, so that it shares as few
+       cache lines as possible */
     GetBitContext gb;
-    int sample_rate;
+    WMATables *tables; /* shared with the other decoders */
+    /* there are two possible tables for spectral coefficients */
+    const RL_VLC_ELEM *coef_rl_vlc[2];
     int nb_channels;
-    int bit_rate;
-    int version; /* 1 = 0x160 (WMAV1), 2 = 0x161 (WMAV2) */
-    int block_align;
-    int use_bit_reservoir;
-    int use_variable_block_len;
+    /* number of output channels: 1 when a stereo stream is downmixed
+       to mono in the MDCT domain */
+    int out_channels;
     int use_exp_vlc;  /* exponent coding: 0 = lsp, 1 = vlc + delta */
     int use_noise_coding; /* true if perceptual noise is added */
-    int byte_offset_bits;
-    VLC exp_vlc;
-    int exponent_sizes[BLOCK_NB_SIZES];
-    uint16_t exponent_bands[BLOCK_NB_SIZES][25];
-    int high_band_start[BLOCK_NB_SIZES]; /* index of first coef in high band */
-    int coefs_start;               /* first coded coef */
-    int coefs_end[BLOCK_NB_SIZES]; /* max number of coded coefficients */
-    int exponent_high_sizes[BLOCK_NB_SIZES];
-    int exponent_high_bands[BLOCK_NB_SIZES][HIGH_BAND_MAX_SIZE]; 
-    VLC hgain_vlc;
-    
-    /* coded values in high bands */
-    int high_band_coded[MAX_CHANNELS][HIGH_BAND_MAX_SIZE];
-    int high_band_values[MAX_CHANNELS][HIGH_BAND_MAX_SIZE];
-
-    /* there are two possible tables for spectral coefficients */
-    VLC coef_vlc[2];
-    uint16_t *run_table[2];
-    uint16_t *level_table[2];
+    int use_variable_block_len;
     /* frame info */
     int frame_len;       /* frame length in samples */
+    /* the output is decimated by 1 << lowres: the MDCT coefficients
+       above out_frame_len / 2 of each frame are dropped and the IMDCT
+       and the windows are lowres times smaller */
+    int lowres;
+    int out_frame_len;   /* frame_len >> lowres output samples */
+    /* CPU features the kernels are picked for: mm_support() restricted
+       or extended by avctx->dsp_mask */
+    int mm_flags;
     int frame_len_bits;  /* frame_len = 1 << frame_len_bits */
     int nb_block_sizes;  /* number of block sizes */
     /* block info */
@@ -94,27 +180,96 @@ typedef struct WMADecodeContext {
     int block_pos; /* current position in frame */
     uint8_t ms_stereo; /* true if mid/side stereo mode */
     uint8_t channel_coded[MAX_CHANNELS]; /* true if channel is coded */
-    float exponents[MAX_CHANNELS][BLOCK_MAX_SIZE] ;
+    int noise_index;
+    float noise_mult; /* XXX: suppress that and integrate it in the noise array */
     float max_exponent[MAX_CHANNELS];
-    int16_t coefs1[MAX_CHANNELS][BLOCK_MAX_SIZE];
-    float coefs[MAX_CHANNELS][BLOCK_MAX_SIZE];
-    MDCTContext mdct_ctx[BLOCK_NB_SIZES];
-    float *windows[BLOCK_NB_SIZES];
-    FFTSample mdct_tmp[BLOCK_MAX_SIZE]; /* temporary storage for imdct */
-    /* output buffer for one frame and the last for IMDCT windowing */
-    float frame_out[MAX_CHANNELS][BLOCK_MAX_SIZE * 2];
+    /* the exponents coded with VLC codes are constant over each band, so
+       they are kept as runs of equal values covering all the frame_len
+       values of exponents[] (the values past the current block are
+       still read when a block is interpolated from a larger one): run i
+       ends at exp_run_end[i] and has the value exp_run_val[i]. If that
+       would take more than EXP_RUNS_MAX runs, and always for the LSP
+       coded exponents, exp_nb_runs is 0 and exponents[] holds the
+       values */
+    int exp_nb_runs[MAX_CHANNELS];
+    int exp_run_end[MAX_CHANNELS][EXP_RUNS_MAX];
+    float exp_run_val[MAX_CHANNELS][EXP_RUNS_MAX];
+    /* block sizes whose MDCT and window are known to be built */
+    int block_sizes_ready;
+    /* fixed point transforms (CODEC_FLAG2_FIXED_POINT): frame_out and
+       imdct_out then hold int32_t samples with FRAME_FIXED_BITS
+       fractional bits */
+    int fixed;
+    /* the buffers below hold frame_len values per channel (2 * frame_len
+       for frame_out and imdct_out) and point into one allocation. The
+       stereo IMDCT uses 2 * frame_len of mdct_tmp */
+    float *exponents[MAX_CHANNELS];
+    int16_t *coefs1[MAX_CHANNELS];
+    float *coefs[MAX_CHANNELS];
+    FFTSample *mdct_tmp; /* temporary storage for imdct, 16 byte aligned */
+    FFTSample *imdct_out;
+    /* circular buffer of 2 * out_frame_len samples holding the frame being
+       decoded and the overlap of the next one */
+    float *frame_out[MAX_CHANNELS];
+    int frame_out_pos; /* start of the current frame in frame_out */
+    /* bit 0 (1) is set if something was added to the first (second)
+       half of frame_out since it was last output, otherwise the frame
+       there is silent and frame_out is still zero */
+    int frame_out_dirty;
+    FloatDSPContext fdsp;
+    int (*decode_frame)(struct WMADecodeContext *s, int16_t *samples);
+    void (*lsp_to_curve)(struct WMADecodeContext *s, float *out,
+                         float *val_max_ptr, int n, float *lsp);
+
+    int coefs_start;               /* first coded coef */
+    int coefs_end[BLOCK_NB_SIZES]; /* max number of coded coefficients */
+    int exponent_sizes[BLOCK_NB_SIZES];
+    uint16_t exponent_bands[BLOCK_NB_SIZES][EXP_BANDS_MAX];
+    int high_band_start[BLOCK_NB_SIZES]; /* index of first coef in high band */
+    int exponent_high_sizes[BLOCK_NB_SIZES];
+    int exponent_high_bands[BLOCK_NB_SIZES][HIGH_BAND_MAX_SIZE]; 
+    
+    /* coded values in high bands */
+    int high_band_coded[MAX_CHANNELS][HIGH_BAND_MAX_SIZE];
+    int high_band_values[MAX_CHANNELS][HIGH_BAND_MAX_SIZE];
+
+    /* stream parameters */
+    int sample_rate;
+    int bit_rate;
+    int version; /* 1 = 0x160 (WMAV1), 2 = 0x161 (WMAV2) */
+    int block_align;
+    int use_bit_reservoir;
+    int byte_offset_bits;
+    void *buffers;       /* allocation holding the per channel buffers */
+    int buffers_size;
     /* last frame info */
-    uint8_t last_superframe[MAX_CODED_SUPERFRAME_SIZE + 4]; /* padding added */
+    uint8_t last_superframe[MAX_CODED_SUPERFRAME_SIZE + FF_INPUT_BUFFER_PADDING_SIZE]; /* padding added */
     int last_bitoffset;
     int last_superframe_len;
-    float noise_table[NOISE_TAB_SIZE];
-    int noise_index;
-    float noise_mult; /* XXX: suppress that and integrate it in the noise array */
-    /* lsp_to_curve tables */
-    float lsp_cos_table[BLOCK_MAX_SIZE];
-    float lsp_pow_e_table[256];
-    float lsp_pow_m_table1[(1 << LSP_POW_BITS)];
-    float lsp_pow_m_table2[(1 << LSP_POW_BITS)];
+    /* cache of the last LSP curves, for streams repeating the same
+       codebook indices */
+    LSPCacheEntry lsp_cache[LSP_CACHE_SIZE];
+    unsigned int lsp_cache_clock;
+    unsigned int lsp_cache_hits;
+    unsigned int lsp_cache_misses;
+    /* startup latency, in microseconds */
+    int64_t open_time;          /* av_gettime() when the decoder was opened */
+    int64_t init_time;          /* time spent in wma_decode_init() */
+    int64_t first_sample_time;  /* time from the opening to the first
+                                   decoded samples, -1 if none yet */
+    /* silence map of the frames output by the last decoding call, see
+       WMAStats */
+    int nb_out_frames;
+    unsigned int silent_map;
+    uint64_t silent_frames;
+    int64_t frame_number; /* frames decoded so far */
+    /* spectrum tap, see wma_set_spectrum_tap(). tap_buf holds the
+       exponents and bands given to it, and the left and right
+       coefficients of M/S stereo blocks, frame_len of each */
+    WMASpectrumTap spectrum_tap;
+    void *spectrum_opaque;
+    int spectrum_flags;
+    void *tap_buf;
 
 #ifdef TRACE
     int frame_count;
@@ -122,7 +277,22 @@ typedef struct WMADecodeContext {
 } WMADecodeContext;
 
 
-static void wma_lsp_to_curve_init(WMADecodeContext *s, int frame_len);
+static void wma_select_decode_frame(WMADecodeContext *s);
+static void wma_lsp_to_curve_init(WMATables *t, int frame_len);
+static void wma_lsp_to_curve(WMADecodeContext *s, 
+                             float *out, float *val_max_ptr, 
+                             int n, float *lsp);
+#ifdef HAVE_SSE2
+static void wma_lsp_to_curve_sse(WMADecodeContext *s, 
+                                 float *out, float *val_max_ptr, 
+                                 int n, float *lsp);
+#endif
+#ifdef HAVE_AVX2
+TARGET_AVX2
+static void wma_lsp_to_curve_avx2(WMADecodeContext *s, 
+                                  float *out, float *val_max_ptr, 
+                                  int n, float *lsp);
+#endif
 
 
 
@@ -158,54 +328,220 @@ static void dump_floats(const char *name, int prec, const float *tab, int n)
 }
 #endif
 
-/* XXX: use same run/length optimization as mpeg decoders */
-static void init_coef_vlc(VLC *vlc,
-                          uint16_t **prun_table, uint16_t **plevel_table,
-                          const CoefVLCTable *vlc_table)
+static WMATables *wma_tables_list;
+static pthread_mutex_t wma_tables_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void wma_free_tables(WMATables *t)
+{
+    int i;
+
+    for(i = 0; i < t->nb_block_sizes; i++) {
+        ff_mdct_end(&t->mdct_ctx[i]);
+        av_free(t->windows[i]);
+        ff_mdct_end_fixed(&t->mdct_fixed[i]);
+        av_free(t->windows_fixed[i]);
+    }
+    av_free(t);
+}
+
+static int wma_init_tables(WMATables *t, float noise_mult)
+{
+    int i, frame_len;
+
+    frame_len = 1 << t->frame_len_bits;
+
+    if (t->use_noise_coding) {
+#ifdef TRACE
+        for(i=0;i<NOISE_TAB_SIZE;i++)
+            t->noise_table[i] = 1.0 * noise_mult;
+#else
+        {
+            unsigned int seed;
+            float norm;
+            seed = 1;
+ //         norm = (1.0 / (float)(1L << 31)) * sqrt(3) * noise_mult;
+			norm = (1.0 / (float)(unsigned long)(1L << 31)) * sqrt(3) * noise_mult;
+            for(i=0;i<NOISE_TAB_SIZE;i++) {
+                seed = seed * 314159 + 1;
+                t->noise_table[i] = (float)((int)seed) * norm;
+            }
+        }
+#endif
+    }
+
+    /* the tables give exactly the values pow() returns, so they do not
+       change the decoded output */
+    for(i = 0; i < GAIN_TAB_SIZE; i++)
+        t->gain_tab[i] = pow(10, (i + GAIN_TAB_MIN) * 0.05);
+
+    if (t->use_exp_vlc) {
+        for(i = 0; i < POW_TAB_SIZE; i++)
+            t->pow_tab[i] = pow(10, (i + POW_TAB_MIN) * (1.0 / 16.0));
+    } else {
+        wma_lsp_to_curve_init(t, frame_len);
+    }
+    return 0;
+}
+
+/**
+ * Return the tables matching the parameters of s, building them if no
+ * other decoder uses them yet. Each call must be matched by a call to
+ * wma_release_tables().
+ */
+static WMATables *wma_get_tables(WMADecodeContext *s)
+{
+    WMATables *t;
+
+    pthread_mutex_lock(&wma_tables_mutex);
+    for(t = wma_tables_list; t; t = t->next) {
+        if (t->frame_len_bits == s->frame_len_bits &&
+            t->nb_block_sizes == s->nb_block_sizes &&
+            t->use_exp_vlc == s->use_exp_vlc &&
+            t->use_noise_coding == s->use_noise_coding &&
+            t->lowres == s->lowres &&
+            t->mm_flags == s->mm_flags)
+            break;
+    }
+    if (!t) {
+        t = (WMATables *)av_mallocz(sizeof(WMATables));
+        if (t) {
+            t->frame_len_bits = s->frame_len_bits;
+            t->nb_block_sizes = s->nb_block_sizes;
+            t->use_exp_vlc = s->use_exp_vlc;
+            t->use_noise_coding = s->use_noise_coding;
+            t->lowres = s->lowres;
+            t->mm_flags = s->mm_flags;
+            if (wma_init_tables(t, s->noise_mult) < 0) {
+                wma_free_tables(t);
+                t = NULL;
+            } else {
+                t->next = wma_tables_list;
+                wma_tables_list = t;
+            }
+        }
+    }
+    if (t)
+        t->refcount++;
+    pthread_mutex_unlock(&wma_tables_mutex);
+    return t;
+}
+
+static void wma_release_tables(WMATables *t)
 {
-    int n = vlc_table->n;
-    const uint8_t *table_bits = vlc_table->huffbits;
-    const uint32_t *table_codes = vlc_table->huffcodes;
-    const uint16_t *levels_table = vlc_table->levels;
-    uint16_t *run_table, *level_table;
-    const uint16_t *p;
-    int i, l, j, level;
-
-    init_vlc(vlc, 9, n, table_bits, 1, 1, table_codes, 4, 4);
-
-    run_table = (uint16_t*)av_malloc(n * sizeof(uint16_t));
-    level_table = (uint16_t*)av_malloc(n * sizeof(uint16_t));
-    p = levels_table;
-    i = 2;
-    level = 1;
-    while (i < n) {
-        l = *p++;
-        for(j=0;j<l;j++) {
-            run_table[i] = j;
-            level_table[i] = level;
-            i++;
+    WMATables **pt;
+
+    if (!t)
+        return;
+    pthread_mutex_lock(&wma_tables_mutex);
+    if (--t->refcount == 0) {
+        for(pt = &wma_tables_list; *pt != t; pt = &(*pt)->next);
+        *pt = t->next;
+        wma_free_tables(t);
+    }
+    pthread_mutex_unlock(&wma_tables_mutex);
+}
+
+/**
+ * Make sure that the MDCT and the window of the blocks of
+ * frame_len >> bsize samples are built, in fixed point for a fixed
+ * point decoder.
+ */
+static int wma_init_block_size(WMADecodeContext *s, int bsize)
+{
+    WMATables *t = s->tables;
+    float *window;
+    int ret = 0;
+
+    /* the tables only have nb_block_sizes entries */
+    if (bsize < 0 || bsize >= s->nb_block_sizes)
+        return -1;
+    if (s->block_sizes_ready & (1 << bsize))
+        return 0;
+
+    pthread_mutex_lock(&wma_tables_mutex);
+    if (!s->fixed && !(t->block_sizes_init & (1 << bsize))) {
+        int n, j;
+        float alpha;
+
+        /* init MDCT window : simple sinus window. They are stored
+           decreasing and are the only window shapes ever needed: the
+           transitions between block sizes are built from them in
+           wma_window() */
+        n = 1 << (t->frame_len_bits - t->lowres - bsize);
+        window = (float*)av_malloc(sizeof(float) * n);
+        if (window) {
+            alpha = M_PI / (2.0 * n);
+            for(j=0;j<n;j++) {
+                window[n - j - 1] = sin((j + 0.5) * alpha);
+            }
+            if (ff_mdct_init(&t->mdct_ctx[bsize], t->frame_len_bits - t->lowres - bsize + 1, 1, t->mm_flags) < 0) {
+                av_free(window);
+                window = NULL;
+            }
+        }
+        if (window) {
+            t->windows[bsize] = window;
+            t->block_sizes_init |= 1 << bsize;
+        } else {
+            ret = -1;
+        }
+    }
+    if (s->fixed && !(t->block_sizes_fixed_init & (1 << bsize))) {
+        int32_t *window_fixed;
+        int n, j;
+        double alpha;
+
+        /* same windows, rounded to fixed point */
+        n = 1 << (t->frame_len_bits - t->lowres - bsize);
+        window_fixed = (int32_t*)av_malloc(sizeof(int32_t) * n);
+        if (window_fixed) {
+            alpha = M_PI / (2.0 * n);
+            for(j=0;j<n;j++) {
+                window_fixed[n - j - 1] = lrint(sin((j + 0.5) * alpha) *
+                                                (1 << FFT_FIXED_BITS));
+            }
+            if (ff_mdct_init_fixed(&t->mdct_fixed[bsize], t->frame_len_bits - t->lowres - bsize + 1) < 0) {
+                av_free(window_fixed);
+                window_fixed = NULL;
+            }
+        }
+        if (window_fixed) {
+            t->windows_fixed[bsize] = window_fixed;
+            t->block_sizes_fixed_init |= 1 << bsize;
+        } else {
+            ret = -1;
         }
-        level++;
     }
-    *prun_table = run_table;
-    *plevel_table = level_table;
+    pthread_mutex_unlock(&wma_tables_mutex);
+
+    if (ret == 0)
+        s->block_sizes_ready |= 1 << bsize;
+    return ret;
 }
 
 static int wma_decode_init(AVCodecContext * avctx)
 {
     WMADecodeContext *s = (WMADecodeContext *)avctx->priv_data;
     int i, flags1, flags2;
-    float *window;
     uint8_t *extradata;
     float bps1, high_freq, bps;
     int sample_rate1;
     int coef_vlc_table;
     
+    s->open_time = av_gettime();
+    s->first_sample_time = -1;
     
     s->sample_rate = avctx->sample_rate;
     s->nb_channels = avctx->channels;
     s->bit_rate = avctx->bit_rate;
     s->block_align = avctx->block_align;
+    s->fixed = (avctx->flags2 & CODEC_FLAG2_FIXED_POINT) != 0;
+
+    if (s->nb_channels <= 0 || s->nb_channels > MAX_CHANNELS)
+        return -1;
+    s->out_channels = s->nb_channels;
+    if (avctx->request_channels == 1)
+        s->out_channels = 1;
 
     if (avctx->codec->id == CODEC_ID_WMAV1) {
         s->version = 1;
@@ -251,6 +587,16 @@ static int wma_decode_init(AVCodecContext * avctx)
     } else {
         s->nb_block_sizes = 1;
     }
+    s->lowres = FFMIN(FFMAX(avctx->lowres, 0), LOWRES_MAX);
+    s->out_frame_len = s->frame_len >> s->lowres;
+
+    s->mm_flags = mm_support();
+    if (avctx->dsp_mask) {
+        if (avctx->dsp_mask & FF_MM_FORCE)
+            s->mm_flags |= avctx->dsp_mask & 0xffff;
+        else
+            s->mm_flags &= ~(avctx->dsp_mask & 0xffff);
+    }
 
     /* init rate dependant parameters */
     s->use_noise_coding = 1;
@@ -339,7 +685,7 @@ static int wma_decode_init(AVCodecContext * avctx)
 
             if (s->version == 1) {
                 lpos = 0;
-                for(i=0;i<25;i++) {
+                for(i=0;i<EXP_BANDS_MAX;i++) {
                     a = wma_critical_freqs[i];
                     b = s->sample_rate;
                     pos = ((block_len * 2 * a)  + (b >> 1)) / b;
@@ -373,7 +719,7 @@ static int wma_decode_init(AVCodecContext * avctx)
                 } else {
                     j = 0;
                     lpos = 0;
-                    for(i=0;i<25;i++) {
+                    for(i=0;i<EXP_BANDS_MAX;i++) {
                         a = wma_critical_freqs[i];
                         b = s->sample_rate;
                         pos = ((block_len * 2 * a)  + (b << 1)) / (4 * b);
@@ -438,60 +784,71 @@ static int wma_decode_init(AVCodecContext * avctx)
     }
 #endif
 
-    /* init MDCT */
-    for(i = 0; i < s->nb_block_sizes; i++)
-        ff_mdct_init(&s->mdct_ctx[i], s->frame_len_bits - i + 1, 1);
-    
-    /* init MDCT windows : simple sinus window */
-    for(i = 0; i < s->nb_block_sizes; i++) {
-        int n, j;
-        float alpha;
-        n = 1 << (s->frame_len_bits - i);
-        window = (float*)av_malloc(sizeof(float) * n);
-        alpha = M_PI / (2.0 * n);
-        for(j=0;j<n;j++) {
-            window[n - j - 1] = sin((j + 0.5) * alpha);
+    /* allocate the buffers for the actual frame size and number of
+       channels. Every buffer is a multiple of 16 bytes long, so they all
+       keep the alignment of av_malloc() */
+    {
+        float *ptr;
+        int ch, n = s->frame_len;
+
+        s->buffers_size = (2 * n + s->nb_channels * 6 * n) * sizeof(float) +
+            s->nb_channels * n * sizeof(int16_t);
+        s->buffers = av_mallocz(s->buffers_size);
+        if (!s->buffers)
+            return -1;
+        ptr = (float *)s->buffers;
+        s->mdct_tmp = ptr;
+        ptr += 2 * n;
+        s->imdct_out = ptr;
+        ptr += s->nb_channels * 2 * n;
+        for(ch = 0; ch < s->nb_channels; ch++) {
+            s->frame_out[ch] = ptr;
+            ptr += 2 * n;
+            s->coefs[ch] = ptr;
+            ptr += n;
+            s->exponents[ch] = ptr;
+            ptr += n;
         }
-        s->windows[i] = window;
+        for(ch = 0; ch < s->nb_channels; ch++)
+            s->coefs1[ch] = (int16_t *)ptr + ch * n;
     }
 
+    /* the exponents start as a single run of zeros */
+    if (s->use_exp_vlc) {
+        for(i = 0; i < s->nb_channels; i++) {
+            s->exp_nb_runs[i] = 1;
+            s->exp_run_end[i][0] = s->frame_len;
+            s->exp_run_val[i][0] = 0;
+        }
+    }
+
+    ff_float_dsp_init(&s->fdsp, s->mm_flags);
+
     s->reset_block_lengths = 1;
     
     if (s->use_noise_coding) {
-
         /* init the noise generator */
         if (s->use_exp_vlc)
             s->noise_mult = 0.02;
         else
             s->noise_mult = 0.04;
-               
-#ifdef TRACE
-        for(i=0;i<NOISE_TAB_SIZE;i++)
-            s->noise_table[i] = 1.0 * s->noise_mult;
-#else
-        {
-            unsigned int seed;
-            float norm;
-            seed = 1;
- //         norm = (1.0 / (float)(1L << 31)) * sqrt(3) * s->noise_mult;
-			norm = (1.0 / (float)(unsigned long)(1L << 31)) * sqrt(3) * s->noise_mult;
-            for(i=0;i<NOISE_TAB_SIZE;i++) {
-                seed = seed * 314159 + 1;
-                s->noise_table[i] = (float)((int)seed) * norm;
-            }
-        }
-#endif
-        init_vlc(&s->hgain_vlc, 9, sizeof(hgain_huffbits), 
-                 hgain_huffbits, 1, 1,
-                 hgain_huffcodes, 2, 2);
     }
 
-    if (s->use_exp_vlc) {
-        init_vlc(&s->exp_vlc, 9, sizeof(scale_huffbits), 
-                 scale_huffbits, 1, 1,
-                 scale_huffcodes, 4, 4);
-    } else {
-        wma_lsp_to_curve_init(s, s->frame_len);
+    if (!s->use_exp_vlc) {
+        s->lsp_to_curve = wma_lsp_to_curve;
+#ifdef HAVE_SSE2
+        if (s->mm_flags & MM_SSE2)
+            s->lsp_to_curve = wma_lsp_to_curve_sse;
+#endif
+#ifdef HAVE_AVX2
+        if (s->mm_flags & MM_AVX2)
+            s->lsp_to_curve = wma_lsp_to_curve_avx2;
+#endif
+        s->lsp_cache[0].curve = (float *)av_malloc(LSP_CACHE_SIZE * s->frame_len * sizeof(float));
+        if (!s->lsp_cache[0].curve)
+            goto fail;
+        for(i = 1; i < LSP_CACHE_SIZE; i++)
+            s->lsp_cache[i].curve = s->lsp_cache[0].curve + i * s->frame_len;
     }
 
     /* choose the VLC tables for the coefficients */
@@ -503,11 +860,25 @@ static int wma_decode_init(AVCodecContext * avctx)
             coef_vlc_table = 1;
     }
 
-    init_coef_vlc(&s->coef_vlc[0], &s->run_table[0], &s->level_table[0],
-                  &coef_vlcs[coef_vlc_table * 2]);
-    init_coef_vlc(&s->coef_vlc[1], &s->run_table[1], &s->level_table[1],
-                  &coef_vlcs[coef_vlc_table * 2 + 1]);
+    wma_select_decode_frame(s);
+
+    s->coef_rl_vlc[0] = coef_rl_vlcs[coef_vlc_table * 2];
+    s->coef_rl_vlc[1] = coef_rl_vlcs[coef_vlc_table * 2 + 1];
+
+    s->tables = wma_get_tables(s);
+    if (!s->tables)
+        goto fail;
+
+    avctx->sample_rate = s->sample_rate >> s->lowres;
+    avctx->channels = s->out_channels;
+
+    s->init_time = av_gettime() - s->open_time;
     return 0;
+ fail:
+    /* wma_decode_end() is not called when the init fails */
+    av_freep(&s->buffers);
+    av_freep(&s->lsp_cache[0].curve);
+    return -1;
 }
 
 /* interpolate values for a bigger or smaller block. The block must
@@ -541,12 +912,12 @@ static void interpolate_array(float *scale, int old_size, int new_size)
    interpolation to reduce the mantissa table size at a small speed
    expense (linear interpolation approximately doubles the number of
    bits of precision). */
-static inline float pow_m1_4(WMADecodeContext *s, float x)
+static inline float pow_m1_4(const WMATables *t, float x)
 {
     union {
         float f;
         unsigned int v;
-    } u, t;
+    } u, v;
     unsigned int e, m;
     float a, b;
 
@@ -554,25 +925,25 @@ static inline float pow_m1_4(WMADecodeContext *s, float x)
     e = u.v >> 23;
     m = (u.v >> (23 - LSP_POW_BITS)) & ((1 << LSP_POW_BITS) - 1);
     /* build interpolation scale: 1 <= t < 2. */
-    t.v = ((u.v << LSP_POW_BITS) & ((1 << 23) - 1)) | (127 << 23);
-    a = s->lsp_pow_m_table1[m];
-    b = s->lsp_pow_m_table2[m];
-    return s->lsp_pow_e_table[e] * (a + b * t.f);
+    v.v = ((u.v << LSP_POW_BITS) & ((1 << 23) - 1)) | (127 << 23);
+    a = t->lsp_pow_m_table1[m];
+    b = t->lsp_pow_m_table2[m];
+    return t->lsp_pow_e_table[e] * (a + b * v.f);
 }
 
-static void wma_lsp_to_curve_init(WMADecodeContext *s, int frame_len)
+static void wma_lsp_to_curve_init(WMATables *t, int frame_len)
 {  
     float wdel, a, b;
     int i, e, m;
 
     wdel = M_PI / frame_len;
     for(i=0;i<frame_len;i++)
-        s->lsp_cos_table[i] = 2.0f * cos(wdel * i);
+        t->lsp_cos_table[i] = 2.0f * cos(wdel * i);
 
     /* tables for x^-0.25 computation */
     for(i=0;i<256;i++) {
         e = i - 126;
-        s->lsp_pow_e_table[i] = pow(2.0, e * -0.25);
+        t->lsp_pow_e_table[i] = pow(2.0, e * -0.25);
     }
 
     /* NOTE: these two tables are needed to avoid two operations in
@@ -582,15 +953,15 @@ static void wma_lsp_to_curve_init(WMADecodeContext *s, int frame_len)
         m = (1 << LSP_POW_BITS) + i;
         a = (float)m * (0.5 / (1 << LSP_POW_BITS));
         a = pow(a, -0.25);
-        s->lsp_pow_m_table1[i] = 2 * a - b;
-        s->lsp_pow_m_table2[i] = b - a;
+        t->lsp_pow_m_table1[i] = 2 * a - b;
+        t->lsp_pow_m_table2[i] = b - a;
         b = a;
     }
 #if 0
     for(i=1;i<20;i++) {
         float v, r1, r2;
         v = 5.0 / i;
-        r1 = pow_m1_4(s, v);
+        r1 = pow_m1_4(t, v);
         r2 = pow(v,-0.25);
         printf("%f^-0.25=%f e=%f\n", v, r1, r2 - r1);
     }
@@ -598,11 +969,11 @@ static void wma_lsp_to_curve_init(WMADecodeContext *s, int frame_len)
 }
 
 /* NOTE: We use the same code as Vorbis here */
-/* XXX: optimize it further with SSE/3Dnow */
 static void wma_lsp_to_curve(WMADecodeContext *s, 
                              float *out, float *val_max_ptr, 
                              int n, float *lsp)
 {
+    const WMATables *t = s->tables;
     int i, j;
     float p, q, w, v, val_max;
 
@@ -610,7 +981,7 @@ static void wma_lsp_to_curve(WMADecodeContext *s,
     for(i=0;i<n;i++) {
         p = 0.5f;
         q = 0.5f;
-        w = s->lsp_cos_table[i];
+        w = t->lsp_cos_table[i];
         for(j=1;j<NB_LSP_COEFS;j+=2){
             q *= w - lsp[j - 1];
             p *= w - lsp[j];
@@ -618,7 +989,7 @@ static void wma_lsp_to_curve(WMADecodeContext *s,
         p *= p * (2.0f - w);
         q *= q * (2.0f + w);
         v = p + q;
-        v = pow_m1_4(s, v);
+        v = pow_m1_4(t, v);
         if (v > val_max)
             val_max = v;
         out[i] = v;
@@ -626,73 +997,829 @@ static void wma_lsp_to_curve(WMADecodeContext *s,
     *val_max_ptr = val_max;
 }
 
+#ifdef HAVE_SSE2
+/**
+ * Same as wma_lsp_to_curve(), four bins at a time, with the same
+ * operation order so that the result is identical. The table lookups of
+ * pow_m1_4() are done through scalar loads.
+ * @param n must be a multiple of 4
+ */
+static void wma_lsp_to_curve_sse(WMADecodeContext *s, 
+                                 float *out, float *val_max_ptr, 
+                                 int n, float *lsp)
+{
+    const WMATables *tab = s->tables;
+    int i, j, k;
+    __m128 p, q, w, v, a, b, val_max, lspv[NB_LSP_COEFS];
+    __m128i u, t;
+    int e[4] __align16, m[4] __align16;
+    float ea[4] __align16, aa[4] __align16, ba[4] __align16;
+    const __m128 two = _mm_set1_ps(2.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128i mant_mask = _mm_set1_epi32((1 << 23) - 1);
+    const __m128i m_mask = _mm_set1_epi32((1 << LSP_POW_BITS) - 1);
+    const __m128i one = _mm_set1_epi32(127 << 23);
+
+    for(j=0;j<NB_LSP_COEFS;j++)
+        lspv[j] = _mm_set1_ps(lsp[j]);
+    val_max = _mm_setzero_ps();
+    for(i=0;i<n;i+=4) {
+        p = half;
+        q = half;
+        w = _mm_loadu_ps(&tab->lsp_cos_table[i]);
+        for(j=1;j<NB_LSP_COEFS;j+=2){
+            q = _mm_mul_ps(q, _mm_sub_ps(w, lspv[j - 1]));
+            p = _mm_mul_ps(p, _mm_sub_ps(w, lspv[j]));
+        }
+        p = _mm_mul_ps(p, _mm_mul_ps(p, _mm_sub_ps(two, w)));
+        q = _mm_mul_ps(q, _mm_mul_ps(q, _mm_add_ps(two, w)));
+        v = _mm_add_ps(p, q);
+
+        /* pow_m1_4 */
+        u = _mm_castps_si128(v);
+        _mm_store_si128((__m128i *)e, _mm_srli_epi32(u, 23));
+        _mm_store_si128((__m128i *)m,
+                        _mm_and_si128(_mm_srli_epi32(u, 23 - LSP_POW_BITS),
+                                      m_mask));
+        t = _mm_or_si128(_mm_and_si128(_mm_slli_epi32(u, LSP_POW_BITS),
+                                       mant_mask), one);
+        for(k=0;k<4;k++) {
+            ea[k] = tab->lsp_pow_e_table[e[k]];
+            aa[k] = tab->lsp_pow_m_table1[m[k]];
+            ba[k] = tab->lsp_pow_m_table2[m[k]];
+        }
+        a = _mm_load_ps(aa);
+        b = _mm_load_ps(ba);
+        v = _mm_mul_ps(_mm_load_ps(ea),
+                       _mm_add_ps(a, _mm_mul_ps(b, _mm_castsi128_ps(t))));
+
+        /* a NaN in v leaves val_max unchanged, as in the C version */
+        val_max = _mm_max_ps(v, val_max);
+        _mm_storeu_ps(&out[i], v);
+    }
+    val_max = _mm_max_ps(val_max, _mm_movehl_ps(val_max, val_max));
+    val_max = _mm_max_ss(val_max, _mm_shuffle_ps(val_max, val_max, 1));
+    _mm_store_ss(val_max_ptr, val_max);
+}
+#endif
+
+#ifdef HAVE_AVX2
+/**
+ * Same as wma_lsp_to_curve_sse(), eight bins at a time, the tables of
+ * pow_m1_4() being read with gathers.
+ */
+TARGET_AVX2
+static void wma_lsp_to_curve_avx2(WMADecodeContext *s, 
+                                  float *out, float *val_max_ptr, 
+                                  int n, float *lsp)
+{
+    const WMATables *tab = s->tables;
+    int i, j;
+    __m256 p, q, w, v, a, b, e, val_max, lspv[NB_LSP_COEFS];
+    __m256i u, t, m;
+    __m128 max4;
+    const __m256 two = _mm256_set1_ps(2.0f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256i mant_mask = _mm256_set1_epi32((1 << 23) - 1);
+    const __m256i m_mask = _mm256_set1_epi32((1 << LSP_POW_BITS) - 1);
+    const __m256i one = _mm256_set1_epi32(127 << 23);
+
+    if (n & 7) {
+        wma_lsp_to_curve_sse(s, out, val_max_ptr, n, lsp);
+        return;
+    }
+    for(j=0;j<NB_LSP_COEFS;j++)
+        lspv[j] = _mm256_set1_ps(lsp[j]);
+    val_max = _mm256_setzero_ps();
+    for(i=0;i<n;i+=8) {
+        p = half;
+        q = half;
+        w = _mm256_loadu_ps(&tab->lsp_cos_table[i]);
+        for(j=1;j<NB_LSP_COEFS;j+=2){
+            q = _mm256_mul_ps(q, _mm256_sub_ps(w, lspv[j - 1]));
+            p = _mm256_mul_ps(p, _mm256_sub_ps(w, lspv[j]));
+        }
+        p = _mm256_mul_ps(p, _mm256_mul_ps(p, _mm256_sub_ps(two, w)));
+        q = _mm256_mul_ps(q, _mm256_mul_ps(q, _mm256_add_ps(two, w)));
+        v = _mm256_add_ps(p, q);
+
+        /* pow_m1_4 */
+        u = _mm256_castps_si256(v);
+        m = _mm256_and_si256(_mm256_srli_epi32(u, 23 - LSP_POW_BITS), m_mask);
+        t = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi32(u, LSP_POW_BITS),
+                                             mant_mask), one);
+        e = _mm256_i32gather_ps(tab->lsp_pow_e_table,
+                                _mm256_srli_epi32(u, 23), 4);
+        a = _mm256_i32gather_ps(tab->lsp_pow_m_table1, m, 4);
+        b = _mm256_i32gather_ps(tab->lsp_pow_m_table2, m, 4);
+        v = _mm256_mul_ps(e, _mm256_add_ps(a, _mm256_mul_ps(b, _mm256_castsi256_ps(t))));
+
+        val_max = _mm256_max_ps(v, val_max);
+        _mm256_storeu_ps(&out[i], v);
+    }
+    max4 = _mm_max_ps(_mm256_castps256_ps128(val_max),
+                      _mm256_extractf128_ps(val_max, 1));
+    max4 = _mm_max_ps(max4, _mm_movehl_ps(max4, max4));
+    max4 = _mm_max_ss(max4, _mm_shuffle_ps(max4, max4, 1));
+    _mm_store_ss(val_max_ptr, max4);
+}
+#endif
+
 /* decode exponents coded with LSP coefficients (same idea as Vorbis) */
 static void decode_exp_lsp(WMADecodeContext *s, int ch)
 {
     float lsp_coefs[NB_LSP_COEFS];
     int val, i;
+    uint64_t key;
+    LSPCacheEntry *e;
 
+    key = s->block_len_bits;
     for(i = 0; i < NB_LSP_COEFS; i++) {
         if (i == 0 || i >= 8)
             val = get_bits(&s->gb, 3);
         else
             val = get_bits(&s->gb, 4);
+        key = (key << 4) | val;
         lsp_coefs[i] = lsp_codebook[i][val];
     }
 
-    wma_lsp_to_curve(s, s->exponents[ch], &s->max_exponent[ch],
-                     s->block_len, lsp_coefs);
+    /* reuse the curve if the same indices were seen recently, otherwise
+       compute it in place of the least recently used entry */
+    s->lsp_cache_clock++;
+    e = &s->lsp_cache[0];
+    for(i = 0; i < LSP_CACHE_SIZE; i++) {
+        if (s->lsp_cache[i].key == key) {
+            e = &s->lsp_cache[i];
+            e->last_used = s->lsp_cache_clock;
+            memcpy(s->exponents[ch], e->curve, s->block_len * sizeof(float));
+            s->max_exponent[ch] = e->max;
+            s->lsp_cache_hits++;
+            return;
+        }
+        if (s->lsp_cache[i].last_used < e->last_used)
+            e = &s->lsp_cache[i];
+    }
+
+    s->lsp_to_curve(s, s->exponents[ch], &s->max_exponent[ch],
+                    s->block_len, lsp_coefs);
+    e->key = key;
+    e->last_used = s->lsp_cache_clock;
+    memcpy(e->curve, s->exponents[ch], s->block_len * sizeof(float));
+    e->max = s->max_exponent[ch];
+    s->lsp_cache_misses++;
+}
+
+/* return pow(10, gain * 0.05) */
+static inline double wma_gain(WMADecodeContext *s, int gain)
+{
+    if ((unsigned)(gain - GAIN_TAB_MIN) < GAIN_TAB_SIZE)
+        return s->tables->gain_tab[gain - GAIN_TAB_MIN];
+    return pow(10, gain * 0.05);
+}
+
+/* expand the exponent runs of channel ch to exponents[] */
+static void wma_exp_runs_to_array(WMADecodeContext *s, int ch)
+{
+    float *q = s->exponents[ch];
+    int i, k;
+
+    i = 0;
+    for(k = 0; k < s->exp_nb_runs[ch]; k++) {
+        for(; i < s->exp_run_end[ch][k]; i++)
+            q[i] = s->exp_run_val[ch][k];
+    }
+    s->exp_nb_runs[ch] = 0;
+}
+
+/* set the exponents of channel ch up to end[n - 1] to the n runs given
+   by end[] and val[], keeping the following ones */
+static void wma_exp_set_runs(WMADecodeContext *s, int ch,
+                             const int *end, const float *val, int n)
+{
+    int *run_end = s->exp_run_end[ch];
+    float *run_val = s->exp_run_val[ch];
+    float *q;
+    int i, k, m, nb_runs, len;
+
+    len = end[n - 1];
+    nb_runs = s->exp_nb_runs[ch];
+    if (nb_runs) {
+        /* the runs ending after len are kept */
+        for(k = 0; k < nb_runs && run_end[k] <= len; k++);
+        m = nb_runs - k;
+        if (n + m <= EXP_RUNS_MAX) {
+            memmove(run_end + n, run_end + k, m * sizeof(int));
+            memmove(run_val + n, run_val + k, m * sizeof(float));
+            memcpy(run_end, end, n * sizeof(int));
+            memcpy(run_val, val, n * sizeof(float));
+            s->exp_nb_runs[ch] = n + m;
+            return;
+        }
+        wma_exp_runs_to_array(s, ch);
+    }
+    q = s->exponents[ch];
+    i = 0;
+    for(k = 0; k < n; k++) {
+        for(; i < end[k]; i++)
+            q[i] = val[k];
+    }
+}
+
+/* same as interpolate_array() on the exponents of channel ch */
+static void wma_exp_interpolate(WMADecodeContext *s, int ch,
+                                int old_size, int new_size)
+{
+    const int *run_end = s->exp_run_end[ch];
+    const float *run_val = s->exp_run_val[ch];
+    int end[EXP_RUNS_MAX];
+    float val[EXP_RUNS_MAX];
+    int k, n, e, jincr;
+
+    if (!s->exp_nb_runs[ch]) {
+        interpolate_array(s->exponents[ch], old_size, new_size);
+        return;
+    }
+    if (new_size == old_size)
+        return;
+
+    /* the runs always extend up to frame_len, so the loops stop when
+       the run containing old_size - 1 is reached */
+    n = 0;
+    if (new_size > old_size) {
+        /* value i goes to values i * jincr to (i + 1) * jincr - 1 */
+        jincr = new_size / old_size;
+        for(k = 0; n == 0 || end[n - 1] < new_size; k++) {
+            end[n] = FFMIN(run_end[k], old_size) * jincr;
+            val[n] = run_val[k];
+            n++;
+        }
+    } else {
+        /* value i * jincr goes to value i, some runs may vanish */
+        jincr = old_size / new_size;
+        for(k = 0; n == 0 || end[n - 1] < new_size; k++) {
+            e = (FFMIN(run_end[k], old_size) + jincr - 1) / jincr;
+            if (e > (n ? end[n - 1] : 0)) {
+                end[n] = e;
+                val[n] = run_val[k];
+                n++;
+            }
+        }
+    }
+    wma_exp_set_runs(s, ch, end, val, n);
 }
 
 /* decode exponents coded with VLC codes */
 static int decode_exp_vlc(WMADecodeContext *s, int ch)
 {
-    int last_exp, n, code;
-    const uint16_t *ptr, *band_ptr;
-    float v, *q, max_scale, *q_end;
+    int last_exp, code, pos, nb_bands;
+    const uint16_t *ptr;
+    float v, max_scale;
+    int band_end[EXP_BANDS_MAX];
+    float band_val[EXP_BANDS_MAX];
+    const float *ptab = s->tables->pow_tab - POW_TAB_MIN;
     
-    band_ptr = s->exponent_bands[s->frame_len_bits - s->block_len_bits];
-    ptr = band_ptr;
-    q = s->exponents[ch];
-    q_end = q + s->block_len;
+    ptr = s->exponent_bands[s->frame_len_bits - s->block_len_bits];
+    pos = 0;
+    nb_bands = 0;
     max_scale = 0;
     if (s->version == 1) {
         last_exp = get_bits(&s->gb, 5) + 10;
-        /* XXX: use a table */
-        v = pow(10, last_exp * (1.0 / 16.0));
+        v = ptab[last_exp];
         max_scale = v;
-        n = *ptr++;
-        do {
-            *q++ = v;
-        } while (--n);
+        pos += *ptr++;
+        band_end[nb_bands] = pos;
+        band_val[nb_bands++] = v;
     }
     last_exp = 36;
-    while (q < q_end) {
-        code = get_vlc(&s->gb, &s->exp_vlc);
-        if (code < 0)
-            return -1;
-        /* NOTE: this offset is the same as MPEG4 AAC ! */
-        last_exp += code - 60;
-        /* XXX: use a table */
-        v = pow(10, last_exp * (1.0 / 16.0));
-        if (v > max_scale)
-            max_scale = v;
-        n = *ptr++;
-        do {
-            *q++ = v;
-        } while (--n);
+    {
+        /* keep the bit reader open over the whole band list */
+        const VLC_TYPE (*table)[2] = scale_vlc_table;
+        OPEN_READER(re, &s->gb)
+        while (pos < s->block_len && nb_bands < EXP_BANDS_MAX) {
+            UPDATE_CACHE(re, &s->gb)
+            GET_VLC(code, re, &s->gb, table, EXP_VLC_BITS, 3)
+            if (code < 0)
+                break;
+            /* NOTE: this offset is the same as MPEG4 AAC ! */
+            last_exp += code - 60;
+            if ((unsigned)(last_exp - POW_TAB_MIN) >= POW_TAB_SIZE)
+                break;
+            v = ptab[last_exp];
+            if (v > max_scale)
+                max_scale = v;
+            pos += *ptr++;
+            band_end[nb_bands] = pos;
+            band_val[nb_bands++] = v;
+        }
+        CLOSE_READER(re, &s->gb)
     }
+    if (pos != s->block_len)
+        return -1;
     s->max_exponent[ch] = max_scale;
+    wma_exp_set_runs(s, ch, band_end, band_val, nb_bands);
     return 0;
 }
 
+/**
+ * Add len samples of in[], multiplied by win[] (reversed if reverse is
+ * set, or not multiplied if win is NULL), to frame_out at pos, wrapping
+ * around the end of the circular buffer.
+ */
+static void wma_overlap_add(WMADecodeContext *s, float *buf, int pos,
+                            const float *in, const float *win, int len,
+                            int reverse)
+{
+    int size, n;
+
+    size = s->out_frame_len * 2;
+    pos &= size - 1;
+    while (len > 0) {
+        n = FFMIN(len, size - pos);
+        s->frame_out_dirty |= (1 << (pos / s->out_frame_len)) |
+            (1 << ((pos + n - 1) / s->out_frame_len));
+        if (!win) {
+            s->fdsp.vector_add(buf + pos, in, n);
+        } else if (reverse) {
+            s->fdsp.vector_fmul_reverse_add(buf + pos, in, win + len - n, n);
+        } else {
+            s->fdsp.vector_fmul_add(buf + pos, in, win, n);
+            win += n;
+        }
+        in += n;
+        len -= n;
+        pos = 0;
+    }
+}
+
+/* same as wma_overlap_add() on fixed point samples, the window has
+   FFT_FIXED_BITS fractional bits */
+static void wma_overlap_add_fixed(WMADecodeContext *s, int32_t *buf, int pos,
+                                  const int32_t *in, const int32_t *win,
+                                  int len, int reverse)
+{
+    int size, n, i;
+    const int round = 1 << (FFT_FIXED_BITS - 1);
+
+    size = s->out_frame_len * 2;
+    pos &= size - 1;
+    while (len > 0) {
+        n = FFMIN(len, size - pos);
+        s->frame_out_dirty |= (1 << (pos / s->out_frame_len)) |
+            (1 << ((pos + n - 1) / s->out_frame_len));
+        if (!win) {
+            for(i = 0; i < n; i++)
+                buf[pos + i] += in[i];
+        } else if (reverse) {
+            const int32_t *w = win + len - 1;
+            for(i = 0; i < n; i++)
+                buf[pos + i] += ((int64_t)in[i] * w[-i] + round) >> FFT_FIXED_BITS;
+        } else {
+            for(i = 0; i < n; i++)
+                buf[pos + i] += ((int64_t)in[i] * win[i] + round) >> FFT_FIXED_BITS;
+            win += n;
+        }
+        in += n;
+        len -= n;
+        pos = 0;
+    }
+}
+
+/* add len samples of in + offset, multiplied by the window of block
+   size win_bsize (none if negative), in the float or fixed point
+   frame buffer out */
+static always_inline void wma_overlap_add_window(WMADecodeContext *s, void *out,
+                                                 int pos, const void *in,
+                                                 int offset, int win_bsize,
+                                                 int len, int reverse,
+                                                 const int fixed)
+{
+    if (fixed)
+        wma_overlap_add_fixed(s, (int32_t *)out, pos,
+                              (const int32_t *)in + offset,
+                              win_bsize < 0 ? NULL : s->tables->windows_fixed[win_bsize],
+                              len, reverse);
+    else
+        wma_overlap_add(s, (float *)out, pos, (const float *)in + offset,
+                        win_bsize < 0 ? NULL : s->tables->windows[win_bsize],
+                        len, reverse);
+}
+
+/**
+ * Apply the MDCT window to the IMDCT output of the current block and
+ * add it in the frame. We ensure that when the windows overlap their
+ * squared sum is always 1 (MDCT reconstruction rule): each half is
+ * either the sine window of the block, or, when the neighbour block is
+ * shorter, a flat part, the sine window of the neighbour and a zero
+ * part. The flat part is a plain add and the zero part is skipped.
+ * @param out frame_out of the channel
+ * @param pos position of the first sample of the block in out
+ * @param in 2 * (block_len >> lowres) IMDCT output samples
+ * @param fixed true if out and in hold fixed point samples
+ */
+static always_inline void wma_window(WMADecodeContext *s, void *out, int pos,
+                                     const void *in, const int fixed)
+{
+    int block_len, bsize, n;
+
+    block_len = s->block_len >> s->lowres;
+    bsize = s->frame_len_bits - s->block_len_bits;
+
+    /* left part */
+    if (s->block_len_bits <= s->prev_block_len_bits) {
+        wma_overlap_add_window(s, out, pos, in, 0, bsize, block_len, 1, fixed);
+    } else {
+        n = (block_len - (1 << (s->prev_block_len_bits - s->lowres))) / 2;
+        wma_overlap_add_window(s, out, pos + n, in, n,
+                               s->frame_len_bits - s->prev_block_len_bits,
+                               block_len - 2 * n, 1, fixed);
+        wma_overlap_add_window(s, out, pos + block_len - n, in,
+                               block_len - n, -1, n, 0, fixed);
+    }
+
+    pos += block_len;
+
+    /* right part */
+    if (s->block_len_bits <= s->next_block_len_bits) {
+        wma_overlap_add_window(s, out, pos, in, block_len, bsize,
+                               block_len, 0, fixed);
+    } else {
+        n = (block_len - (1 << (s->next_block_len_bits - s->lowres))) / 2;
+        wma_overlap_add_window(s, out, pos, in, block_len, -1, n, 0, fixed);
+        wma_overlap_add_window(s, out, pos + n, in, block_len + n,
+                               s->frame_len_bits - s->next_block_len_bits,
+                               block_len - 2 * n, 0, fixed);
+    }
+}
+
+/**
+ * Fixed point IMDCT of the coefficients of channel ch. They are scaled
+ * by a power of 2 to use as many bits as the IMDCT allows, then the
+ * output is scaled to FRAME_FIXED_BITS fractional bits and clipped
+ * so that the overlap of two blocks cannot overflow.
+ * @param output 2 * (block_len >> lowres) samples
+ * @return 0 if the block is silent, in which case output is not set
+ */
+static int wma_imdct_fixed(WMADecodeContext *s, int ch, int bsize,
+                           int32_t *output)
+{
+    MDCTContextFixed *mdct = &s->tables->mdct_fixed[bsize];
+    const float *coefs = s->coefs[ch];
+    int i, n, e, shift;
+    float sum, scale;
+    int64_t x;
+
+    /* every value computed by the IMDCT is a sum of the inputs rotated
+       by unit complex numbers, so it is at most sqrt(2) times the sum of
+       their magnitudes. This is a much closer bound than the one of
+       ff_imdct_calc_fixed(), which only knows the largest input */
+    n = s->block_len >> s->lowres;
+    sum = 0;
+    for(i = 0; i < n; i++)
+        sum += fabsf(coefs[i]);
+    if (!(sum > 0 && sum <= FLT_MAX))
+        return 0;
+
+    /* scale the sum to [2^29, 2^30). The scaling is exact and lrintf()
+       rounds the same way everywhere */
+    frexpf(sum, &e);
+    shift = 30 - e;
+    if (shift > 127)
+        return 0; /* too small to matter */
+    scale = ldexpf(1.0, shift);
+    /* output is also used as the IMDCT input */
+    for(i = 0; i < n; i++)
+        output[i] = lrintf(coefs[i] * scale);
+    ff_imdct_calc_fixed(mdct, output, output, (FFTSampleFixed *)s->mdct_tmp);
+
+    /* output has shift fractional bits. Past 32 bits of shift the
+       result no longer changes */
+    shift -= FRAME_FIXED_BITS;
+    shift = FFMAX(FFMIN(shift, 32), -32);
+    for(i = 0; i < 2 * n; i++) {
+        x = output[i];
+        if (shift > 0)
+            x = (x + ((int64_t)1 << (shift - 1))) >> shift;
+        else
+            x *= (int64_t)1 << -shift;
+        output[i] = FFMAX(FFMIN(x, FRAME_FIXED_MAX), -FRAME_FIXED_MAX);
+    }
+    return 1;
+}
+
+/* operations of wma_dequant_range() */
+#define DEQUANT_CODED       0 /* coded value * exponent * mult */
+#define DEQUANT_NOISE       1 /* noise * exponent * mult */
+#define DEQUANT_CODED_NOISE 2 /* (coded value + noise) * exponent * mult */
+
+/**
+ * Compute the MDCT coefficients of the exponents a to b - 1 of channel
+ * ch, taking the exponents from their runs or, if per_bin is set, from
+ * exponents[]. The products are done in the same order as in the per
+ * value loops, so the output is the same in both cases.
+ * @return the end of the computed coefficients
+ */
+static always_inline float *wma_dequant_range(WMADecodeContext *s, int ch,
+                                              float *coefs,
+                                              const int16_t **pcoefs1,
+                                              int a, int b, float mult,
+                                              const int op,
+                                              const int per_bin)
+{
+    const float *noise_table = s->tables->noise_table;
+    const float *exponents = s->exponents[ch];
+    const int *run_end = s->exp_run_end[ch];
+    const int16_t *coefs1 = *pcoefs1;
+    int i, j, e, k, n, noise_index;
+    float v;
+
+    noise_index = s->noise_index;
+    v = 0;
+    k = 0;
+    for(i = a; i < b; i = e) {
+        if (per_bin) {
+            e = b;
+        } else {
+            while (run_end[k] <= i)
+                k++;
+            v = s->exp_run_val[ch][k];
+            e = FFMIN(run_end[k], b);
+        }
+#define EXP_VAL(j) (per_bin ? exponents[j] : v)
+        switch(op) {
+        case DEQUANT_CODED:
+            for(j = i; j < e; j++)
+                *coefs++ = (*coefs1++) * EXP_VAL(j) * mult;
+            break;
+        case DEQUANT_NOISE:
+        case DEQUANT_CODED_NOISE:
+            /* the noise is read in chunks that do not wrap around the
+               end of noise_table */
+            for(j = i; j < e; j += n) {
+                n = FFMIN(e - j, NOISE_TAB_SIZE - noise_index);
+                if (op == DEQUANT_NOISE) {
+                    s->fdsp.noise_fmul(coefs, noise_table + noise_index,
+                                       per_bin ? exponents + j : NULL,
+                                       v, mult, n);
+                } else {
+                    s->fdsp.coef_noise_fmul(coefs, coefs1,
+                                            noise_table + noise_index,
+                                            per_bin ? exponents + j : NULL,
+                                            v, mult, n);
+                    coefs1 += n;
+                }
+                coefs += n;
+                noise_index = (noise_index + n) & (NOISE_TAB_SIZE - 1);
+            }
+            break;
+        }
+#undef EXP_VAL
+    }
+    s->noise_index = noise_index;
+    *pcoefs1 = coefs1;
+    return coefs;
+}
+
+/* sum of the squares of the exponents a to a + n - 1 of channel ch */
+static always_inline float wma_exp_power(WMADecodeContext *s, int ch,
+                                         int a, int n, const int per_bin)
+{
+    const float *exponents = s->exponents[ch];
+    const int *run_end = s->exp_run_end[ch];
+    int i, e, k;
+    float v, e2;
+
+    e2 = 0;
+    if (per_bin) {
+        for(i = a; i < a + n; i++) {
+            v = exponents[i];
+            e2 += v * v;
+        }
+    } else {
+        k = 0;
+        for(i = a; i < a + n; i = e) {
+            while (run_end[k] <= i)
+                k++;
+            v = s->exp_run_val[ch][k];
+            e = FFMIN(run_end[k], a + n);
+            for(; i < e; i++)
+                e2 += v * v;
+        }
+    }
+    return e2;
+}
+
+/* exponent i of channel ch */
+static always_inline float wma_exp_value(WMADecodeContext *s, int ch, int i,
+                                         const int per_bin)
+{
+    int k;
+
+    if (per_bin)
+        return s->exponents[ch][i];
+    for(k = 0; s->exp_run_end[ch][k] <= i; k++);
+    return s->exp_run_val[ch][k];
+}
+
+/* compute the MDCT coefficients of channel ch from its coded values and
+   exponents, in a single pass over each band */
+static always_inline void wma_dequant_channel(WMADecodeContext *s, int ch,
+                                              int bsize, float mult,
+                                              float mdct_norm, int nb_coefs,
+                                              const int use_noise_coding,
+                                              const int per_bin)
+{
+    const int16_t *coefs1 = s->coefs1[ch];
+    float *coefs = s->coefs[ch];
+    int i, n;
+
+    if (use_noise_coding) {
+        const float *noise_table = s->tables->noise_table;
+        const int *high_bands;
+        float mult1, exp_power[HIGH_BAND_MAX_SIZE];
+        int j, n1, pos, last_high_band;
+
+        high_bands = s->exponent_high_bands[s->frame_len_bits -
+                                            s->block_len_bits];
+
+        /* very low freqs : noise */
+        coefs = wma_dequant_range(s, ch, coefs, &coefs1, 0, s->coefs_start,
+                                  mult, DEQUANT_NOISE, per_bin);
+
+        n1 = s->exponent_high_sizes[bsize];
+
+        /* compute power of high bands */
+        pos = s->high_band_start[bsize];
+        last_high_band = 0; /* avoid warning */
+        for(j=0;j<n1;j++) {
+            n = high_bands[j];
+            if (s->high_band_coded[ch][j]) {
+                exp_power[j] = wma_exp_power(s, ch, pos, n, per_bin) / n;
+                last_high_band = j;
+                tprintf("%d: power=%f (%d)\n", j, exp_power[j], n);
+            }
+            pos += n;
+        }
+
+        /* main freqs and high freqs */
+        pos = s->coefs_start;
+        for(j=-1;j<n1;j++) {
+            if (j < 0) {
+                n = s->high_band_start[bsize] - 
+                    s->coefs_start;
+            } else {
+                n = high_bands[j];
+            }
+            if (j >= 0 && s->high_band_coded[ch][j]) {
+                /* use noise with specified power */
+                mult1 = sqrt(exp_power[j] / exp_power[last_high_band]);
+                mult1 = mult1 * wma_gain(s, s->high_band_values[ch][j]);
+                mult1 = mult1 / (s->max_exponent[ch] * s->noise_mult);
+                mult1 *= mdct_norm;
+                coefs = wma_dequant_range(s, ch, coefs, &coefs1, pos, pos + n,
+                                          mult1, DEQUANT_NOISE, per_bin);
+            } else {
+                /* coded values + small noise */
+                coefs = wma_dequant_range(s, ch, coefs, &coefs1, pos, pos + n,
+                                          mult, DEQUANT_CODED_NOISE, per_bin);
+            }
+            pos += n;
+        }
+
+        /* very high freqs : noise (noise * mult1 * 1 is noise * mult1) */
+        n = s->block_len - s->coefs_end[bsize];
+        mult1 = mult * wma_exp_value(s, ch, pos - 1, per_bin);
+        for(i = 0; i < n; i += j) {
+            j = FFMIN(n - i, NOISE_TAB_SIZE - s->noise_index);
+            s->fdsp.noise_fmul(coefs, noise_table + s->noise_index, NULL,
+                               mult1, 1.0, j);
+            coefs += j;
+            s->noise_index = (s->noise_index + j) & (NOISE_TAB_SIZE - 1);
+        }
+    } else {
+        memset(coefs, 0, s->coefs_start * sizeof(float));
+        coefs += s->coefs_start;
+        coefs = wma_dequant_range(s, ch, coefs, &coefs1, 0, nb_coefs,
+                                  mult, DEQUANT_CODED, per_bin);
+        n = s->block_len - s->coefs_end[bsize];
+        memset(coefs, 0, n * sizeof(float));
+    }
+}
+
+/**
+ * Replace the coefficients of channel 0 by the mean of the two
+ * channels, so that a single IMDCT gives the mono output. For M/S
+ * stereo it is the mid channel: the side channel cancels out.
+ */
+static void wma_downmix(WMADecodeContext *s)
+{
+    float *c0 = s->coefs[0];
+    const float *c1 = s->coefs[1];
+    int i, n;
+
+    if (s->ms_stereo)
+        return;
+    n = s->block_len >> s->lowres;
+    if (s->channel_coded[0] && s->channel_coded[1]) {
+        for(i = 0; i < n; i++)
+            c0[i] = (c0[i] + c1[i]) * 0.5f;
+    } else if (s->channel_coded[1]) {
+        for(i = 0; i < n; i++)
+            c0[i] = c1[i] * 0.5f;
+        s->channel_coded[0] = 1;
+    } else if (s->channel_coded[0]) {
+        for(i = 0; i < n; i++)
+            c0[i] *= 0.5f;
+    }
+}
+
+/* give the spectrum of each channel of the current block to the tap */
+static void wma_spectrum_tap(WMADecodeContext *s, int nb_channels,
+                             int use_exp_vlc)
+{
+    WMASpectrum sp;
+    float *exponents = (float *)s->tap_buf;
+    float *band_exponent = exponents + s->frame_len;
+    int *band_end = (int *)(band_exponent + s->frame_len);
+    float *lr[2], a, b;
+    int ch, i, k, n, ms;
+
+    /* the tap gets left and right: undo the M/S coding into tap_buf, as
+       the decoder does it later, in the stereo IMDCT. An uncoded channel
+       has 0 coefficients */
+    ms = nb_channels == 2 && s->ms_stereo &&
+        (s->channel_coded[0] || s->channel_coded[1]);
+    if (ms) {
+        lr[0] = (float *)(band_end + s->frame_len);
+        lr[1] = lr[0] + s->frame_len;
+        for(i = 0; i < s->block_len; i++) {
+            a = s->channel_coded[0] ? s->coefs[0][i] : 0;
+            b = s->channel_coded[1] ? s->coefs[1][i] : 0;
+            lr[0][i] = a + b;
+            lr[1][i] = a - b;
+        }
+    }
+
+    for(ch = 0; ch < nb_channels; ch++) {
+        memset(&sp, 0, sizeof(sp));
+        sp.channel = ch;
+        sp.frame_number = s->frame_number;
+        sp.frame_len = s->frame_len;
+        sp.block_pos = s->block_pos;
+        sp.block_len = s->block_len;
+        sp.ms_stereo = nb_channels == 2 && s->ms_stereo;
+        if (ms)
+            sp.coefs = lr[ch];
+        else if (s->channel_coded[ch])
+            sp.coefs = s->coefs[ch];
+        /* for M/S stereo, the exponents are the ones of the mid and
+           side channels */
+        if (s->channel_coded[ch]) {
+            n = 0;
+            if (s->exp_nb_runs[ch]) {
+                /* the runs go up to frame_len */
+                i = 0;
+                for(k = 0; i < s->block_len; k++) {
+                    band_end[n] = FFMIN(s->exp_run_end[ch][k], s->block_len);
+                    band_exponent[n] = s->exp_run_val[ch][k];
+                    for(; i < band_end[n]; i++)
+                        exponents[i] = band_exponent[n];
+                    n++;
+                }
+                sp.exponents = exponents;
+            } else {
+                sp.exponents = s->exponents[ch];
+                if (use_exp_vlc) {
+                    for(i = 0; i < s->block_len; i++) {
+                        if (n && band_exponent[n - 1] == sp.exponents[i]) {
+                            band_end[n - 1] = i + 1;
+                        } else {
+                            band_end[n] = i + 1;
+                            band_exponent[n] = sp.exponents[i];
+                            n++;
+                        }
+                    }
+                }
+            }
+            sp.nb_bands = n;
+            sp.band_end = band_end;
+            sp.band_exponent = band_exponent;
+        }
+        s->spectrum_tap(s->spectrum_opaque, &sp);
+    }
+}
+
 /* return 0 if OK. return 1 if last block of frame. return -1 if
-   unrecorrable error. */
-static int wma_decode_block(WMADecodeContext *s)
+   unrecorrable error. The stream parameters given as arguments are
+   constants, see wma_decode_frame() */
+static always_inline int wma_decode_block(WMADecodeContext *s,
+                                          const int version,
+                                          const int nb_channels,
+                                          const int use_noise_coding,
+                                          const int use_exp_vlc)
 {
-    int n, v, a, ch, code, bsize;
+    int n, v, a, ch, bsize;
+    int prev_block_len_bits, block_len_bits;
     int coef_nb_bits, total_gain, parse_exponents;
-    float window[BLOCK_MAX_SIZE * 2];
     int nb_coefs[MAX_CHANNELS];
     float mdct_norm;
 
@@ -705,23 +1832,27 @@ static int wma_decode_block(WMADecodeContext *s)
         n = av_log2(s->nb_block_sizes - 1) + 1;
     
         if (s->reset_block_lengths) {
-            s->reset_block_lengths = 0;
             v = get_bits(&s->gb, n);
             if (v >= s->nb_block_sizes)
                 return -1;
-            s->prev_block_len_bits = s->frame_len_bits - v;
+            prev_block_len_bits = s->frame_len_bits - v;
             v = get_bits(&s->gb, n);
             if (v >= s->nb_block_sizes)
                 return -1;
-            s->block_len_bits = s->frame_len_bits - v;
+            block_len_bits = s->frame_len_bits - v;
         } else {
             /* update block lengths */
-            s->prev_block_len_bits = s->block_len_bits;
-            s->block_len_bits = s->next_block_len_bits;
+            prev_block_len_bits = s->block_len_bits;
+            block_len_bits = s->next_block_len_bits;
         }
         v = get_bits(&s->gb, n);
         if (v >= s->nb_block_sizes)
             return -1;
+        /* the lengths are only changed once all of them are read, so
+           that a corrupt block cannot leave an invalid one behind */
+        s->reset_block_lengths = 0;
+        s->prev_block_len_bits = prev_block_len_bits;
+        s->block_len_bits = block_len_bits;
         s->next_block_len_bits = s->frame_len_bits - v;
     } else {
         /* fixed block len */
@@ -735,11 +1866,11 @@ static int wma_decode_block(WMADecodeContext *s)
     if ((s->block_pos + s->block_len) > s->frame_len)
         return -1;
 
-    if (s->nb_channels == 2) {
+    if (nb_channels == 2) {
         s->ms_stereo = get_bits(&s->gb, 1);
     }
     v = 0;
-    for(ch = 0; ch < s->nb_channels; ch++) {
+    for(ch = 0; ch < nb_channels; ch++) {
         a = get_bits(&s->gb, 1);
         s->channel_coded[ch] = a;
         v |= a;
@@ -751,6 +1882,13 @@ static int wma_decode_block(WMADecodeContext *s)
 
     bsize = s->frame_len_bits - s->block_len_bits;
 
+    /* the windows of the previous and next blocks are needed as well
+       when they are shorter */
+    if (wma_init_block_size(s, bsize) < 0 ||
+        wma_init_block_size(s, s->frame_len_bits - s->prev_block_len_bits) < 0 ||
+        wma_init_block_size(s, s->frame_len_bits - s->next_block_len_bits) < 0)
+        return -1;
+
     /* read total gain and extract corresponding number of bits for
        coef escape coding */
     total_gain = 1;
@@ -774,13 +1912,13 @@ static int wma_decode_block(WMADecodeContext *s)
 
     /* compute number of coefficients */
     n = s->coefs_end[bsize] - s->coefs_start;
-    for(ch = 0; ch < s->nb_channels; ch++)
+    for(ch = 0; ch < nb_channels; ch++)
         nb_coefs[ch] = n;
 
     /* complex coding */
-    if (s->use_noise_coding) {
+    if (use_noise_coding) {
 
-        for(ch = 0; ch < s->nb_channels; ch++) {
+        for(ch = 0; ch < nb_channels; ch++) {
             if (s->channel_coded[ch]) {
                 int i, n, a;
                 n = s->exponent_high_sizes[bsize];
@@ -793,7 +1931,7 @@ static int wma_decode_block(WMADecodeContext *s)
                 }
             }
         }
-        for(ch = 0; ch < s->nb_channels; ch++) {
+        for(ch = 0; ch < nb_channels; ch++) {
             if (s->channel_coded[ch]) {
                 int i, n, val, code;
 
@@ -804,7 +1942,7 @@ static int wma_decode_block(WMADecodeContext *s)
                         if (val == (int)0x80000000) {
                             val = get_bits(&s->gb, 7) - 19;
                         } else {
-                            code = get_vlc(&s->gb, &s->hgain_vlc);
+                            code = get_vlc2(&s->gb, hgain_vlc_table, HGAIN_VLC_BITS, 3);
                             if (code < 0)
                                 return -1;
                             val += code - 18;
@@ -823,9 +1961,9 @@ static int wma_decode_block(WMADecodeContext *s)
     }
     
     if (parse_exponents) {
-        for(ch = 0; ch < s->nb_channels; ch++) {
+        for(ch = 0; ch < nb_channels; ch++) {
             if (s->channel_coded[ch]) {
-                if (s->use_exp_vlc) {
+                if (use_exp_vlc) {
                     if (decode_exp_vlc(s, ch) < 0)
                         return -1;
                 } else {
@@ -834,63 +1972,83 @@ static int wma_decode_block(WMADecodeContext *s)
             }
         }
     } else {
-        for(ch = 0; ch < s->nb_channels; ch++) {
+        for(ch = 0; ch < nb_channels; ch++) {
             if (s->channel_coded[ch]) {
-                interpolate_array(s->exponents[ch], 1 << s->prev_block_len_bits, 
-                                  s->block_len);
+                wma_exp_interpolate(s, ch, 1 << s->prev_block_len_bits,
+                                    s->block_len);
             }
         }
     }
 
     /* parse spectral coefficients : just RLE encoding */
-    for(ch = 0; ch < s->nb_channels; ch++) {
+    for(ch = 0; ch < nb_channels; ch++) {
         if (s->channel_coded[ch]) {
-            VLC *coef_vlc;
-            int level, run, sign, tindex;
+            static const int16_t zero8[8] = { 0 };
+            const RL_VLC_ELEM *rl_vlc;
+            int level, run, sign, tindex, i;
             int16_t *ptr, *eptr;
-            const int16_t *level_table, *run_table;
 
             /* special VLC tables are used for ms stereo because
                there is potentially less energy there */
             tindex = (ch == 1 && s->ms_stereo);
-            coef_vlc = &s->coef_vlc[tindex];
-            run_table = (const int16_t *)s->run_table[tindex];
-            level_table = (const int16_t *)s->level_table[tindex];
-            /* XXX: optimize */
+            rl_vlc = s->coef_rl_vlc[tindex];
             ptr = &s->coefs1[ch][0];
             eptr = ptr + nb_coefs[ch];
-            memset(ptr, 0, s->block_len * sizeof(int16_t));
-            for(;;) {
-                code = get_vlc(&s->gb, coef_vlc);
-                if (code < 0)
-                    return -1;
-                if (code == 1) {
-                    /* EOB */
-                    break;
-                } else if (code == 0) {
-                    /* escape */
-                    level = get_bits(&s->gb, coef_nb_bits);
-                    /* NOTE: this is rather suboptimal. reading
-                       block_len_bits would be better */
-                    run = get_bits(&s->gb, s->frame_len_bits);
-                } else {
-                    /* normal code */
-                    run = run_table[code];
-                    level = level_table[code];
+            {
+                OPEN_READER(re, &s->gb)
+                for(;;) {
+                    UPDATE_CACHE(re, &s->gb)
+                    GET_RL_VLC(level, run, re, &s->gb, rl_vlc,
+                               COEF_VLC_BITS, COEF_VLC_DEPTH)
+                    if (level == 0) {
+                        if (run == COEF_EOB)
+                            break;
+                        if (run != COEF_ESCAPE) {
+                            CLOSE_READER(re, &s->gb)
+                            return -1;
+                        }
+                        /* escape */
+                        UPDATE_CACHE(re, &s->gb)
+                        level = SHOW_UBITS(re, &s->gb, coef_nb_bits);
+                        SKIP_BITS(re, &s->gb, coef_nb_bits)
+                        /* NOTE: this is rather suboptimal. reading
+                           block_len_bits would be better */
+                        UPDATE_CACHE(re, &s->gb)
+                        run = SHOW_UBITS(re, &s->gb, s->frame_len_bits);
+                        SKIP_BITS(re, &s->gb, s->frame_len_bits)
+                        UPDATE_CACHE(re, &s->gb)
+                    }
+                    /* the sign bit is still in the cache: 1 means a
+                       positive level */
+                    sign = SHOW_UBITS(re, &s->gb, 1) - 1;
+                    LAST_SKIP_BITS(re, &s->gb, 1)
+                    level = (level ^ sign) - sign;
+                    if (run >= eptr - ptr) {
+                        CLOSE_READER(re, &s->gb)
+                        return -1;
+                    }
+                    /* only the skipped coefficients need to be cleared.
+                       It is done 8 at a time, which may clear up to 7
+                       coefficients after the run: they are written or
+                       cleared later anyway, and stay within coefs1 */
+                    memcpy(ptr, zero8, sizeof(zero8));
+                    for(i = 8; i < run; i += 8)
+                        memcpy(ptr + i, zero8, sizeof(zero8));
+                    ptr += run;
+                    *ptr++ = level;
+                    /* NOTE: EOB can be omitted */
+                    if (ptr >= eptr)
+                        break;
                 }
-                sign = get_bits(&s->gb, 1);
-                if (!sign)
-                    level = -level;
-                ptr += run;
-                if (ptr >= eptr)
-                    return -1;
-                *ptr++ = level;
-                /* NOTE: EOB can be omitted */
-                if (ptr >= eptr)
-                    break;
+                CLOSE_READER(re, &s->gb)
             }
+            /* without noise, a channel without coded coefficients is
+               silent in this block and needs no IMDCT */
+            if (!use_noise_coding && ptr == s->coefs1[ch])
+                s->channel_coded[ch] = 0;
+            memset(ptr, 0, (eptr - ptr) * sizeof(int16_t));
         }
-        if (s->version == 1 && s->nb_channels >= 2) {
+        if (version == 1 && nb_channels >= 2) {
             align_get_bits(&s->gb);
         }
     }
@@ -899,119 +2057,51 @@ static int wma_decode_block(WMADecodeContext *s)
     {
         int n4 = s->block_len / 2;
         mdct_norm = 1.0 / (float)n4;
-        if (s->version == 1) {
+        if (version == 1) {
             mdct_norm *= sqrt(n4);
         }
     }
 
     /* finally compute the MDCT coefficients */
-    for(ch = 0; ch < s->nb_channels; ch++) {
+    for(ch = 0; ch < nb_channels; ch++) {
+        /* the side channel is not needed for a mono output, but it
+           still takes its part of the noise sequence */
+        if (ch == 1 && s->ms_stereo && s->out_channels == 1 &&
+            !use_noise_coding && !s->spectrum_tap)
+            continue;
         if (s->channel_coded[ch]) {
-            int16_t *coefs1;
-            float *coefs, *exponents, mult, mult1, noise, *exp_ptr;
-            int i, j, n, n1, last_high_band;
-            float exp_power[HIGH_BAND_MAX_SIZE];
-
-            coefs1 = s->coefs1[ch];
-            exponents = s->exponents[ch];
-            mult = pow(10, total_gain * 0.05) / s->max_exponent[ch];
-            mult *= mdct_norm;
-            coefs = s->coefs[ch];
-            if (s->use_noise_coding) {
-                mult1 = mult;
-                /* very low freqs : noise */
-                for(i = 0;i < s->coefs_start; i++) {
-                    *coefs++ = s->noise_table[s->noise_index] * (*exponents++) * mult1;
-                    s->noise_index = (s->noise_index + 1) & (NOISE_TAB_SIZE - 1);
-                }
-                
-                n1 = s->exponent_high_sizes[bsize];
-
-                /* compute power of high bands */
-                exp_ptr = exponents + 
-                    s->high_band_start[bsize] - 
-                    s->coefs_start;
-                last_high_band = 0; /* avoid warning */
-                for(j=0;j<n1;j++) {
-                    n = s->exponent_high_bands[s->frame_len_bits - 
-                                              s->block_len_bits][j];
-                    if (s->high_band_coded[ch][j]) {
-                        float e2, v;
-                        e2 = 0;
-                        for(i = 0;i < n; i++) {
-                            v = exp_ptr[i];
-                            e2 += v * v;
-                        }
-                        exp_power[j] = e2 / n;
-                        last_high_band = j;
-                        tprintf("%d: power=%f (%d)\n", j, exp_power[j], n);
-                    }
-                    exp_ptr += n;
-                }
+            float mult;
 
-                /* main freqs and high freqs */
-                for(j=-1;j<n1;j++) {
-                    if (j < 0) {
-                        n = s->high_band_start[bsize] - 
-                            s->coefs_start;
-                    } else {
-                        n = s->exponent_high_bands[s->frame_len_bits - 
-                                                  s->block_len_bits][j];
-                    }
-                    if (j >= 0 && s->high_band_coded[ch][j]) {
-                        /* use noise with specified power */
-                        mult1 = sqrt(exp_power[j] / exp_power[last_high_band]);
-                        /* XXX: use a table */
-                        mult1 = mult1 * pow(10, s->high_band_values[ch][j] * 0.05);
-                        mult1 = mult1 / (s->max_exponent[ch] * s->noise_mult);
-                        mult1 *= mdct_norm;
-                        for(i = 0;i < n; i++) {
-                            noise = s->noise_table[s->noise_index];
-                            s->noise_index = (s->noise_index + 1) & (NOISE_TAB_SIZE - 1);
-                            *coefs++ = (*exponents++) * noise * mult1;
-                        }
-                    } else {
-                        /* coded values + small noise */
-                        for(i = 0;i < n; i++) {
-                            noise = s->noise_table[s->noise_index];
-                            s->noise_index = (s->noise_index + 1) & (NOISE_TAB_SIZE - 1);
-                            *coefs++ = ((*coefs1++) + noise) * (*exponents++) * mult;
-                        }
-                    }
-                }
-
-                /* very high freqs : noise */
-                n = s->block_len - s->coefs_end[bsize];
-                mult1 = mult * exponents[-1];
-                for(i = 0; i < n; i++) {
-                    *coefs++ = s->noise_table[s->noise_index] * mult1;
-                    s->noise_index = (s->noise_index + 1) & (NOISE_TAB_SIZE - 1);
-                }
-            } else {
-                /* XXX: optimize more */
-                for(i = 0;i < s->coefs_start; i++)
-                    *coefs++ = 0.0;
-                n = nb_coefs[ch];
-                for(i = 0;i < n; i++) {
-                    *coefs++ = coefs1[i] * exponents[i] * mult;
-                }
-                n = s->block_len - s->coefs_end[bsize];
-                for(i = 0;i < n; i++)
-                    *coefs++ = 0.0;
-            }
+            mult = wma_gain(s, total_gain) / s->max_exponent[ch];
+            mult *= mdct_norm;
+            if (!use_exp_vlc || !s->exp_nb_runs[ch])
+                wma_dequant_channel(s, ch, bsize, mult, mdct_norm,
+                                    nb_coefs[ch], use_noise_coding, 1);
+            else
+                wma_dequant_channel(s, ch, bsize, mult, mdct_norm,
+                                    nb_coefs[ch], use_noise_coding, 0);
         }
     }
 
 #ifdef TRACE
-    for(ch = 0; ch < s->nb_channels; ch++) {
+    for(ch = 0; ch < nb_channels; ch++) {
         if (s->channel_coded[ch]) {
-            dump_floats("exponents", 3, s->exponents[ch], s->block_len);
+            if (!s->exp_nb_runs[ch])
+                dump_floats("exponents", 3, s->exponents[ch], s->block_len);
             dump_floats("coefs", 1, s->coefs[ch], s->block_len);
         }
     }
 #endif
+
+    if (s->spectrum_tap) {
+        wma_spectrum_tap(s, nb_channels, use_exp_vlc);
+        if (s->spectrum_flags & WMA_TAP_NO_OUTPUT)
+            goto next;
+    }
     
-    if (s->ms_stereo && s->channel_coded[1]) {
+    if (nb_channels == 2 && s->out_channels == 1) {
+        wma_downmix(s);
+    } else if (s->ms_stereo && s->channel_coded[1]) {
         float a, b;
         int i;
 
@@ -1024,93 +2114,64 @@ static int wma_decode_block(WMADecodeContext *s)
             s->channel_coded[0] = 1;
         }
         
-        for(i = 0; i < s->block_len; i++) {
-            a = s->coefs[0][i];
-            b = s->coefs[1][i];
-            s->coefs[0][i] = a + b;
-            s->coefs[1][i] = a - b;
+        /* the float stereo IMDCT does it on the fly */
+        if (s->fixed) {
+            /* only the coefficients kept by lowres are needed */
+            for(i = 0; i < (s->block_len >> s->lowres); i++) {
+                a = s->coefs[0][i];
+                b = s->coefs[1][i];
+                s->coefs[0][i] = a + b;
+                s->coefs[1][i] = a - b;
+            }
         }
     }
 
-    /* build the window : we ensure that when the windows overlap
-       their squared sum is always 1 (MDCT reconstruction rule) */
-    /* XXX: merge with output */
-    {
-        int i, next_block_len, block_len, prev_block_len, n;
-        float *wptr;
-
-        block_len = s->block_len;
-        prev_block_len = 1 << s->prev_block_len_bits;
-        next_block_len = 1 << s->next_block_len_bits;
-
-        /* right part */
-        wptr = window + block_len;
-        if (block_len <= next_block_len) {
-            for(i=0;i<block_len;i++)
-                *wptr++ = s->windows[bsize][i];
-        } else {
-            /* overlap */
-            n = (block_len / 2) - (next_block_len / 2);
-            for(i=0;i<n;i++)
-                *wptr++ = 1.0;
-            for(i=0;i<next_block_len;i++)
-                *wptr++ = s->windows[s->frame_len_bits - s->next_block_len_bits][i];
-            for(i=0;i<n;i++)
-                *wptr++ = 0.0;
-        }
-
-        /* left part */
-        wptr = window + block_len;
-        if (block_len <= prev_block_len) {
-            for(i=0;i<block_len;i++)
-                *--wptr = s->windows[bsize][i];
-        } else {
-            /* overlap */
-            n = (block_len / 2) - (prev_block_len / 2);
-            for(i=0;i<n;i++)
-                *--wptr = 1.0;
-            for(i=0;i<prev_block_len;i++)
-                *--wptr = s->windows[s->frame_len_bits - s->prev_block_len_bits][i];
-            for(i=0;i<n;i++)
-                *--wptr = 0.0;
-        }
+    if (!s->fixed && s->out_channels == 2 &&
+        s->channel_coded[0] && s->channel_coded[1]) {
+        FFTSample *output = s->imdct_out;
+        int n4, index;
+
+        n4 = (s->block_len >> s->lowres) / 2;
+        index = s->frame_out_pos + (s->out_frame_len / 2) +
+            (s->block_pos >> s->lowres) - n4;
+        ff_imdct_calc2(&s->tables->mdct_ctx[bsize], output,
+                       s->coefs[0], s->coefs[1], s->ms_stereo, s->mdct_tmp);
+        wma_window(s, s->frame_out[0], index, output, 0);
+        wma_window(s, s->frame_out[1], index, output + 4 * n4, 0);
+        goto next;
     }
 
-    
-    for(ch = 0; ch < s->nb_channels; ch++) {
+    for(ch = 0; ch < s->out_channels; ch++) {
         if (s->channel_coded[ch]) {
-            FFTSample output[BLOCK_MAX_SIZE * 2];
-            float *ptr;
-            int i, n4, index, n;
+            FFTSample *output = s->imdct_out;
+            int n4, index;
+
+            n4 = (s->block_len >> s->lowres) / 2;
+            index = s->frame_out_pos + (s->out_frame_len / 2) +
+                (s->block_pos >> s->lowres) - n4;
+            if (s->fixed) {
+                int32_t *output_fixed = (int32_t *)s->imdct_out;
+
+                if (!wma_imdct_fixed(s, ch, bsize, output_fixed))
+                    continue;
+                wma_window(s, s->frame_out[ch], index, output_fixed, 1);
+                if (s->ms_stereo && !s->channel_coded[1] &&
+                    s->out_channels == 2)
+                    wma_window(s, s->frame_out[1], index, output_fixed, 1);
+                continue;
+            }
 
-            n = s->block_len;
-            n4 = s->block_len / 2;
-            ff_imdct_calc(&s->mdct_ctx[bsize], 
+            ff_imdct_calc(&s->tables->mdct_ctx[bsize], 
                           output, s->coefs[ch], s->mdct_tmp);
 
-            /* XXX: optimize all that by build the window and
-               multipying/adding at the same time */
-            /* multiply by the window */
-            for(i=0;i<n * 2;i++) {
-                output[i] *= window[i];
-            }
-
-            /* add in the frame */
-            index = (s->frame_len / 2) + s->block_pos - n4;
-            ptr = &s->frame_out[ch][index];
-            for(i=0;i<n * 2;i++) {
-                *ptr += output[i];
-                ptr++;
-            }
+            /* multiply by the window and add in the frame */
+            wma_window(s, s->frame_out[ch], index, output, 0);
 
             /* specific fast case for ms-stereo : add to second
                channel if it is not coded */
-            if (s->ms_stereo && !s->channel_coded[1]) {
-                ptr = &s->frame_out[1][index];
-                for(i=0;i<n * 2;i++) {
-                    *ptr += output[i];
-                    ptr++;
-                }
+            if (s->ms_stereo && !s->channel_coded[1] &&
+                s->out_channels == 2) {
+                wma_window(s, s->frame_out[1], index, output, 0);
             }
         }
     }
@@ -1124,12 +2185,37 @@ static int wma_decode_block(WMADecodeContext *s)
         return 0;
 }
 
-/* decode a frame of frame_len samples */
-static int wma_decode_frame(WMADecodeContext *s, int16_t *samples)
+/* convert the current frame of a fixed point decoder to int16_t,
+   rounding to nearest and saturating */
+static void wma_fixed_to_int16_interleave(WMADecodeContext *s,
+                                          int16_t *samples, int nb_channels)
+{
+    const int32_t *in;
+    int i, ch, a;
+
+    for(ch = 0; ch < nb_channels; ch++) {
+        in = (const int32_t *)s->frame_out[ch] + s->frame_out_pos;
+        for(i = 0; i < s->out_frame_len; i++) {
+            a = (in[i] + (1 << (FRAME_FIXED_BITS - 1))) >> FRAME_FIXED_BITS;
+            if (a > 32767)
+                a = 32767;
+            else if (a < -32768)
+                a = -32768;
+            samples[i * nb_channels + ch] = a;
+        }
+    }
+}
+
+/* decode a frame of frame_len samples, output as out_frame_len ones */
+static always_inline int wma_decode_frame(WMADecodeContext *s,
+                                          int16_t *samples,
+                                          const int version,
+                                          const int nb_channels,
+                                          const int use_noise_coding,
+                                          const int use_exp_vlc)
 {
-    int ret, i, n, a, ch, incr;
-    int16_t *ptr;
-    float *iptr;
+    int ret, ch, half;
+    const float *output[MAX_CHANNELS];
 
 #ifdef TRACE
     tprintf("***decode_frame: %d size=%d\n", s->frame_count++, s->frame_len);
@@ -1139,43 +2225,99 @@ static int wma_decode_frame(WMADecodeContext *s, int16_t *samples)
     s->block_num = 0;
     s->block_pos = 0;
     for(;;) {
-        ret = wma_decode_block(s);
+        ret = wma_decode_block(s, version, nb_channels,
+                               use_noise_coding, use_exp_vlc);
         if (ret < 0) 
             return -1;
         if (ret)
             break;
     }
 
-    /* convert frame to integer */
-    n = s->frame_len;
-    incr = s->nb_channels;
-    for(ch = 0; ch < s->nb_channels; ch++) {
-        ptr = samples + ch;
-        iptr = s->frame_out[ch];
+    s->frame_number++;
+    if (s->spectrum_flags & WMA_TAP_NO_OUTPUT)
+        return 0;
 
-        for(i=0;i<n;i++) {
-            a = lrintf(*iptr++);
-            if (a > 32767)
-                a = 32767;
-            else if (a < -32768)
-                a = -32768;
-            *ptr = a;
-            ptr += incr;
+    /* convert frame to integer. The frame starts at 0 or out_frame_len in
+       the circular buffer, so it never wraps. If nothing was added to
+       it, it is silent */
+    half = 1 << (s->frame_out_pos != 0);
+    if (!(s->frame_out_dirty & half)) {
+        memset(samples, 0, s->out_frame_len * s->out_channels * sizeof(int16_t));
+        if (s->nb_out_frames < 32)
+            s->silent_map |= 1U << s->nb_out_frames;
+        s->silent_frames++;
+    } else {
+        if (s->fixed) {
+            wma_fixed_to_int16_interleave(s, samples, s->out_channels);
+        } else {
+            for(ch = 0; ch < s->out_channels; ch++)
+                output[ch] = s->frame_out[ch] + s->frame_out_pos;
+            s->fdsp.float_to_int16_interleave(samples, output, s->out_frame_len,
+                                              s->out_channels);
         }
-        /* prepare for next block */
-        memmove(&s->frame_out[ch][0], &s->frame_out[ch][s->frame_len],
-                s->frame_len * sizeof(float));
-        /* XXX: suppress this */
-        memset(&s->frame_out[ch][s->frame_len], 0, 
-               s->frame_len * sizeof(float));
+
+        /* prepare for next block: the samples just output become the
+           overlap area of the frame after the next one */
+        for(ch = 0; ch < s->out_channels; ch++)
+            memset(s->frame_out[ch] + s->frame_out_pos, 0,
+                   s->out_frame_len * sizeof(float));
+        s->frame_out_dirty &= ~half;
     }
+    s->frame_out_pos ^= s->out_frame_len;
+    s->nb_out_frames++;
 
 #ifdef TRACE
-    dump_shorts("samples", samples, n * s->nb_channels);
+    dump_shorts("samples", samples, s->out_frame_len * s->out_channels);
 #endif
     return 0;
 }
 
+/* one version of wma_decode_frame() per combination of the parameters
+   the block decoding depends on, so that the tests on them are resolved
+   at compile time. wma_decode_init() selects the one to use */
+#define WMA_DECODE_FRAME(version, nb_channels, noise, exp_vlc)          \
+static int wma_decode_frame_v##version##_##nb_channels##_##noise##_##exp_vlc( \
+    WMADecodeContext *s, int16_t *samples)                              \
+{                                                                       \
+    return wma_decode_frame(s, samples, version, nb_channels,           \
+                            noise, exp_vlc);                            \
+}
+
+#define WMA_DECODE_FRAME_VERSION(version)       \
+WMA_DECODE_FRAME(version, 1, 0, 0)              \
+WMA_DECODE_FRAME(version, 1, 0, 1)              \
+WMA_DECODE_FRAME(version, 1, 1, 0)              \
+WMA_DECODE_FRAME(version, 1, 1, 1)              \
+WMA_DECODE_FRAME(version, 2, 0, 0)              \
+WMA_DECODE_FRAME(version, 2, 0, 1)              \
+WMA_DECODE_FRAME(version, 2, 1, 0)              \
+WMA_DECODE_FRAME(version, 2, 1, 1)
+
+WMA_DECODE_FRAME_VERSION(1)
+WMA_DECODE_FRAME_VERSION(2)
+
+#define WMA_DECODE_FRAME_TAB(version)                                   \
+    {                                                                   \
+        { { wma_decode_frame_v##version##_1_0_0, wma_decode_frame_v##version##_1_0_1 }, \
+          { wma_decode_frame_v##version##_1_1_0, wma_decode_frame_v##version##_1_1_1 } }, \
+        { { wma_decode_frame_v##version##_2_0_0, wma_decode_frame_v##version##_2_0_1 }, \
+          { wma_decode_frame_v##version##_2_1_0, wma_decode_frame_v##version##_2_1_1 } }, \
+    }
+
+/* indexed by version - 1, nb_channels - 1, use_noise_coding and
+   use_exp_vlc */
+static int (*const wma_decode_frame_tab[2][MAX_CHANNELS][2][2])(WMADecodeContext *s,
+                                                                int16_t *samples) = {
+    WMA_DECODE_FRAME_TAB(1),
+    WMA_DECODE_FRAME_TAB(2),
+};
+
+static void wma_select_decode_frame(WMADecodeContext *s)
+{
+    s->decode_frame = wma_decode_frame_tab[s->version - 1][s->nb_channels - 1]
+        [s->use_noise_coding][s->use_exp_vlc];
+}
+
 static int wma_decode_superframe(AVCodecContext *avctx, 
                                  void *data, int *data_size,
                                  uint8_t *buf, int buf_size)
@@ -1193,6 +2335,8 @@ static int wma_decode_superframe(AVCodecContext *avctx,
     }
     
     samples = (int16_t *)data;
+    s->nb_out_frames = 0;
+    s->silent_map = 0;
 
     init_get_bits(&s->gb, buf, buf_size*8);
     
@@ -1226,9 +2370,9 @@ static int wma_decode_superframe(AVCodecContext *avctx,
                 skip_bits(&s->gb, s->last_bitoffset);
             /* this frame is stored in the last superframe and in the
                current one */
-            if (wma_decode_frame(s, samples) < 0)
+            if (s->decode_frame(s, samples) < 0)
                 goto fail;
-            samples += s->nb_channels * s->frame_len;
+            samples += s->out_channels * s->out_frame_len;
         }
 
         /* read each frame starting from bit_offset */
@@ -1240,9 +2384,9 @@ static int wma_decode_superframe(AVCodecContext *avctx,
     
         s->reset_block_lengths = 1;
         for(i=0;i<nb_frames;i++) {
-            if (wma_decode_frame(s, samples) < 0)
+            if (s->decode_frame(s, samples) < 0)
                 goto fail;
-            samples += s->nb_channels * s->frame_len;
+            samples += s->out_channels * s->out_frame_len;
         }
 
         /* we copy the end of the frame in the last frame buffer */
@@ -1257,40 +2401,67 @@ static int wma_decode_superframe(AVCodecContext *avctx,
         memcpy(s->last_superframe, buf + pos, len);
     } else {
         /* single frame decode */
-        if (wma_decode_frame(s, samples) < 0)
+        if (s->decode_frame(s, samples) < 0)
             goto fail;
-        samples += s->nb_channels * s->frame_len;
+        samples += s->out_channels * s->out_frame_len;
     }
     *data_size = (int8_t *)samples - (int8_t *)data;
+    if (s->spectrum_flags & WMA_TAP_NO_OUTPUT)
+        *data_size = 0;
+    if (s->first_sample_time < 0 && *data_size > 0)
+        s->first_sample_time = av_gettime() - s->open_time;
     return s->block_align;
  fail:
     /* when error, we reset the bit reservoir */
     s->last_superframe_len = 0;
+    /* and no frame is returned */
+    s->nb_out_frames = 0;
+    s->silent_map = 0;
     return -1;
 }
 
 static int wma_decode_end(AVCodecContext *avctx)
 {
     WMADecodeContext *s = (WMADecodeContext*)avctx->priv_data;
-    int i;
 
-    for(i = 0; i < s->nb_block_sizes; i++)
-        ff_mdct_end(&s->mdct_ctx[i]);
-    for(i = 0; i < s->nb_block_sizes; i++)
-        av_free(s->windows[i]);
+    wma_release_tables(s->tables);
+    av_free(s->buffers);
+    av_free(s->tap_buf);
+    av_free(s->lsp_cache[0].curve);
+    return 0;
+}
 
-    if (s->use_exp_vlc) {
-        free_vlc(&s->exp_vlc);
-    }
-    if (s->use_noise_coding) {
-        free_vlc(&s->hgain_vlc);
-    }
-    for(i = 0;i < 2; i++) {
-        free_vlc(&s->coef_vlc[i]);
-        av_free(s->run_table[i]);
-        av_free(s->level_table[i]);
+void wma_get_stats(AVCodecContext *avctx, WMAStats *stats)
+{
+    WMADecodeContext *s = (WMADecodeContext*)avctx->priv_data;
+
+    memset(stats, 0, sizeof(*stats));
+    stats->lsp_cache_hits = s->lsp_cache_hits;
+    stats->lsp_cache_misses = s->lsp_cache_misses;
+    stats->init_time = s->init_time;
+    stats->first_sample_time = s->first_sample_time;
+    stats->nb_frames = s->nb_out_frames;
+    stats->frame_size = s->out_frame_len;
+    stats->silent_map = s->silent_map;
+    stats->silent_frames = s->silent_frames;
+    stats->decoder_bytes = sizeof(WMADecodeContext) + s->buffers_size;
+    if (!s->use_exp_vlc)
+        stats->decoder_bytes += LSP_CACHE_SIZE * s->frame_len * sizeof(float);
+}
+
+int wma_set_spectrum_tap(AVCodecContext *avctx, WMASpectrumTap tap,
+                         void *opaque, int flags)
+{
+    WMADecodeContext *s = (WMADecodeContext*)avctx->priv_data;
+
+    if (tap && !s->tap_buf) {
+        s->tap_buf = av_malloc(s->frame_len * (4 * sizeof(float) + sizeof(int)));
+        if (!s->tap_buf)
+            return -1;
     }
-    
+    s->spectrum_tap = tap;
+    s->spectrum_opaque = opaque;
+    s->spectrum_flags = tap ? flags : 0;
     return 0;
 }
 
@@ -0,0 +1,5583 @@
+/**
+ * @file wmavlc.h
+ * WMA VLC decoding tables, generated by tools/vlcgen.cpp from the
+ * codes in wmadata.h. Do not edit.
+ */
+
+#include "Wma_Decoder.h"
+
+namespace WMADECODER_NAMESPACE
+{
+
+static const VLC_TYPE scale_vlc_table[1088][2] = {
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1}, {60,1},
+    {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3},
+    {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3},
+    {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3},
+    {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3},
+    {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3},
+    {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3},
+    {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3},
+    {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3}, {59,3},
+    {61,4}, {61,4}, {61,4}, {61,4}, {61,4}, {61,4}, {61,4}, {61,4},
+    {61,4}, {61,4}, {61,4}, {61,4}, {61,4}, {61,4}, {61,4}, {61,4},
+    {61,4}, {61,4}, {61,4}, {61,4}, {61,4}, {61,4}, {61,4}, {61,4},
+    {61,4}, {61,4}, {61,4}, {61,4}, {61,4}, {61,4}, {61,4}, {61,4},
+    {58,4}, {58,4}, {58,4}, {58,4}, {58,4}, {58,4}, {58,4}, {58,4},
+    {58,4}, {58,4}, {58,4}, {58,4}, {58,4}, {58,4}, {58,4}, {58,4},
+    {58,4}, {58,4}, {58,4}, {58,4}, {58,4}, {58,4}, {58,4}, {58,4},
+    {58,4}, {58,4}, {58,4}, {58,4}, {58,4}, {58,4}, {58,4}, {58,4},
+    {62,4}, {62,4}, {62,4}, {62,4}, {62,4}, {62,4}, {62,4}, {62,4},
+    {62,4}, {62,4}, {62,4}, {62,4}, {62,4}, {62,4}, {62,4}, {62,4},
+    {62,4}, {62,4}, {62,4}, {62,4}, {62,4}, {62,4}, {62,4}, {62,4},
+    {62,4}, {62,4}, {62,4}, {62,4}, {62,4}, {62,4}, {62,4}, {62,4},
+    {57,5}, {57,5}, {57,5}, {57,5}, {57,5}, {57,5}, {57,5}, {57,5},
+    {57,5}, {57,5}, {57,5}, {57,5}, {57,5}, {57,5}, {57,5}, {57,5},
+    {63,5}, {63,5}, {63,5}, {63,5}, {63,5}, {63,5}, {63,5}, {63,5},
+    {63,5}, {63,5}, {63,5}, {63,5}, {63,5}, {63,5}, {63,5}, {63,5},
+    {56,6}, {56,6}, {56,6}, {56,6}, {56,6}, {56,6}, {56,6}, {56,6},
+    {64,6}, {64,6}, {64,6}, {64,6}, {64,6}, {64,6}, {64,6}, {64,6},
+    {55,6}, {55,6}, {55,6}, {55,6}, {55,6}, {55,6}, {55,6}, {55,6},
+    {65,6}, {65,6}, {65,6}, {65,6}, {65,6}, {65,6}, {65,6}, {65,6},
+    {66,7}, {66,7}, {66,7}, {66,7}, {54,7}, {54,7}, {54,7}, {54,7},
+    {67,7}, {67,7}, {67,7}, {67,7}, {53,8}, {53,8}, {68,8}, {68,8},
+    {52,8}, {52,8}, {69,8}, {69,8}, {51,8}, {51,8}, {70,9}, {50,9},
+    {49,9}, {71,9}, {512,-1}, {514,-1}, {516,-1}, {518,-2}, {522,-3}, {530,-9},
+    {72,1}, {48,1}, {73,1}, {47,1}, {74,1}, {46,1}, {76,2}, {75,2},
+    {77,2}, {78,2}, {45,2}, {45,2}, {43,2}, {43,2}, {44,3}, {79,3},
+    {42,3}, {41,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3},
+    {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3},
+    {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3},
+    {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3},
+    {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3},
+    {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3},
+    {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3},
+    {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3}, {80,3},
+    {80,3}, {80,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3},
+    {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3},
+    {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3},
+    {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3},
+    {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3},
+    {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3},
+    {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3},
+    {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3}, {40,3},
+    {40,3}, {40,3}, {81,4}, {81,4}, {81,4}, {81,4}, {81,4}, {81,4},
+    {81,4}, {81,4}, {81,4}, {81,4}, {81,4}, {81,4}, {81,4}, {81,4},
+    {81,4}, {81,4}, {81,4}, {81,4}, {81,4}, {81,4}, {81,4}, {81,4},
+    {81,4}, {81,4}, {81,4}, {81,4}, {81,4}, {81,4}, {81,4}, {81,4},
+    {81,4}, {81,4}, {39,4}, {39,4}, {39,4}, {39,4}, {39,4}, {39,4},
+    {39,4}, {39,4}, {39,4}, {39,4}, {39,4}, {39,4}, {39,4}, {39,4},
+    {39,4}, {39,4}, {39,4}, {39,4}, {39,4}, {39,4}, {39,4}, {39,4},
+    {39,4}, {39,4}, {39,4}, {39,4}, {39,4}, {39,4}, {39,4}, {39,4},
+    {39,4}, {39,4}, {82,4}, {82,4}, {82,4}, {82,4}, {82,4}, {82,4},
+    {82,4}, {82,4}, {82,4}, {82,4}, {82,4}, {82,4}, {82,4}, {82,4},
+    {82,4}, {82,4}, {82,4}, {82,4}, {82,4}, {82,4}, {82,4}, {82,4},
+    {82,4}, {82,4}, {82,4}, {82,4}, {82,4}, {82,4}, {82,4}, {82,4},
+    {82,4}, {82,4}, {38,4}, {38,4}, {38,4}, {38,4}, {38,4}, {38,4},
+    {38,4}, {38,4}, {38,4}, {38,4}, {38,4}, {38,4}, {38,4}, {38,4},
+    {38,4}, {38,4}, {38,4}, {38,4}, {38,4}, {38,4}, {38,4}, {38,4},
+    {38,4}, {38,4}, {38,4}, {38,4}, {38,4}, {38,4}, {38,4}, {38,4},
+    {38,4}, {38,4}, {83,4}, {83,4}, {83,4}, {83,4}, {83,4}, {83,4},
+    {83,4}, {83,4}, {83,4}, {83,4}, {83,4}, {83,4}, {83,4}, {83,4},
+    {83,4}, {83,4}, {83,4}, {83,4}, {83,4}, {83,4}, {83,4}, {83,4},
+    {83,4}, {83,4}, {83,4}, {83,4}, {83,4}, {83,4}, {83,4}, {83,4},
+    {83,4}, {83,4}, {37,5}, {37,5}, {37,5}, {37,5}, {37,5}, {37,5},
+    {37,5}, {37,5}, {37,5}, {37,5}, {37,5}, {37,5}, {37,5}, {37,5},
+    {37,5}, {37,5}, {35,5}, {35,5}, {35,5}, {35,5}, {35,5}, {35,5},
+    {35,5}, {35,5}, {35,5}, {35,5}, {35,5}, {35,5}, {35,5}, {35,5},
+    {35,5}, {35,5}, {85,5}, {85,5}, {85,5}, {85,5}, {85,5}, {85,5},
+    {85,5}, {85,5}, {85,5}, {85,5}, {85,5}, {85,5}, {85,5}, {85,5},
+    {85,5}, {85,5}, {33,5}, {33,5}, {33,5}, {33,5}, {33,5}, {33,5},
+    {33,5}, {33,5}, {33,5}, {33,5}, {33,5}, {33,5}, {33,5}, {33,5},
+    {33,5}, {33,5}, {36,5}, {36,5}, {36,5}, {36,5}, {36,5}, {36,5},
+    {36,5}, {36,5}, {36,5}, {36,5}, {36,5}, {36,5}, {36,5}, {36,5},
+    {36,5}, {36,5}, {34,5}, {34,5}, {34,5}, {34,5}, {34,5}, {34,5},
+    {34,5}, {34,5}, {34,5}, {34,5}, {34,5}, {34,5}, {34,5}, {34,5},
+    {34,5}, {34,5}, {84,5}, {84,5}, {84,5}, {84,5}, {84,5}, {84,5},
+    {84,5}, {84,5}, {84,5}, {84,5}, {84,5}, {84,5}, {84,5}, {84,5},
+    {84,5}, {84,5}, {32,5}, {32,5}, {32,5}, {32,5}, {32,5}, {32,5},
+    {32,5}, {32,5}, {32,5}, {32,5}, {32,5}, {32,5}, {32,5}, {32,5},
+    {32,5}, {32,5}, {87,6}, {87,6}, {87,6}, {87,6}, {87,6}, {87,6},
+    {87,6}, {87,6}, {89,6}, {89,6}, {89,6}, {89,6}, {89,6}, {89,6},
+    {89,6}, {89,6}, {30,6}, {30,6}, {30,6}, {30,6}, {30,6}, {30,6},
+    {30,6}, {30,6}, {31,6}, {31,6}, {31,6}, {31,6}, {31,6}, {31,6},
+    {31,6}, {31,6}, {86,7}, {86,7}, {86,7}, {86,7}, {29,7}, {29,7},
+    {29,7}, {29,7}, {26,7}, {26,7}, {26,7}, {26,7}, {27,7}, {27,7},
+    {27,7}, {27,7}, {28,7}, {28,7}, {28,7}, {28,7}, {24,7}, {24,7},
+    {24,7}, {24,7}, {88,7}, {88,7}, {88,7}, {88,7}, {25,8}, {25,8},
+    {22,8}, {22,8}, {23,8}, {23,8}, {90,9}, {21,9}, {19,9}, {3,9},
+    {1,9}, {2,9}, {0,9}, {1042,-1}, {1044,-1}, {1046,-1}, {1048,-1}, {1050,-1},
+    {1052,-1}, {1054,-1}, {1056,-1}, {1058,-1}, {1060,-1}, {1062,-1}, {1064,-1}, {1066,-1},
+    {1068,-1}, {1070,-1}, {1072,-1}, {1074,-1}, {1076,-1}, {1078,-1}, {1080,-1}, {1082,-1},
+    {1084,-1}, {1086,-1}, {98,1}, {99,1}, {100,1}, {101,1}, {102,1}, {117,1},
+    {97,1}, {91,1}, {92,1}, {93,1}, {94,1}, {95,1}, {96,1}, {104,1},
+    {111,1}, {112,1}, {113,1}, {114,1}, {115,1}, {116,1}, {110,1}, {105,1},
+    {106,1}, {107,1}, {108,1}, {109,1}, {118,1}, {6,1}, {8,1}, {9,1},
+    {10,1}, {5,1}, {103,1}, {120,1}, {119,1}, {4,1}, {7,1}, {15,1},
+    {16,1}, {18,1}, {20,1}, {17,1}, {11,1}, {12,1}, {14,1}, {13,1},
+};
+
+static const VLC_TYPE hgain_vlc_table[532][2] = {
+    {512,-1}, {514,-1}, {31,9}, {30,9}, {23,8}, {23,8}, {7,8}, {7,8},
+    {29,8}, {29,8}, {26,8}, {26,8}, {24,7}, {24,7}, {24,7}, {24,7},
+    {10,5}, {10,5}, {10,5}, {10,5}, {10,5}, {10,5}, {10,5}, {10,5},
+    {10,5}, {10,5}, {10,5}, {10,5}, {10,5}, {10,5}, {10,5}, {10,5},
+    {12,4}, {12,4}, {12,4}, {12,4}, {12,4}, {12,4}, {12,4}, {12,4},
+    {12,4}, {12,4}, {12,4}, {12,4}, {12,4}, {12,4}, {12,4}, {12,4},
+    {12,4}, {12,4}, {12,4}, {12,4}, {12,4}, {12,4}, {12,4}, {12,4},
+    {12,4}, {12,4}, {12,4}, {12,4}, {12,4}, {12,4}, {12,4}, {12,4},
+    {20,5}, {20,5}, {20,5}, {20,5}, {20,5}, {20,5}, {20,5}, {20,5},
+    {20,5}, {20,5}, {20,5}, {20,5}, {20,5}, {20,5}, {20,5}, {20,5},
+    {22,6}, {22,6}, {22,6}, {22,6}, {22,6}, {22,6}, {22,6}, {22,6},
+    {8,7}, {8,7}, {8,7}, {8,7}, {516,-4}, {4,9}, {6,9}, {28,9},
+    {18,4}, {18,4}, {18,4}, {18,4}, {18,4}, {18,4}, {18,4}, {18,4},
+    {18,4}, {18,4}, {18,4}, {18,4}, {18,4}, {18,4}, {18,4}, {18,4},
+    {18,4}, {18,4}, {18,4}, {18,4}, {18,4}, {18,4}, {18,4}, {18,4},
+    {18,4}, {18,4}, {18,4}, {18,4}, {18,4}, {18,4}, {18,4}, {18,4},
+    {16,4}, {16,4}, {16,4}, {16,4}, {16,4}, {16,4}, {16,4}, {16,4},
+    {16,4}, {16,4}, {16,4}, {16,4}, {16,4}, {16,4}, {16,4}, {16,4},
+    {16,4}, {16,4}, {16,4}, {16,4}, {16,4}, {16,4}, {16,4}, {16,4},
+    {16,4}, {16,4}, {16,4}, {16,4}, {16,4}, {16,4}, {16,4}, {16,4},
+    {21,5}, {21,5}, {21,5}, {21,5}, {21,5}, {21,5}, {21,5}, {21,5},
+    {21,5}, {21,5}, {21,5}, {21,5}, {21,5}, {21,5}, {21,5}, {21,5},
+    {9,5}, {9,5}, {9,5}, {9,5}, {9,5}, {9,5}, {9,5}, {9,5},
+    {9,5}, {9,5}, {9,5}, {9,5}, {9,5}, {9,5}, {9,5}, {9,5},
+    {11,4}, {11,4}, {11,4}, {11,4}, {11,4}, {11,4}, {11,4}, {11,4},
+    {11,4}, {11,4}, {11,4}, {11,4}, {11,4}, {11,4}, {11,4}, {11,4},
+    {11,4}, {11,4}, {11,4}, {11,4}, {11,4}, {11,4}, {11,4}, {11,4},
+    {11,4}, {11,4}, {11,4}, {11,4}, {11,4}, {11,4}, {11,4}, {11,4},
+    {19,4}, {19,4}, {19,4}, {19,4}, {19,4}, {19,4}, {19,4}, {19,4},
+    {19,4}, {19,4}, {19,4}, {19,4}, {19,4}, {19,4}, {19,4}, {19,4},
+    {19,4}, {19,4}, {19,4}, {19,4}, {19,4}, {19,4}, {19,4}, {19,4},
+    {19,4}, {19,4}, {19,4}, {19,4}, {19,4}, {19,4}, {19,4}, {19,4},
+    {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3},
+    {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3},
+    {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3},
+    {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3},
+    {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3},
+    {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3},
+    {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3},
+    {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3}, {14,3},
+    {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3},
+    {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3},
+    {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3},
+    {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3},
+    {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3},
+    {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3},
+    {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3},
+    {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3}, {15,3},
+    {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3},
+    {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3},
+    {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3},
+    {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3},
+    {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3},
+    {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3},
+    {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3},
+    {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3}, {13,3},
+    {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3},
+    {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3},
+    {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3},
+    {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3},
+    {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3},
+    {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3},
+    {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3},
+    {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3}, {17,3},
+    {25,1}, {2,1}, {27,1}, {0,1}, {33,1}, {33,1}, {33,1}, {33,1},
+    {33,1}, {33,1}, {33,1}, {33,1}, {32,4}, {5,4}, {34,4}, {35,4},
+    {36,4}, {3,4}, {1,3}, {1,3},
+};
+
+static const RL_VLC_ELEM coef0_rl_vlc[7414] = {
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3},
+    {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3},
+    {1,8,19}, {1,8,19}, {512,-7,0}, {1,9,30}, {6,8,0}, {6,8,0}, {640,-9,0}, {2,9,3},
+    {1,7,11}, {1,7,11}, {1,7,11}, {1,7,11}, {1152,-4,0}, {1168,-3,0}, {1,9,31}, {1176,-7,0},
+    {8,9,0}, {1,9,33}, {1,9,32}, {1304,-8,0}, {1,8,20}, {1,8,20}, {1560,-9,0}, {2076,-6,0},
+    {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7},
+    {1,7,12}, {1,7,12}, {1,7,12}, {1,7,12}, {1,8,21}, {1,8,21}, {2140,-1,0}, {2142,-9,0},
+    {1,9,34}, {2654,-6,0}, {1,8,22}, {1,8,22}, {1,7,13}, {1,7,13}, {1,7,13}, {1,7,13},
+    {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4},
+    {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4},
+    {2718,-8,0}, {2974,-5,0}, {1,9,35}, {1,9,36}, {3006,-8,0}, {3262,-9,0}, {2,8,2}, {2,8,2},
+    {5,7,0}, {5,7,0}, {5,7,0}, {5,7,0}, {1,8,23}, {1,8,23}, {1,9,39}, {9,9,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8},
+    {1,7,14}, {1,7,14}, {1,7,14}, {1,7,14}, {3778,-9,0}, {1,9,40}, {1,9,37}, {4290,-8,0},
+    {1,9,38}, {4546,-8,0}, {1,8,24}, {1,8,24}, {1,7,15}, {1,7,15}, {1,7,15}, {1,7,15},
+    {2,9,4}, {4802,-5,0}, {7,8,0}, {7,8,0}, {1,8,25}, {1,8,25}, {4834,-3,0}, {4842,-8,0},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {3,8,1}, {3,8,1}, {1,8,26}, {1,8,26}, {1,7,16}, {1,7,16}, {1,7,16}, {1,7,16},
+    {4,6,0}, {4,6,0}, {4,6,0}, {4,6,0}, {4,6,0}, {4,6,0}, {4,6,0}, {4,6,0},
+    {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9},
+    {5098,-8,0}, {5354,-5,0}, {5386,-9,0}, {1,9,41}, {1,8,27}, {1,8,27}, {5900,-7,0}, {6028,-1,0},
+    {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0},
+    {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0},
+    {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5},
+    {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5},
+    {1,7,17}, {1,7,17}, {1,7,17}, {1,7,17}, {4,9,1}, {6030,-3,0}, {6038,-9,0}, {6550,-8,0},
+    {1,8,28}, {1,8,28}, {6806,-8,0}, {7062,-6,0}, {1,7,18}, {1,7,18}, {1,7,18}, {1,7,18},
+    {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10},
+    {2,6,1}, {2,6,1}, {2,6,1}, {2,6,1}, {2,6,1}, {2,6,1}, {2,6,1}, {2,6,1},
+    {1,8,29}, {1,8,29}, {7126,-6,0}, {7190,-5,0}, {1,9,42}, {7222,-7,0}, {7350,-6,0}, {10,9,0},
+    {0,6,0}, {0,6,0}, {0,6,0}, {0,6,0}, {0,6,0}, {0,6,0}, {0,6,0}, {0,6,0},
+    {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6},
+    {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6},
+    {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61},
+    {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61},
+    {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61},
+    {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61}, {1,2,61},
+    {1,5,117}, {1,5,117}, {1,5,117}, {1,5,117}, {3,5,11}, {3,5,11}, {3,5,11}, {3,5,11},
+    {5,5,5}, {5,5,5}, {5,5,5}, {5,5,5}, {1,7,202}, {2,7,55}, {6,7,6}, {47,7,0},
+    {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99},
+    {2,6,60}, {2,6,60}, {3,6,20}, {3,6,20}, {27,5,0}, {27,5,0}, {27,5,0}, {27,5,0},
+    {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5},
+    {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5},
+    {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5},
+    {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5},
+    {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5},
+    {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5},
+    {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5},
+    {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5}, {2,1,5},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100},
+    {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100},
+    {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100},
+    {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100}, {1,4,100},
+    {1,5,125}, {1,5,125}, {1,5,125}, {1,5,125}, {1,5,125}, {1,5,125}, {1,5,125}, {1,5,125},
+    {1,5,125}, {1,5,125}, {1,5,125}, {1,5,125}, {1,5,125}, {1,5,125}, {1,5,125}, {1,5,125},
+    {3,6,22}, {3,6,22}, {3,6,22}, {3,6,22}, {3,6,22}, {3,6,22}, {3,6,22}, {3,6,22},
+    {6,9,13}, {5,9,15}, {2,9,83}, {3,9,50}, {4,9,30}, {1,9,283}, {4,9,26}, {11,9,3},
+    {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104},
+    {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104},
+    {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104},
+    {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104}, {1,4,104},
+    {7,5,2}, {7,5,2}, {7,5,2}, {7,5,2}, {7,5,2}, {7,5,2}, {7,5,2}, {7,5,2},
+    {7,5,2}, {7,5,2}, {7,5,2}, {7,5,2}, {7,5,2}, {7,5,2}, {7,5,2}, {7,5,2},
+    {1,8,227}, {1,8,227}, {11,8,4}, {11,8,4}, {12,8,2}, {12,8,2}, {9,8,5}, {9,8,5},
+    {1,8,302}, {1,8,302}, {3,8,53}, {3,8,53}, {1,8,255}, {1,8,255}, {1,8,246}, {1,8,246},
+    {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59},
+    {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59},
+    {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59},
+    {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59},
+    {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59},
+    {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59},
+    {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59},
+    {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59},
+    {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59},
+    {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59},
+    {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59},
+    {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59},
+    {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59},
+    {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59},
+    {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59},
+    {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59}, {1,2,59},
+    {4,8,43}, {4,8,43}, {5,8,18}, {5,8,18}, {1,8,248}, {1,8,248}, {1,8,236}, {1,8,236},
+    {1,8,258}, {1,8,258}, {1,8,263}, {1,8,263}, {60,8,0}, {60,8,0}, {49,8,0}, {49,8,0},
+    {1,8,275}, {1,8,275}, {6,8,16}, {6,8,16}, {1,8,277}, {1,8,277}, {6,8,10}, {6,8,10},
+    {1,7,189}, {1,7,189}, {1,7,189}, {1,7,189}, {1,7,193}, {1,7,193}, {1,7,193}, {1,7,193},
+    {4,7,21}, {4,7,21}, {4,7,21}, {4,7,21}, {4,7,14}, {4,7,14}, {4,7,14}, {4,7,14},
+    {3,7,36}, {3,7,36}, {3,7,36}, {3,7,36}, {1,7,233}, {1,7,233}, {1,7,233}, {1,7,233},
+    {6,6,5}, {6,6,5}, {6,6,5}, {6,6,5}, {6,6,5}, {6,6,5}, {6,6,5}, {6,6,5},
+    {1,6,172}, {1,6,172}, {1,6,172}, {1,6,172}, {1,6,172}, {1,6,172}, {1,6,172}, {1,6,172},
+    {1,5,130}, {1,5,130}, {1,5,130}, {1,5,130}, {1,5,130}, {1,5,130}, {1,5,130}, {1,5,130},
+    {1,5,130}, {1,5,130}, {1,5,130}, {1,5,130}, {1,5,130}, {1,5,130}, {1,5,130}, {1,5,130},
+    {3,6,27}, {3,6,27}, {3,6,27}, {3,6,27}, {3,6,27}, {3,6,27}, {3,6,27}, {3,6,27},
+    {1,6,177}, {1,6,177}, {1,6,177}, {1,6,177}, {1,6,177}, {1,6,177}, {1,6,177}, {1,6,177},
+    {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5},
+    {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5},
+    {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5},
+    {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5},
+    {1,2,57}, {1,2,57}, {1,2,57}, {1,2,57}, {1,3,75}, {1,3,75}, {22,4,0}, {1,4,108},
+    {1,1,43}, {1,1,43}, {1,1,43}, {1,1,43}, {1,1,43}, {1,1,43}, {1,1,43}, {1,1,43},
+    {1,1,44}, {1,1,44}, {1,1,44}, {1,1,44}, {17,3,0}, {2,3,15}, {1,3,77}, {2,3,13},
+    {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58},
+    {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58},
+    {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58},
+    {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58}, {1,2,58},
+    {2,4,22}, {2,4,22}, {2,4,22}, {2,4,22}, {2,4,22}, {2,4,22}, {2,4,22}, {2,4,22},
+    {1,7,199}, {41,7,0}, {1,6,163}, {1,6,163}, {3,6,29}, {3,6,29}, {34,6,0}, {34,6,0},
+    {1,3,80}, {1,3,80}, {1,3,80}, {1,3,80}, {1,3,80}, {1,3,80}, {1,3,80}, {1,3,80},
+    {1,3,80}, {1,3,80}, {1,3,80}, {1,3,80}, {1,3,80}, {1,3,80}, {1,3,80}, {1,3,80},
+    {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45},
+    {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45},
+    {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45},
+    {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45},
+    {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45},
+    {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45},
+    {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45},
+    {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45}, {1,1,45},
+    {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78},
+    {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78},
+    {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78},
+    {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78},
+    {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14},
+    {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14},
+    {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14},
+    {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14},
+    {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0},
+    {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0},
+    {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0},
+    {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0},
+    {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0},
+    {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0},
+    {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0},
+    {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0},
+    {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9},
+    {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9},
+    {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9},
+    {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9},
+    {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9},
+    {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9},
+    {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9},
+    {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9}, {2,2,9},
+    {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6},
+    {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6},
+    {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6},
+    {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6},
+    {1,7,230}, {1,7,230}, {3,8,48}, {7,8,6}, {4,6,11}, {4,6,11}, {4,6,11}, {4,6,11},
+    {1,8,228}, {4,8,38}, {1,8,284}, {1,8,294}, {4,8,35}, {56,8,0}, {2,8,69}, {2,8,81},
+    {2,8,77}, {4,8,25}, {1,7,209}, {1,7,209}, {8,7,4}, {8,7,4}, {10,7,2}, {10,7,2},
+    {1,7,216}, {1,7,216}, {1,7,210}, {1,7,210}, {1,7,196}, {1,7,196}, {6,7,8}, {6,7,8},
+    {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82},
+    {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82},
+    {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82},
+    {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82},
+    {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82},
+    {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82},
+    {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82},
+    {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82}, {1,3,82},
+    {3,7,32}, {3,7,32}, {3,7,32}, {3,7,32}, {43,7,0}, {43,7,0}, {43,7,0}, {43,7,0},
+    {1,6,162}, {1,6,162}, {1,6,162}, {1,6,162}, {1,6,162}, {1,6,162}, {1,6,162}, {1,6,162},
+    {1,6,185}, {1,6,185}, {1,6,185}, {1,6,185}, {1,6,185}, {1,6,185}, {1,6,185}, {1,6,185},
+    {3,6,24}, {3,6,24}, {3,6,24}, {3,6,24}, {3,6,24}, {3,6,24}, {3,6,24}, {3,6,24},
+    {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36},
+    {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36},
+    {28,5,0}, {28,5,0}, {28,5,0}, {28,5,0}, {28,5,0}, {28,5,0}, {28,5,0}, {28,5,0},
+    {28,5,0}, {28,5,0}, {28,5,0}, {28,5,0}, {28,5,0}, {28,5,0}, {28,5,0}, {28,5,0},
+    {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16},
+    {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16},
+    {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16},
+    {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16},
+    {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16},
+    {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16},
+    {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16},
+    {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16},
+    {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126},
+    {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126},
+    {3,6,21}, {3,6,21}, {3,6,21}, {3,6,21}, {3,6,21}, {3,6,21}, {3,6,21}, {3,6,21},
+    {2,6,57}, {2,6,57}, {2,6,57}, {2,6,57}, {2,6,57}, {2,6,57}, {2,6,57}, {2,6,57},
+    {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26},
+    {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26},
+    {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26},
+    {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26},
+    {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106},
+    {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106},
+    {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106},
+    {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106},
+    {1,5,127}, {1,5,127}, {1,5,127}, {1,5,127}, {1,5,127}, {1,5,127}, {1,5,127}, {1,5,127},
+    {1,5,127}, {1,5,127}, {1,5,127}, {1,5,127}, {1,5,127}, {1,5,127}, {1,5,127}, {1,5,127},
+    {1,6,182}, {1,6,182}, {1,6,182}, {1,6,182}, {1,6,182}, {1,6,182}, {1,6,182}, {1,6,182},
+    {9,6,2}, {9,6,2}, {9,6,2}, {9,6,2}, {9,6,2}, {9,6,2}, {9,6,2}, {9,6,2},
+    {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79},
+    {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79},
+    {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79},
+    {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79},
+    {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79},
+    {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79},
+    {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79},
+    {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79},
+    {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74},
+    {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74},
+    {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74},
+    {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74},
+    {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74},
+    {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74},
+    {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74},
+    {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74},
+    {1,5,129}, {1,5,129}, {1,5,129}, {1,5,129}, {1,5,129}, {1,5,129}, {1,5,129}, {1,5,129},
+    {1,5,129}, {1,5,129}, {1,5,129}, {1,5,129}, {1,5,129}, {1,5,129}, {1,5,129}, {1,5,129},
+    {5,8,17}, {5,8,17}, {2072,-1,0}, {2074,-1,0}, {1,7,191}, {1,7,191}, {1,7,191}, {1,7,191},
+    {1,7,201}, {1,7,201}, {1,7,201}, {1,7,201}, {4,7,37}, {4,7,37}, {4,7,37}, {4,7,37},
+    {1,7,217}, {1,7,217}, {1,7,217}, {1,7,217}, {17,7,1}, {17,7,1}, {17,7,1}, {17,7,1},
+    {44,7,0}, {44,7,0}, {44,7,0}, {44,7,0}, {51,7,0}, {51,7,0}, {51,7,0}, {51,7,0},
+    {1,7,241}, {1,7,241}, {1,7,241}, {1,7,241}, {1,7,190}, {1,7,190}, {1,7,190}, {1,7,190},
+    {1,7,203}, {1,7,203}, {1,7,203}, {1,7,203}, {3,7,58}, {3,7,58}, {3,7,58}, {3,7,58},
+    {4,1,48}, {1,1,289}, {4,1,49}, {1,1,287}, {1,6,169}, {7,6,4}, {1,5,143}, {1,5,143},
+    {1,5,138}, {1,5,138}, {1,5,128}, {1,5,128}, {7,3,1}, {7,3,1}, {7,3,1}, {7,3,1},
+    {7,3,1}, {7,3,1}, {7,3,1}, {7,3,1}, {6,5,3}, {6,5,3}, {1,6,183}, {1,6,175},
+    {9,4,1}, {9,4,1}, {9,4,1}, {9,4,1}, {2,4,28}, {2,4,28}, {2,4,28}, {2,4,28},
+    {1,4,122}, {1,4,122}, {1,4,122}, {1,4,122}, {1,1,46}, {1,1,46}, {1,1,46}, {1,1,46},
+    {1,1,46}, {1,1,46}, {1,1,46}, {1,1,46}, {1,1,46}, {1,1,46}, {1,1,46}, {1,1,46},
+    {1,1,46}, {1,1,46}, {1,1,46}, {1,1,46}, {1,1,46}, {1,1,46}, {1,1,46}, {1,1,46},
+    {1,1,46}, {1,1,46}, {1,1,46}, {1,1,46}, {1,1,46}, {1,1,46}, {1,1,46}, {1,1,46},
+    {1,1,46}, {1,1,46}, {1,1,46}, {1,1,46}, {3,1,2}, {1,1,47}, {4,3,3}, {4,3,3},
+    {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3},
+    {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3},
+    {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3},
+    {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3},
+    {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3},
+    {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3},
+    {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3},
+    {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {3,4,9}, {3,4,9},
+    {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9},
+    {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9},
+    {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9},
+    {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {1,4,109}, {1,4,109},
+    {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109},
+    {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109},
+    {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109},
+    {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109}, {1,4,109}, {3,5,17}, {3,5,17},
+    {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17},
+    {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17}, {1,9,296}, {1,9,276},
+    {2,9,89}, {1,9,290}, {4,9,45}, {4,9,46}, {7,9,8}, {1,9,314}, {2,9,74}, {1,9,282},
+    {2,9,66}, {1,9,300}, {2,9,85}, {4,9,56}, {1,8,274}, {1,8,274}, {3,8,51}, {3,8,51},
+    {2,8,68}, {2,8,68}, {1,8,226}, {1,8,226}, {1,8,259}, {1,8,259}, {2,8,72}, {2,8,72},
+    {1,8,286}, {1,8,286}, {1,8,301}, {1,8,301}, {1,8,306}, {1,8,306}, {1,8,313}, {1,8,313},
+    {1,8,231}, {1,8,231}, {3,8,56}, {3,8,56}, {1,8,269}, {1,8,269}, {1,8,238}, {1,8,238},
+    {2,8,90}, {2,8,90}, {3,8,59}, {3,8,59}, {1,8,304}, {1,8,304}, {2,8,75}, {2,8,75},
+    {59,8,0}, {59,8,0}, {13,8,2}, {13,8,2}, {7,8,9}, {7,8,9}, {3,7,46}, {3,7,46},
+    {3,7,46}, {3,7,46}, {1,7,214}, {1,7,214}, {1,7,214}, {1,7,214}, {5,7,12}, {5,7,12},
+    {5,7,12}, {5,7,12}, {46,7,0}, {46,7,0}, {46,7,0}, {46,7,0}, {1,7,198}, {1,7,198},
+    {1,7,198}, {1,7,198}, {1,7,220}, {1,7,220}, {1,7,220}, {1,7,220}, {2,6,58}, {2,6,58},
+    {2,6,58}, {2,6,58}, {2,6,58}, {2,6,58}, {2,6,58}, {2,6,58}, {35,6,0}, {35,6,0},
+    {35,6,0}, {35,6,0}, {35,6,0}, {35,6,0}, {35,6,0}, {35,6,0}, {2,6,56}, {2,6,56},
+    {2,6,56}, {2,6,56}, {2,6,56}, {2,6,56}, {2,6,56}, {2,6,56}, {1,6,167}, {1,6,167},
+    {1,6,167}, {1,6,167}, {1,6,167}, {1,6,167}, {1,6,167}, {1,6,167}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {3,6,28}, {1,6,157},
+    {3,5,15}, {3,5,15}, {1,4,107}, {1,4,107}, {1,4,107}, {1,4,107}, {2,4,23}, {2,4,23},
+    {2,4,23}, {2,4,23}, {29,5,0}, {29,5,0}, {3,6,23}, {1,6,165}, {2,4,39}, {2,4,39},
+    {2,4,39}, {2,4,39}, {36,6,0}, {2,6,53}, {2,6,54}, {1,6,170}, {1,3,85}, {1,3,85},
+    {1,3,85}, {1,3,85}, {1,3,85}, {1,3,85}, {1,3,85}, {1,3,85}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {1,3,83}, {1,3,83},
+    {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83},
+    {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83},
+    {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83},
+    {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83}, {1,3,83}, {4,5,8}, {4,5,8},
+    {4,5,8}, {4,5,8}, {4,5,8}, {4,5,8}, {4,5,8}, {4,5,8}, {2,5,44}, {2,5,44},
+    {2,5,44}, {2,5,44}, {2,5,44}, {2,5,44}, {2,5,44}, {2,5,44}, {5,4,3}, {5,4,3},
+    {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3},
+    {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3}, {1,3,90}, {1,3,90},
+    {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90},
+    {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90},
+    {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90},
+    {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90}, {2,4,25}, {2,4,25},
+    {2,4,25}, {2,4,25}, {2,4,25}, {2,4,25}, {2,4,25}, {2,4,25}, {2,4,25}, {2,4,25},
+    {2,4,25}, {2,4,25}, {2,4,25}, {2,4,25}, {2,4,25}, {2,4,25}, {7,8,7}, {6,8,11},
+    {45,7,0}, {45,7,0}, {1,7,208}, {1,7,208}, {1,7,215}, {1,7,215}, {1,7,223}, {1,7,223},
+    {1,7,225}, {1,7,225}, {7,6,3}, {7,6,3}, {7,6,3}, {7,6,3}, {4,6,15}, {4,6,15},
+    {4,6,15}, {4,6,15}, {2,6,51}, {2,6,51}, {2,6,51}, {2,6,51}, {1,5,140}, {1,5,140},
+    {1,5,140}, {1,5,140}, {1,5,140}, {1,5,140}, {1,5,140}, {1,5,140}, {3,4,10}, {3,4,10},
+    {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10},
+    {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,6,40}, {3,6,40},
+    {3,6,40}, {3,6,40}, {5,7,10}, {5,7,10}, {2,8,73}, {1,8,279}, {12,5,1}, {12,5,1},
+    {12,5,1}, {12,5,1}, {12,5,1}, {12,5,1}, {12,5,1}, {12,5,1}, {1,4,105}, {1,4,105},
+    {1,4,105}, {1,4,105}, {1,4,105}, {1,4,105}, {1,4,105}, {1,4,105}, {1,4,105}, {1,4,105},
+    {1,4,105}, {1,4,105}, {1,4,105}, {1,4,105}, {1,4,105}, {1,4,105}, {2,3,18}, {2,3,18},
+    {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18},
+    {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18},
+    {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18},
+    {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {1,5,136}, {1,5,136},
+    {1,5,136}, {1,5,136}, {1,5,136}, {1,5,136}, {1,5,136}, {1,5,136}, {1,6,244}, {1,6,244},
+    {1,6,244}, {1,6,244}, {1,6,166}, {1,6,166}, {1,6,166}, {1,6,166}, {37,6,0}, {37,6,0},
+    {37,6,0}, {37,6,0}, {8,6,3}, {8,6,3}, {8,6,3}, {8,6,3}, {3,5,14}, {3,5,14},
+    {3,5,14}, {3,5,14}, {3,5,14}, {3,5,14}, {3,5,14}, {3,5,14}, {1,1,48}, {1,1,48},
+    {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48},
+    {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {2,3,17}, {2,3,17},
+    {2,3,17}, {2,3,17}, {1,5,144}, {3,5,19}, {2,4,40}, {2,4,40}, {18,3,0}, {18,3,0},
+    {18,3,0}, {18,3,0}, {1,3,84}, {1,3,84}, {1,3,84}, {1,3,84}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {2,4,27}, {2,4,27},
+    {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27},
+    {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27}, {3,5,16}, {3,5,16},
+    {3,5,16}, {3,5,16}, {3,5,16}, {3,5,16}, {3,5,16}, {3,5,16}, {1,8,239}, {2,8,91},
+    {1,8,273}, {1,8,308}, {1,8,251}, {1,8,252}, {1,8,253}, {2,8,64}, {4,4,6}, {4,4,6},
+    {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6},
+    {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {21,8,1}, {1,8,267},
+    {2,8,82}, {4,8,36}, {5,7,11}, {5,7,11}, {1,7,197}, {1,7,197}, {1,7,205}, {1,7,205},
+    {3,7,35}, {3,7,35}, {1,6,158}, {1,6,158}, {1,6,158}, {1,6,158}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {1,3,87}, {1,3,87},
+    {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87},
+    {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87},
+    {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87},
+    {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87}, {19,3,0}, {19,3,0},
+    {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0},
+    {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0},
+    {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0},
+    {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0}, {19,3,0}, {1,6,174}, {1,6,174},
+    {1,6,174}, {1,6,174}, {1,6,174}, {1,6,174}, {1,6,174}, {1,6,174}, {2,6,49}, {2,6,49},
+    {2,6,49}, {2,6,49}, {2,6,49}, {2,6,49}, {2,6,49}, {2,6,49}, {2,5,45}, {2,5,45},
+    {2,5,45}, {2,5,45}, {2,5,45}, {2,5,45}, {2,5,45}, {2,5,45}, {2,5,45}, {2,5,45},
+    {2,5,45}, {2,5,45}, {2,5,45}, {2,5,45}, {2,5,45}, {2,5,45}, {2,6,50}, {2,6,50},
+    {2,6,50}, {2,6,50}, {2,6,50}, {2,6,50}, {2,6,50}, {2,6,50}, {1,7,212}, {1,7,212},
+    {1,7,212}, {1,7,212}, {1,8,281}, {1,8,281}, {3774,-2,0}, {4,9,34}, {2,6,52}, {2,6,52},
+    {2,6,52}, {2,6,52}, {2,6,52}, {2,6,52}, {2,6,52}, {2,6,52}, {1,6,173}, {1,6,173},
+    {1,6,173}, {1,6,173}, {1,6,173}, {1,6,173}, {1,6,173}, {1,6,173}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {6,2,1}, {6,2,1},
+    {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1},
+    {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1},
+    {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1},
+    {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1},
+    {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1},
+    {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1},
+    {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1},
+    {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1},
+    {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1},
+    {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1},
+    {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1},
+    {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1},
+    {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1},
+    {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1},
+    {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1},
+    {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {6,2,1}, {2,5,43}, {2,5,43},
+    {2,5,43}, {2,5,43}, {2,5,43}, {2,5,43}, {2,5,43}, {2,5,43}, {2,5,43}, {2,5,43},
+    {2,5,43}, {2,5,43}, {2,5,43}, {2,5,43}, {2,5,43}, {2,5,43}, {1,6,161}, {1,6,161},
+    {1,6,161}, {1,6,161}, {1,6,161}, {1,6,161}, {1,6,161}, {1,6,161}, {2,7,76}, {2,7,76},
+    {2,7,76}, {2,7,76}, {1,7,229}, {1,7,229}, {1,7,229}, {1,7,229}, {2,4,29}, {2,4,29},
+    {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29},
+    {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29},
+    {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29},
+    {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29}, {2,4,29}, {5,3,2}, {5,3,2},
+    {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2},
+    {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2},
+    {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2},
+    {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2},
+    {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2},
+    {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2},
+    {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2},
+    {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {5,3,2}, {1,3,91}, {1,3,91},
+    {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91},
+    {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91},
+    {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91},
+    {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91},
+    {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91},
+    {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91},
+    {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91},
+    {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {48,7,0}, {48,7,0},
+    {48,7,0}, {48,7,0}, {19,7,1}, {19,7,1}, {19,7,1}, {19,7,1}, {4,7,29}, {4,7,29},
+    {4,7,29}, {4,7,29}, {1,7,232}, {1,7,232}, {1,7,232}, {1,7,232}, {2,6,59}, {2,6,59},
+    {2,6,59}, {2,6,59}, {2,6,59}, {2,6,59}, {2,6,59}, {2,6,59}, {1,6,181}, {1,6,181},
+    {1,6,181}, {1,6,181}, {1,6,181}, {1,6,181}, {1,6,181}, {1,6,181}, {6,5,4}, {6,5,4},
+    {6,5,4}, {6,5,4}, {6,5,4}, {6,5,4}, {6,5,4}, {6,5,4}, {6,5,4}, {6,5,4},
+    {6,5,4}, {6,5,4}, {6,5,4}, {6,5,4}, {6,5,4}, {6,5,4}, {30,5,0}, {30,5,0},
+    {30,5,0}, {30,5,0}, {30,5,0}, {30,5,0}, {30,5,0}, {30,5,0}, {30,5,0}, {30,5,0},
+    {30,5,0}, {30,5,0}, {30,5,0}, {30,5,0}, {30,5,0}, {30,5,0}, {4,1,52}, {4,1,52},
+    {4,2,51}, {4,2,55}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4},
+    {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4},
+    {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4},
+    {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4},
+    {5,4,4}, {5,4,4}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1},
+    {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1},
+    {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1},
+    {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1},
+    {10,4,1}, {10,4,1}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86},
+    {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86},
+    {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86},
+    {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86},
+    {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86},
+    {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86},
+    {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86},
+    {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86},
+    {1,3,86}, {1,3,86}, {1,5,132}, {1,5,132}, {1,5,132}, {1,5,132}, {1,5,132}, {1,5,132},
+    {1,5,132}, {1,5,132}, {1,5,132}, {1,5,132}, {1,5,132}, {1,5,132}, {1,5,132}, {1,5,132},
+    {1,5,132}, {1,5,132}, {3,7,42}, {3,7,42}, {3,7,42}, {3,7,42}, {1,9,293}, {3,9,54},
+    {4,9,58}, {1,9,303}, {7,6,5}, {7,6,5}, {7,6,5}, {7,6,5}, {7,6,5}, {7,6,5},
+    {7,6,5}, {7,6,5}, {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30},
+    {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30},
+    {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30},
+    {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30},
+    {2,4,30}, {2,4,30}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88},
+    {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88},
+    {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88},
+    {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88},
+    {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88},
+    {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88},
+    {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88},
+    {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88},
+    {1,3,88}, {1,3,88}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19},
+    {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19},
+    {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19},
+    {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19},
+    {2,3,19}, {2,3,19}, {1,6,168}, {1,6,168}, {1,6,168}, {1,6,168}, {1,6,195}, {1,6,195},
+    {1,6,195}, {1,6,195}, {2,5,47}, {2,5,47}, {2,5,47}, {2,5,47}, {2,5,47}, {2,5,47},
+    {2,5,47}, {2,5,47}, {1,5,135}, {1,5,135}, {1,5,135}, {1,5,135}, {1,5,135}, {1,5,135},
+    {1,5,135}, {1,5,135}, {1,6,180}, {1,6,180}, {1,6,180}, {1,6,180}, {1,8,266}, {4,8,47},
+    {4,8,59}, {4,8,41}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62},
+    {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62},
+    {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62},
+    {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62},
+    {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62},
+    {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62},
+    {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62},
+    {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62}, {1,2,62},
+    {1,2,62}, {1,2,62}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24},
+    {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24},
+    {2,4,24}, {2,4,24}, {6,4,2}, {6,4,2}, {6,4,2}, {6,4,2}, {6,4,2}, {6,4,2},
+    {6,4,2}, {6,4,2}, {6,4,2}, {6,4,2}, {6,4,2}, {6,4,2}, {6,4,2}, {6,4,2},
+    {6,4,2}, {6,4,2}, {1,4,110}, {1,4,110}, {1,4,110}, {1,4,110}, {1,4,110}, {1,4,110},
+    {1,4,110}, {1,4,110}, {1,4,110}, {1,4,110}, {1,4,110}, {1,4,110}, {1,4,110}, {1,4,110},
+    {1,4,110}, {1,4,110}, {13,5,1}, {13,5,1}, {13,5,1}, {13,5,1}, {13,5,1}, {13,5,1},
+    {13,5,1}, {13,5,1}, {1,8,260}, {1,8,254}, {8,8,6}, {1,8,270}, {3,8,61}, {4,8,33},
+    {2,8,78}, {1,8,278}, {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123},
+    {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123},
+    {1,4,123}, {1,4,123}, {1,4,121}, {1,4,121}, {1,4,121}, {1,4,121}, {1,4,121}, {1,4,121},
+    {1,4,121}, {1,4,121}, {1,4,121}, {1,4,121}, {1,4,121}, {1,4,121}, {1,4,121}, {1,4,121},
+    {1,4,121}, {1,4,121}, {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89},
+    {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89},
+    {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89},
+    {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89},
+    {1,3,89}, {1,3,89}, {1,8,316}, {24,8,1}, {23,8,1}, {1,8,280}, {2,8,79}, {2,8,88},
+    {1,7,257}, {1,7,257}, {3,7,33}, {3,7,33}, {3,7,47}, {3,7,47}, {2,7,65}, {2,7,65},
+    {18,7,1}, {18,7,1}, {8,7,5}, {8,7,5}, {10,7,3}, {10,7,3}, {1,6,176}, {1,6,176},
+    {1,6,176}, {1,6,176}, {3,6,26}, {3,6,26}, {3,6,26}, {3,6,26}, {4,6,12}, {4,6,12},
+    {4,6,12}, {4,6,12}, {32,5,0}, {32,5,0}, {32,5,0}, {32,5,0}, {32,5,0}, {32,5,0},
+    {32,5,0}, {32,5,0}, {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9},
+    {4,5,9}, {4,5,9}, {2,5,48}, {2,5,48}, {2,5,48}, {2,5,48}, {2,5,48}, {2,5,48},
+    {2,5,48}, {2,5,48}, {1,5,146}, {1,5,146}, {1,5,146}, {1,5,146}, {1,5,146}, {1,5,146},
+    {1,5,146}, {1,5,146}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2},
+    {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2},
+    {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2},
+    {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2},
+    {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2},
+    {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2},
+    {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2},
+    {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2}, {4,2,2},
+    {4,2,2}, {4,2,2}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10},
+    {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10},
+    {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10},
+    {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10},
+    {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10},
+    {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10},
+    {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10},
+    {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10},
+    {2,2,10}, {2,2,10}, {1,5,156}, {1,5,156}, {1,5,156}, {1,5,156}, {1,5,156}, {1,5,156},
+    {1,5,156}, {1,5,156}, {1,6,171}, {1,6,171}, {1,6,171}, {1,6,171}, {1,6,179}, {1,6,179},
+    {1,6,179}, {1,6,179}, {1,4,111}, {1,4,111}, {1,4,111}, {1,4,111}, {1,4,111}, {1,4,111},
+    {1,4,111}, {1,4,111}, {1,4,111}, {1,4,111}, {1,4,111}, {1,4,111}, {1,4,111}, {1,4,111},
+    {1,4,111}, {1,4,111}, {1,5,133}, {1,5,133}, {1,5,133}, {1,5,133}, {1,5,133}, {1,5,133},
+    {1,5,133}, {1,5,133}, {3,6,37}, {3,6,37}, {3,6,37}, {3,6,37}, {3,6,39}, {3,6,39},
+    {3,6,39}, {3,6,39}, {1,5,184}, {1,5,184}, {1,5,184}, {1,5,184}, {1,5,184}, {1,5,184},
+    {1,5,184}, {1,5,184}, {1,5,154}, {1,5,154}, {1,5,154}, {1,5,154}, {1,5,154}, {1,5,154},
+    {1,5,154}, {1,5,154}, {12,1,0}, {12,1,0}, {12,1,0}, {12,1,0}, {12,1,0}, {12,1,0},
+    {12,1,0}, {12,1,0}, {12,1,0}, {12,1,0}, {12,1,0}, {12,1,0}, {12,1,0}, {12,1,0},
+    {12,1,0}, {12,1,0}, {1,2,67}, {1,2,67}, {1,2,67}, {1,2,67}, {1,2,67}, {1,2,67},
+    {1,2,67}, {1,2,67}, {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1}, {1,4,120}, {1,4,120},
+    {1,5,145}, {1,5,147}, {1,1,49}, {1,1,49}, {1,1,49}, {1,1,49}, {3,3,8}, {1,3,96},
+    {1,2,63}, {1,2,63}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50},
+    {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50},
+    {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50},
+    {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50},
+    {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50},
+    {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50},
+    {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50},
+    {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50},
+    {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50},
+    {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50},
+    {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50},
+    {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50},
+    {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50},
+    {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50},
+    {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50},
+    {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50}, {1,1,50},
+    {1,1,50}, {1,1,50}, {3,7,43}, {3,7,43}, {1,7,224}, {1,7,224}, {3,7,57}, {3,7,57},
+    {4,7,22}, {4,7,22}, {1,7,247}, {1,7,247}, {9,7,3}, {9,7,3}, {6,7,7}, {6,7,7},
+    {5,7,14}, {5,7,14}, {1,4,112}, {1,4,112}, {1,4,112}, {1,4,112}, {1,4,112}, {1,4,112},
+    {1,4,112}, {1,4,112}, {1,4,112}, {1,4,112}, {1,4,112}, {1,4,112}, {1,4,112}, {1,4,112},
+    {1,4,112}, {1,4,112}, {3,6,30}, {3,6,30}, {3,6,30}, {3,6,30}, {1,6,192}, {1,6,192},
+    {1,6,192}, {1,6,192}, {1,6,243}, {1,6,243}, {1,6,243}, {1,6,243}, {4,7,23}, {4,7,23},
+    {3,8,60}, {6,8,15}, {23,4,0}, {23,4,0}, {23,4,0}, {23,4,0}, {23,4,0}, {23,4,0},
+    {23,4,0}, {23,4,0}, {23,4,0}, {23,4,0}, {23,4,0}, {23,4,0}, {23,4,0}, {23,4,0},
+    {23,4,0}, {23,4,0}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68},
+    {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68},
+    {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68},
+    {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68},
+    {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68},
+    {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68},
+    {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68},
+    {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68},
+    {1,2,68}, {1,2,68}, {1,6,178}, {1,6,178}, {1,6,178}, {1,6,178}, {3,6,45}, {3,6,45},
+    {3,6,45}, {3,6,45}, {1,6,187}, {1,6,187}, {1,6,187}, {1,6,187}, {3,6,38}, {3,6,38},
+    {3,6,38}, {3,6,38}, {38,6,0}, {38,6,0}, {38,6,0}, {38,6,0}, {3,6,41}, {3,6,41},
+    {3,6,41}, {3,6,41}, {5,6,8}, {5,6,8}, {5,6,8}, {5,6,8}, {3,6,31}, {3,6,31},
+    {3,6,31}, {3,6,31}, {31,5,0}, {31,5,0}, {31,5,0}, {31,5,0}, {31,5,0}, {31,5,0},
+    {31,5,0}, {31,5,0}, {1,8,292}, {1,8,285}, {58,8,0}, {4,8,39}, {1,8,291}, {1,8,298},
+    {2,8,84}, {1,8,256}, {25,4,0}, {25,4,0}, {25,4,0}, {25,4,0}, {25,4,0}, {25,4,0},
+    {25,4,0}, {25,4,0}, {25,4,0}, {25,4,0}, {25,4,0}, {25,4,0}, {25,4,0}, {25,4,0},
+    {25,4,0}, {25,4,0}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65},
+    {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65},
+    {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65},
+    {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65},
+    {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65},
+    {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65},
+    {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65},
+    {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65},
+    {1,2,65}, {1,2,65}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64},
+    {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64},
+    {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64},
+    {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64},
+    {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64},
+    {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64},
+    {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64},
+    {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64},
+    {1,2,64}, {1,2,64}, {1,4,116}, {1,4,116}, {1,4,116}, {1,4,116}, {1,4,116}, {1,4,116},
+    {1,4,116}, {1,4,116}, {1,4,116}, {1,4,116}, {1,4,116}, {1,4,116}, {1,4,116}, {1,4,116},
+    {1,4,116}, {1,4,116}, {2,8,87}, {6,8,12}, {54,8,0}, {1,8,305}, {1,7,211}, {1,7,211},
+    {1,7,240}, {1,7,240}, {5,7,16}, {5,7,16}, {1,7,213}, {1,7,213}, {50,7,0}, {50,7,0},
+    {6,7,9}, {6,7,9}, {4,7,24}, {4,7,24}, {1,7,245}, {1,7,245}, {4,6,17}, {4,6,17},
+    {4,6,17}, {4,6,17}, {40,6,0}, {40,6,0}, {40,6,0}, {40,6,0}, {42,6,0}, {42,6,0},
+    {42,6,0}, {42,6,0}, {2,4,34}, {2,4,34}, {2,4,34}, {2,4,34}, {2,4,34}, {2,4,34},
+    {2,4,34}, {2,4,34}, {2,4,34}, {2,4,34}, {2,4,34}, {2,4,34}, {2,4,34}, {2,4,34},
+    {2,4,34}, {2,4,34}, {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51},
+    {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51},
+    {1,1,51}, {1,1,51}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69},
+    {1,2,69}, {1,2,69}, {1,4,114}, {1,4,114}, {2,5,46}, {1,5,134}, {1,5,164}, {1,5,152},
+    {2,4,33}, {2,4,33}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92},
+    {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92},
+    {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92},
+    {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92},
+    {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92},
+    {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92},
+    {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92},
+    {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92}, {1,3,92},
+    {1,3,92}, {1,3,92}, {1,5,131}, {1,5,131}, {1,5,131}, {1,5,131}, {1,5,131}, {1,5,131},
+    {1,5,131}, {1,5,131}, {1,5,131}, {1,5,131}, {1,5,131}, {1,5,131}, {1,5,131}, {1,5,131},
+    {1,5,131}, {1,5,131}, {1,7,315}, {1,7,315}, {1,7,315}, {1,7,315}, {1,8,307}, {1,8,307},
+    {5898,-1,0}, {4,9,53}, {2,6,61}, {2,6,61}, {2,6,61}, {2,6,61}, {2,6,61}, {2,6,61},
+    {2,6,61}, {2,6,61}, {4,5,10}, {4,5,10}, {4,5,10}, {4,5,10}, {4,5,10}, {4,5,10},
+    {4,5,10}, {4,5,10}, {4,5,10}, {4,5,10}, {4,5,10}, {4,5,10}, {4,5,10}, {4,5,10},
+    {4,5,10}, {4,5,10}, {3,5,18}, {3,5,18}, {3,5,18}, {3,5,18}, {3,5,18}, {3,5,18},
+    {3,5,18}, {3,5,18}, {3,5,18}, {3,5,18}, {3,5,18}, {3,5,18}, {3,5,18}, {3,5,18},
+    {3,5,18}, {3,5,18}, {1,5,159}, {1,5,159}, {1,5,159}, {1,5,159}, {1,5,159}, {1,5,159},
+    {1,5,159}, {1,5,159}, {1,5,159}, {1,5,159}, {1,5,159}, {1,5,159}, {1,5,159}, {1,5,159},
+    {1,5,159}, {1,5,159}, {1,5,141}, {1,5,141}, {1,5,141}, {1,5,141}, {1,5,141}, {1,5,141},
+    {1,5,141}, {1,5,141}, {1,5,141}, {1,5,141}, {1,5,141}, {1,5,141}, {1,5,141}, {1,5,141},
+    {1,5,141}, {1,5,141}, {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0},
+    {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0},
+    {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0},
+    {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0},
+    {24,4,0}, {24,4,0}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97},
+    {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97},
+    {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97},
+    {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97},
+    {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97},
+    {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97},
+    {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97},
+    {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97},
+    {1,3,97}, {1,3,97}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {4,1,54}, {3,1,55}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52},
+    {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52},
+    {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52},
+    {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52},
+    {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52},
+    {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52},
+    {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52},
+    {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52},
+    {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4},
+    {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4},
+    {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {1,5,139}, {1,5,139}, {1,5,139}, {1,5,139},
+    {1,6,242}, {1,6,242}, {53,7,0}, {2,7,71}, {3,7,52}, {2,7,70}, {11,7,2}, {20,7,1},
+    {52,7,0}, {55,7,0}, {14,7,2}, {4,7,42}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {5,1,1}, {1,1,53}, {1,3,93}, {20,3,0},
+    {2,2,11}, {2,2,11}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {4,7,40}, {4,7,40},
+    {4,7,40}, {4,7,40}, {9,7,4}, {9,7,4}, {9,7,4}, {9,7,4}, {39,6,0}, {39,6,0},
+    {39,6,0}, {39,6,0}, {39,6,0}, {39,6,0}, {39,6,0}, {39,6,0}, {3,6,25}, {3,6,25},
+    {3,6,25}, {3,6,25}, {3,6,25}, {3,6,25}, {3,6,25}, {3,6,25}, {1,6,186}, {1,6,186},
+    {1,6,186}, {1,6,186}, {1,6,186}, {1,6,186}, {1,6,186}, {1,6,186}, {1,5,153}, {1,5,153},
+    {1,5,153}, {1,5,153}, {1,5,153}, {1,5,153}, {1,5,153}, {1,5,153}, {1,5,153}, {1,5,153},
+    {1,5,153}, {1,5,153}, {1,5,153}, {1,5,153}, {1,5,153}, {1,5,153}, {16,6,1}, {16,6,1},
+    {16,6,1}, {16,6,1}, {16,6,1}, {16,6,1}, {16,6,1}, {16,6,1}, {4,7,27}, {4,7,27},
+    {4,7,27}, {4,7,27}, {4,9,44}, {6,9,14}, {3,8,49}, {3,8,49}, {2,3,21}, {2,3,21},
+    {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21},
+    {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21},
+    {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21},
+    {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21},
+    {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21},
+    {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21},
+    {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21},
+    {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {1,4,119}, {1,4,119},
+    {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119},
+    {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119},
+    {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119},
+    {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119}, {1,4,119}, {26,4,0}, {26,4,0},
+    {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0},
+    {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0},
+    {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0},
+    {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0}, {26,4,0}, {8,5,2}, {8,5,2},
+    {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2},
+    {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2}, {1,5,155}, {1,5,155},
+    {1,5,155}, {1,5,155}, {1,5,155}, {1,5,155}, {1,5,155}, {1,5,155}, {1,5,155}, {1,5,155},
+    {1,5,155}, {1,5,155}, {1,5,155}, {1,5,155}, {1,5,155}, {1,5,155}, {2,4,35}, {2,4,35},
+    {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35},
+    {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35},
+    {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35},
+    {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {1,2,71}, {1,2,71},
+    {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71},
+    {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71},
+    {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71},
+    {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71},
+    {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71},
+    {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71},
+    {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71},
+    {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71},
+    {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71},
+    {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71},
+    {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71},
+    {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71},
+    {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71},
+    {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71},
+    {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71},
+    {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,2,66}, {1,2,66},
+    {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66},
+    {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66},
+    {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66},
+    {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66},
+    {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66},
+    {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66},
+    {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66},
+    {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66},
+    {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66},
+    {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66},
+    {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66},
+    {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66},
+    {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66},
+    {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66},
+    {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66},
+    {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,66}, {1,2,70}, {1,2,70},
+    {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70},
+    {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70},
+    {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70},
+    {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70},
+    {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70},
+    {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70},
+    {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70},
+    {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,2,70}, {1,4,118}, {1,4,118},
+    {1,4,118}, {1,4,118}, {1,4,118}, {1,4,118}, {1,4,118}, {1,4,118}, {1,4,118}, {1,4,118},
+    {1,4,118}, {1,4,118}, {1,4,118}, {1,4,118}, {1,4,118}, {1,4,118}, {2,4,32}, {2,4,32},
+    {2,4,32}, {2,4,32}, {2,4,32}, {2,4,32}, {2,4,32}, {2,4,32}, {2,4,32}, {2,4,32},
+    {2,4,32}, {2,4,32}, {2,4,32}, {2,4,32}, {2,4,32}, {2,4,32}, {2,4,38}, {2,4,38},
+    {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38},
+    {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38}, {1,5,148}, {1,5,148},
+    {1,5,148}, {1,5,148}, {1,5,148}, {1,5,148}, {1,5,148}, {1,5,148}, {3,6,44}, {3,6,44},
+    {3,6,44}, {3,6,44}, {4,8,50}, {4,8,31}, {2,8,86}, {2,8,62}, {2,4,31}, {2,4,31},
+    {2,4,31}, {2,4,31}, {2,4,31}, {2,4,31}, {2,4,31}, {2,4,31}, {2,4,31}, {2,4,31},
+    {2,4,31}, {2,4,31}, {2,4,31}, {2,4,31}, {2,4,31}, {2,4,31}, {2,4,37}, {2,4,37},
+    {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37},
+    {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {1,4,115}, {1,4,115},
+    {1,4,115}, {1,4,115}, {1,4,115}, {1,4,115}, {1,4,115}, {1,4,115}, {1,4,115}, {1,4,115},
+    {1,4,115}, {1,4,115}, {1,4,115}, {1,4,115}, {1,4,115}, {1,4,115}, {1,4,124}, {1,4,124},
+    {1,4,124}, {1,4,124}, {1,4,124}, {1,4,124}, {1,4,124}, {1,4,124}, {1,4,124}, {1,4,124},
+    {1,4,124}, {1,4,124}, {1,4,124}, {1,4,124}, {1,4,124}, {1,4,124}, {1,2,72}, {1,2,72},
+    {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72},
+    {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72},
+    {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72},
+    {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72},
+    {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72},
+    {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72},
+    {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72},
+    {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,4,113}, {1,4,113},
+    {1,4,113}, {1,4,113}, {1,4,113}, {1,4,113}, {1,4,113}, {1,4,113}, {1,4,113}, {1,4,113},
+    {1,4,113}, {1,4,113}, {1,4,113}, {1,4,113}, {1,4,113}, {1,4,113}, {3,4,13}, {3,4,13},
+    {3,4,13}, {3,4,13}, {3,4,13}, {3,4,13}, {3,4,13}, {3,4,13}, {3,4,13}, {3,4,13},
+    {3,4,13}, {3,4,13}, {3,4,13}, {3,4,13}, {3,4,13}, {3,4,13}, {2,8,63}, {1,8,262},
+    {1,8,312}, {1,8,311}, {1,8,310}, {1,8,297}, {1,8,299}, {1,8,265}, {1,8,288}, {1,8,295},
+    {1,7,206}, {1,7,206}, {1,7,249}, {1,7,249}, {1,7,309}, {1,7,309}, {1,7,237}, {1,7,237},
+    {4,7,57}, {4,7,57}, {1,7,264}, {1,7,264}, {4,7,28}, {4,7,28}, {1,6,218}, {1,6,218},
+    {1,6,218}, {1,6,218}, {1,6,200}, {1,6,200}, {1,6,200}, {1,6,200}, {2,2,12}, {2,2,12},
+    {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12},
+    {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12},
+    {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12},
+    {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12},
+    {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12},
+    {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12},
+    {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12},
+    {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,55}, {1,1,55},
+    {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55},
+    {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55},
+    {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55},
+    {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {4,6,13}, {3,6,34},
+    {1,5,149}, {1,5,149}, {11,4,1}, {11,4,1}, {11,4,1}, {11,4,1}, {2,3,20}, {2,3,20},
+    {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {16,2,0}, {16,2,0},
+    {16,2,0}, {16,2,0}, {16,2,0}, {16,2,0}, {16,2,0}, {16,2,0}, {16,2,0}, {16,2,0},
+    {16,2,0}, {16,2,0}, {16,2,0}, {16,2,0}, {16,2,0}, {16,2,0}, {5,6,9}, {4,6,20},
+    {33,5,0}, {33,5,0}, {5,5,6}, {5,5,6}, {1,6,219}, {1,6,207}, {1,3,98}, {1,3,98},
+    {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,102}, {1,3,102},
+    {1,3,102}, {1,3,102}, {1,3,102}, {1,3,102}, {1,3,102}, {1,3,102}, {1,3,94}, {1,3,94},
+    {1,3,94}, {1,3,94}, {1,3,94}, {1,3,94}, {1,3,94}, {1,3,94}, {1,1,56}, {1,1,56},
+    {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56},
+    {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56},
+    {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56},
+    {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {14,5,1}, {1,5,151},
+    {2,4,42}, {2,4,42}, {2,4,41}, {2,4,41}, {1,5,160}, {1,5,150}, {1,2,81}, {1,2,81},
+    {1,2,81}, {1,2,81}, {1,2,81}, {1,2,81}, {1,2,81}, {1,2,81}, {1,2,76}, {1,2,76},
+    {1,2,76}, {1,2,76}, {1,2,76}, {1,2,76}, {1,2,76}, {1,2,76}, {1,4,137}, {1,4,137},
+    {3,4,12}, {3,4,12}, {1,3,95}, {1,3,95}, {1,3,95}, {1,3,95}, {1,2,73}, {1,2,73},
+    {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73},
+    {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73},
+    {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73},
+    {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73}, {1,7,234}, {1,7,250},
+    {5,7,13}, {57,7,0}, {1,7,221}, {2,7,80}, {10,7,4}, {2,7,67}, {1,7,261}, {1,7,271},
+    {1,7,268}, {4,7,32}, {1,7,272}, {1,7,235}, {4,6,16}, {4,6,16}, {1,6,188}, {1,6,188},
+    {4,6,19}, {4,6,19}, {1,6,204}, {1,6,204}, {1,6,222}, {1,6,222}, {4,4,7}, {4,4,7},
+    {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {13,1,0}, {13,1,0},
+    {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0},
+    {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0},
+    {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0},
+    {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0},
+    {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0},
+    {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0},
+    {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0},
+    {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {13,1,0}, {1,3,103}, {1,3,103},
+    {1,3,103}, {1,3,103}, {1,3,103}, {1,3,103}, {1,3,103}, {1,3,103}, {21,3,0}, {21,3,0},
+    {21,3,0}, {21,3,0}, {21,3,0}, {21,3,0}, {21,3,0}, {21,3,0}, {1,3,101}, {1,3,101},
+    {1,3,101}, {1,3,101}, {1,3,101}, {1,3,101}, {1,3,101}, {1,3,101}, {15,5,1}, {15,5,1},
+    {5,5,7}, {5,5,7}, {1,5,142}, {1,5,142}, {4,6,18}, {1,6,194}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+};
+
+static const RL_VLC_ELEM coef1_rl_vlc[3392] = {
+    {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1},
+    {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1},
+    {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1},
+    {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1},
+    {0,5,0}, {0,5,0}, {0,5,0}, {0,5,0}, {0,5,0}, {0,5,0}, {0,5,0}, {0,5,0},
+    {0,5,0}, {0,5,0}, {0,5,0}, {0,5,0}, {0,5,0}, {0,5,0}, {0,5,0}, {0,5,0},
+    {2,7,1}, {2,7,1}, {2,7,1}, {2,7,1}, {512,-7,0}, {640,-6,0}, {1,9,38}, {704,-5,0},
+    {3,6,0}, {3,6,0}, {3,6,0}, {3,6,0}, {3,6,0}, {3,6,0}, {3,6,0}, {3,6,0},
+    {1,6,6}, {1,6,6}, {1,6,6}, {1,6,6}, {1,6,6}, {1,6,6}, {1,6,6}, {1,6,6},
+    {2,9,4}, {736,-5,0}, {768,-5,0}, {800,-2,0}, {4,7,0}, {4,7,0}, {4,7,0}, {4,7,0},
+    {1,8,22}, {1,8,22}, {804,-9,0}, {1318,-1,0}, {1,8,23}, {1,8,23}, {1,8,26}, {1,8,26},
+    {1320,-4,0}, {1,9,43}, {1,8,21}, {1,8,21}, {1,7,11}, {1,7,11}, {1,7,11}, {1,7,11},
+    {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7},
+    {1336,-8,0}, {7,9,0}, {1,8,27}, {1,8,27}, {1,7,12}, {1,7,12}, {1,7,12}, {1,7,12},
+    {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3},
+    {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1592,-7,0}, {1720,-6,0}, {2,9,5}, {1,9,45}, {1784,-8,0}, {2040,-6,0}, {2,8,2}, {2,8,2},
+    {1,9,46}, {2104,-4,0}, {1,8,24}, {1,8,24}, {1,7,13}, {1,7,13}, {1,7,13}, {1,7,13},
+    {1,8,31}, {1,8,31}, {1,8,25}, {1,8,25}, {2120,-6,0}, {0,9,1}, {1,9,44}, {2184,-7,0},
+    {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8},
+    {1,8,28}, {1,8,28}, {1,8,29}, {1,8,29}, {1,7,14}, {1,7,14}, {1,7,14}, {1,7,14},
+    {1,8,30}, {1,8,30}, {2312,-5,0}, {1,9,47}, {2344,-4,0}, {1,9,48}, {1,9,50}, {2360,-4,0},
+    {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4},
+    {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4},
+    {1,7,15}, {1,7,15}, {1,7,15}, {1,7,15}, {2376,-7,0}, {2504,-6,0}, {2568,-1,0}, {1,9,60},
+    {6,8,0}, {6,8,0}, {2570,-6,0}, {2634,-5,0}, {1,9,51}, {2666,-1,0}, {1,8,40}, {1,8,40},
+    {1,7,17}, {1,7,17}, {1,7,17}, {1,7,17}, {1,7,16}, {1,7,16}, {1,7,16}, {1,7,16},
+    {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {2668,-6,0}, {2732,-3,0}, {1,8,32}, {1,8,32}, {2740,-3,0}, {2748,-2,0}, {2752,-6,0}, {1,9,53},
+    {1,9,49}, {2816,-3,0}, {1,8,36}, {1,8,36}, {1,8,33}, {1,8,33}, {2824,-4,0}, {2840,-3,0},
+    {1,7,19}, {1,7,19}, {1,7,19}, {1,7,19}, {2848,-7,0}, {1,9,61}, {8,9,0}, {2976,-5,0},
+    {3008,-3,0}, {3016,-3,0}, {1,8,41}, {1,8,41}, {1,7,18}, {1,7,18}, {1,7,18}, {1,7,18},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {3,8,1}, {3,8,1}, {3024,-4,0}, {1,9,52}, {1,8,37}, {1,8,37}, {1,8,35}, {1,8,35},
+    {2,8,3}, {2,8,3}, {1,9,59}, {3040,-3,0}, {2,9,6}, {3048,-2,0}, {3052,-7,0}, {3180,-2,0},
+    {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5},
+    {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5},
+    {1,8,39}, {1,8,39}, {3184,-6,0}, {3248,-4,0}, {1,8,34}, {1,8,34}, {1,9,58}, {1,9,54},
+    {5,7,0}, {5,7,0}, {5,7,0}, {5,7,0}, {1,7,20}, {1,7,20}, {1,7,20}, {1,7,20},
+    {3264,-3,0}, {3272,-5,0}, {3304,-6,0}, {3368,-3,0}, {3376,-4,0}, {2,9,7}, {1,8,42}, {1,8,42},
+    {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10},
+    {17,4,0}, {17,4,0}, {17,4,0}, {17,4,0}, {17,4,0}, {17,4,0}, {17,4,0}, {17,4,0},
+    {1,4,246}, {1,4,246}, {1,4,246}, {1,4,246}, {1,4,246}, {1,4,246}, {1,4,246}, {1,4,246},
+    {1,5,219}, {1,5,219}, {1,5,219}, {1,5,219}, {4,7,25}, {2,7,79}, {1,7,279}, {3,7,58},
+    {3,6,23}, {3,6,23}, {1,6,250}, {1,6,250}, {1,6,267}, {1,6,267}, {1,6,257}, {1,6,257},
+    {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87},
+    {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87},
+    {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87},
+    {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87}, {1,2,87},
+    {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57},
+    {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57},
+    {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57},
+    {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57},
+    {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57},
+    {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57},
+    {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57},
+    {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57},
+    {1,6,258}, {2,6,73}, {3,6,31}, {4,6,11}, {1,6,280}, {1,6,253}, {1,6,231}, {1,6,307},
+    {1,6,278}, {2,6,72}, {2,5,49}, {2,5,49}, {1,4,182}, {1,4,182}, {1,4,182}, {1,4,182},
+    {1,4,181}, {1,4,181}, {1,4,181}, {1,4,181}, {1,4,151}, {1,4,151}, {1,4,151}, {1,4,151},
+    {1,4,157}, {1,4,157}, {1,4,157}, {1,4,157}, {1,4,156}, {1,4,156}, {1,4,156}, {1,4,156},
+    {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1},
+    {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1},
+    {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1},
+    {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1}, {4,1,1},
+    {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {1,4,134}, {1,4,134}, {2,5,61}, {1,5,216},
+    {1,2,89}, {1,2,89}, {1,2,89}, {1,2,89}, {1,2,89}, {1,2,89}, {1,2,89}, {1,2,89},
+    {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55},
+    {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55}, {1,1,55},
+    {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10}, {2,2,10},
+    {1,3,119}, {1,3,119}, {1,3,119}, {1,3,119}, {1,4,142}, {1,4,142}, {10,5,1}, {3,5,19},
+    {1,2,122}, {1,2,122}, {1,2,122}, {1,2,122}, {1,2,122}, {1,2,122}, {1,2,122}, {1,2,122},
+    {1,2,92}, {1,2,92}, {1,2,92}, {1,2,92}, {1,2,92}, {1,2,92}, {1,2,92}, {1,2,92},
+    {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56},
+    {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56},
+    {1,5,208}, {3,5,16}, {2,5,47}, {5,5,6}, {2,4,42}, {2,4,42}, {2,4,33}, {2,4,33},
+    {1,2,91}, {1,2,91}, {1,2,91}, {1,2,91}, {1,2,91}, {1,2,91}, {1,2,91}, {1,2,91},
+    {5,2,1}, {1,2,86}, {2,1,8}, {2,1,8}, {1,5,175}, {1,5,175}, {1,5,175}, {1,5,175},
+    {1,5,175}, {1,5,175}, {1,5,175}, {1,5,175}, {1,5,175}, {1,5,175}, {1,5,175}, {1,5,175},
+    {1,5,175}, {1,5,175}, {1,5,175}, {1,5,175}, {3,7,38}, {3,7,38}, {3,7,38}, {3,7,38},
+    {3,9,46}, {1316,-1,0}, {2,8,87}, {2,8,87}, {15,6,1}, {15,6,1}, {15,6,1}, {15,6,1},
+    {15,6,1}, {15,6,1}, {15,6,1}, {15,6,1}, {1,4,155}, {1,4,155}, {1,4,155}, {1,4,155},
+    {1,4,155}, {1,4,155}, {1,4,155}, {1,4,155}, {1,4,155}, {1,4,155}, {1,4,155}, {1,4,155},
+    {1,4,155}, {1,4,155}, {1,4,155}, {1,4,155}, {1,4,155}, {1,4,155}, {1,4,155}, {1,4,155},
+    {1,4,155}, {1,4,155}, {1,4,155}, {1,4,155}, {1,4,155}, {1,4,155}, {1,4,155}, {1,4,155},
+    {1,4,155}, {1,4,155}, {1,4,155}, {1,4,155}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0},
+    {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0},
+    {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0},
+    {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0},
+    {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1},
+    {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1},
+    {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1},
+    {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1},
+    {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27},
+    {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27},
+    {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27},
+    {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27},
+    {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27},
+    {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27},
+    {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27},
+    {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27},
+    {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {1,6,284}, {1,6,284}, {1,6,284}, {1,6,284},
+    {1,6,284}, {1,6,284}, {1,6,284}, {1,6,284}, {3,6,24}, {3,6,24}, {3,6,24}, {3,6,24},
+    {3,6,24}, {3,6,24}, {3,6,24}, {3,6,24}, {2,6,75}, {2,6,75}, {2,6,75}, {2,6,75},
+    {2,6,75}, {2,6,75}, {2,6,75}, {2,6,75}, {1,6,282}, {1,6,282}, {1,6,282}, {1,6,282},
+    {1,6,282}, {1,6,282}, {1,6,282}, {1,6,282}, {1,6,287}, {1,6,287}, {1,6,287}, {1,6,287},
+    {1,6,287}, {1,6,287}, {1,6,287}, {1,6,287}, {1,6,236}, {1,6,236}, {1,6,236}, {1,6,236},
+    {1,6,236}, {1,6,236}, {1,6,236}, {1,6,236}, {2,6,56}, {2,6,56}, {2,6,56}, {2,6,56},
+    {2,6,56}, {2,6,56}, {2,6,56}, {2,6,56}, {31,6,0}, {31,6,0}, {31,6,0}, {31,6,0},
+    {31,6,0}, {31,6,0}, {31,6,0}, {31,6,0}, {1,5,210}, {1,5,210}, {1,5,210}, {1,5,210},
+    {1,5,210}, {1,5,210}, {1,5,210}, {1,5,210}, {1,5,210}, {1,5,210}, {1,5,210}, {1,5,210},
+    {1,5,210}, {1,5,210}, {1,5,210}, {1,5,210}, {3,5,14}, {3,5,14}, {3,5,14}, {3,5,14},
+    {3,5,14}, {3,5,14}, {3,5,14}, {3,5,14}, {3,5,14}, {3,5,14}, {3,5,14}, {3,5,14},
+    {3,5,14}, {3,5,14}, {3,5,14}, {3,5,14}, {5,5,5}, {5,5,5}, {5,5,5}, {5,5,5},
+    {5,5,5}, {5,5,5}, {5,5,5}, {5,5,5}, {5,5,5}, {5,5,5}, {5,5,5}, {5,5,5},
+    {5,5,5}, {5,5,5}, {5,5,5}, {5,5,5}, {1,5,200}, {1,5,200}, {1,5,200}, {1,5,200},
+    {1,5,200}, {1,5,200}, {1,5,200}, {1,5,200}, {1,5,200}, {1,5,200}, {1,5,200}, {1,5,200},
+    {1,5,200}, {1,5,200}, {1,5,200}, {1,5,200}, {3,5,20}, {3,5,20}, {3,5,20}, {3,5,20},
+    {3,5,20}, {3,5,20}, {3,5,20}, {3,5,20}, {3,5,20}, {3,5,20}, {3,5,20}, {3,5,20},
+    {3,5,20}, {3,5,20}, {3,5,20}, {3,5,20}, {1,5,202}, {1,5,202}, {1,5,202}, {1,5,202},
+    {1,5,202}, {1,5,202}, {1,5,202}, {1,5,202}, {1,5,202}, {1,5,202}, {1,5,202}, {1,5,202},
+    {1,5,202}, {1,5,202}, {1,5,202}, {1,5,202}, {1,5,232}, {1,5,232}, {1,5,232}, {1,5,232},
+    {1,5,232}, {1,5,232}, {1,5,232}, {1,5,232}, {1,5,232}, {1,5,232}, {1,5,232}, {1,5,232},
+    {1,5,232}, {1,5,232}, {1,5,232}, {1,5,232}, {3,5,29}, {3,5,29}, {3,5,29}, {3,5,29},
+    {3,5,29}, {3,5,29}, {3,5,29}, {3,5,29}, {3,5,29}, {3,5,29}, {3,5,29}, {3,5,29},
+    {3,5,29}, {3,5,29}, {3,5,29}, {3,5,29}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39},
+    {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39},
+    {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39},
+    {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39},
+    {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17},
+    {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17},
+    {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17},
+    {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17},
+    {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37},
+    {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37},
+    {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37},
+    {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37},
+    {2,4,37}, {2,4,37}, {2,4,37}, {2,4,37}, {1,4,165}, {1,4,165}, {1,4,165}, {1,4,165},
+    {1,4,165}, {1,4,165}, {1,4,165}, {1,4,165}, {1,4,165}, {1,4,165}, {1,4,165}, {1,4,165},
+    {1,4,165}, {1,4,165}, {1,4,165}, {1,4,165}, {1,4,165}, {1,4,165}, {1,4,165}, {1,4,165},
+    {1,4,165}, {1,4,165}, {1,4,165}, {1,4,165}, {1,4,165}, {1,4,165}, {1,4,165}, {1,4,165},
+    {1,4,165}, {1,4,165}, {1,4,165}, {1,4,165}, {3,1,55}, {3,1,57}, {9,1,0}, {1,1,62},
+    {12,2,0}, {12,2,0}, {12,2,0}, {12,2,0}, {1,2,90}, {1,2,90}, {1,2,90}, {1,2,90},
+    {1,4,193}, {1,4,207}, {1,3,137}, {1,3,137}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2},
+    {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2},
+    {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2},
+    {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2},
+    {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2},
+    {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2},
+    {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2},
+    {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2},
+    {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2},
+    {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2},
+    {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2},
+    {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2},
+    {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2},
+    {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2},
+    {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2},
+    {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2}, {3,1,2},
+    {5,6,8}, {5,6,8}, {5,6,8}, {5,6,8}, {2,8,69}, {2,8,70}, {3,8,59}, {3,8,49},
+    {1,5,228}, {1,5,228}, {1,5,228}, {1,5,228}, {1,5,228}, {1,5,228}, {1,5,228}, {1,5,228},
+    {3,5,21}, {3,5,21}, {3,5,21}, {3,5,21}, {3,5,21}, {3,5,21}, {3,5,21}, {3,5,21},
+    {2,5,57}, {2,5,57}, {2,5,57}, {2,5,57}, {2,5,57}, {2,5,57}, {2,5,57}, {2,5,57},
+    {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35},
+    {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35}, {2,4,35},
+    {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0},
+    {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0},
+    {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116},
+    {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116},
+    {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116},
+    {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116}, {1,3,116},
+    {1,4,158}, {1,4,158}, {1,4,158}, {1,4,158}, {1,4,158}, {1,4,158}, {1,4,158}, {1,4,158},
+    {1,4,158}, {1,4,158}, {1,4,158}, {1,4,158}, {1,4,158}, {1,4,158}, {1,4,158}, {1,4,158},
+    {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3},
+    {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3}, {5,4,3},
+    {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102},
+    {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102},
+    {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102},
+    {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102}, {1,2,102},
+    {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111},
+    {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111},
+    {1,3,117}, {1,3,117}, {1,3,117}, {1,3,117}, {1,3,117}, {1,3,117}, {1,3,117}, {1,3,117},
+    {1,3,117}, {1,3,117}, {1,3,117}, {1,3,117}, {1,3,117}, {1,3,117}, {1,3,117}, {1,3,117},
+    {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88},
+    {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88},
+    {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88},
+    {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88}, {1,2,88},
+    {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8},
+    {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8},
+    {3,7,53}, {1,7,299}, {1,7,305}, {1,7,290}, {34,7,0}, {3,7,48}, {38,7,0}, {2,7,77},
+    {3,7,35}, {2,7,82}, {1,6,285}, {1,6,285}, {3,6,45}, {3,6,45}, {2,6,86}, {2,6,86},
+    {3,6,44}, {13,6,1}, {1,6,271}, {1,6,300}, {1,6,269}, {5,6,7}, {3,6,34}, {1,6,264},
+    {7,5,2}, {7,5,2}, {3,5,27}, {3,5,27}, {27,5,0}, {27,5,0}, {1,5,213}, {1,5,213},
+    {1,5,239}, {1,5,239}, {6,5,3}, {6,5,3}, {1,5,174}, {1,5,174}, {23,5,0}, {23,5,0},
+    {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3},
+    {1,2,123}, {1,2,123}, {1,2,123}, {1,2,123}, {1,2,123}, {1,2,123}, {1,2,123}, {1,2,123},
+    {1,2,123}, {1,2,123}, {1,2,123}, {1,2,123}, {1,2,123}, {1,2,123}, {1,2,123}, {1,2,123},
+    {2,4,60}, {2,4,60}, {2,4,60}, {2,4,60}, {1,4,186}, {1,4,186}, {1,4,186}, {1,4,186},
+    {15,3,0}, {15,3,0}, {15,3,0}, {15,3,0}, {15,3,0}, {15,3,0}, {15,3,0}, {15,3,0},
+    {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97},
+    {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97},
+    {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97},
+    {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97},
+    {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97},
+    {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97},
+    {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97},
+    {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97}, {1,2,97},
+    {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10},
+    {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10},
+    {1,6,259}, {1,6,259}, {1,6,259}, {1,6,259}, {2,7,83}, {2,7,83}, {3,8,56}, {3,8,47},
+    {1,5,211}, {1,5,211}, {1,5,211}, {1,5,211}, {1,5,211}, {1,5,211}, {1,5,211}, {1,5,211},
+    {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20},
+    {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20},
+    {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20},
+    {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20}, {2,3,20},
+    {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64},
+    {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64},
+    {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64},
+    {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64},
+    {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64},
+    {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64},
+    {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64},
+    {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64},
+    {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64},
+    {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64},
+    {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64},
+    {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64},
+    {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64},
+    {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64},
+    {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64},
+    {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64}, {1,1,64},
+    {25,5,0}, {25,5,0}, {1,5,260}, {1,5,260}, {1,5,220}, {1,5,220}, {6,5,4}, {6,5,4},
+    {1,4,205}, {1,4,205}, {1,4,205}, {1,4,205}, {1,4,168}, {1,4,168}, {1,4,168}, {1,4,168},
+    {20,4,0}, {20,4,0}, {20,4,0}, {20,4,0}, {1,5,293}, {1,5,293}, {3,6,39}, {3,6,40},
+    {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {1,2,101}, {1,2,101}, {1,2,101}, {1,2,101}, {2,4,43}, {1,4,190}, {21,4,0}, {1,4,169},
+    {1,1,63}, {1,1,63}, {1,1,63}, {1,1,63}, {1,1,63}, {1,1,63}, {1,1,63}, {1,1,63},
+    {1,3,115}, {1,3,115}, {1,3,115}, {1,3,115}, {1,3,115}, {1,3,115}, {1,3,115}, {1,3,115},
+    {1,4,188}, {1,4,188}, {1,4,188}, {1,4,188}, {2,6,74}, {3,6,60}, {35,6,0}, {4,6,19},
+    {1,3,125}, {1,3,125}, {1,3,125}, {1,3,125}, {1,3,125}, {1,3,125}, {1,3,125}, {1,3,125},
+    {1,6,281}, {2,6,90}, {1,6,277}, {1,6,286}, {1,6,238}, {1,6,268}, {6,6,5}, {5,6,9},
+    {2,6,55}, {1,6,306}, {3,5,18}, {3,5,18}, {2,4,50}, {2,4,50}, {2,4,50}, {2,4,50},
+    {1,3,135}, {1,3,135}, {1,3,135}, {1,3,135}, {1,3,135}, {1,3,135}, {1,3,135}, {1,3,135},
+    {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11},
+    {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11},
+    {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100},
+    {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100},
+    {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100},
+    {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100}, {1,2,100},
+    {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93},
+    {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93},
+    {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93},
+    {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93}, {1,2,93},
+    {1,4,167}, {1,4,167}, {1,4,167}, {1,4,167}, {1,4,167}, {1,4,167}, {1,4,167}, {1,4,167},
+    {2,5,53}, {2,5,53}, {2,5,53}, {2,5,53}, {4,6,27}, {4,6,27}, {3,7,43}, {3,7,54},
+    {2,4,36}, {2,4,36}, {2,4,36}, {2,4,36}, {2,4,36}, {2,4,36}, {2,4,36}, {2,4,36},
+    {1,4,204}, {1,4,204}, {1,4,204}, {1,4,204}, {1,4,204}, {1,4,204}, {1,4,204}, {1,4,204},
+    {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96},
+    {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96},
+    {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96},
+    {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96}, {1,2,96},
+    {1,4,206}, {1,4,206}, {1,4,180}, {1,4,180}, {1,3,114}, {1,3,114}, {1,3,114}, {1,3,114},
+    {4,3,5}, {4,3,5}, {4,3,5}, {4,3,5}, {2,3,30}, {2,3,30}, {2,3,30}, {2,3,30},
+    {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9}, {1,4,173}, {1,4,173}, {1,5,214}, {1,5,225},
+    {1,2,95}, {1,2,95}, {1,2,95}, {1,2,95}, {1,2,95}, {1,2,95}, {1,2,95}, {1,2,95},
+    {1,3,126}, {1,3,126}, {2,3,21}, {2,3,21}, {2,4,45}, {2,4,51}, {2,3,22}, {2,3,22},
+    {1,3,113}, {1,3,113}, {1,4,247}, {1,4,187}, {1,3,112}, {1,3,112}, {1,3,127}, {1,3,127},
+    {1,1,76}, {1,1,76}, {1,1,76}, {1,1,76}, {1,1,76}, {1,1,76}, {1,1,76}, {1,1,76},
+    {16,3,0}, {16,3,0}, {1,4,199}, {1,4,172}, {1,2,98}, {1,2,98}, {1,2,98}, {1,2,98},
+    {1,3,162}, {1,3,162}, {1,3,162}, {1,3,162}, {1,3,162}, {1,3,162}, {1,3,162}, {1,3,162},
+    {1,3,162}, {1,3,162}, {1,3,162}, {1,3,162}, {1,3,162}, {1,3,162}, {1,3,162}, {1,3,162},
+    {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38},
+    {2,7,84}, {4,7,22}, {4,7,20}, {4,7,24}, {3,6,36}, {3,6,36}, {1,6,237}, {1,6,237},
+    {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103},
+    {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103},
+    {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103},
+    {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103}, {1,2,103},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {4,6,13}, {4,6,14}, {7,6,4}, {12,6,1}, {1,6,252}, {1,6,304}, {3,6,33}, {1,6,302},
+    {40,6,0}, {37,6,0}, {1,5,276}, {1,5,276}, {1,5,227}, {1,5,227}, {14,5,1}, {14,5,1},
+    {1,5,266}, {1,5,266}, {1,5,229}, {1,5,229}, {1,4,178}, {1,4,178}, {1,4,178}, {1,4,178},
+    {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25},
+    {1,3,163}, {1,3,163}, {1,3,163}, {1,3,163}, {1,3,163}, {1,3,163}, {1,3,163}, {1,3,163},
+    {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28},
+    {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15},
+    {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15},
+    {1,1,68}, {1,1,69}, {1,2,99}, {1,2,99}, {1,2,99}, {1,2,99}, {1,2,99}, {1,2,99},
+    {1,2,99}, {1,2,99}, {1,2,99}, {1,2,99}, {1,2,99}, {1,2,99}, {1,2,99}, {1,2,99},
+    {1,2,99}, {1,2,99}, {1,3,118}, {1,3,118}, {1,3,118}, {1,3,118}, {1,3,118}, {1,3,118},
+    {1,3,118}, {1,3,118}, {1,5,226}, {1,5,226}, {1,6,292}, {2,6,88}, {2,4,34}, {2,4,34},
+    {2,4,34}, {2,4,34}, {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66},
+    {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66},
+    {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66},
+    {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66}, {1,1,66},
+    {1,1,66}, {1,1,66}, {1,1,81}, {1,1,81}, {1,1,81}, {1,1,81}, {1,1,81}, {1,1,81},
+    {1,1,81}, {1,1,81}, {1,1,81}, {1,1,81}, {1,1,81}, {1,1,81}, {1,1,81}, {1,1,81},
+    {1,1,81}, {1,1,81}, {1,4,195}, {1,4,195}, {1,4,242}, {1,4,242}, {1,3,131}, {1,3,131},
+    {1,3,131}, {1,3,131}, {26,5,0}, {1,5,230}, {28,5,0}, {2,5,46}, {1,5,308}, {3,5,22},
+    {1,5,270}, {1,5,261}, {1,1,75}, {1,1,72}, {1,4,245}, {1,4,245}, {1,4,245}, {1,4,245},
+    {2,4,44}, {2,4,44}, {2,4,44}, {2,4,44}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4},
+    {2,4,52}, {2,4,52}, {2,4,52}, {2,4,52}, {1,2,94}, {1,2,94}, {1,2,94}, {1,2,94},
+    {1,2,94}, {1,2,94}, {1,2,94}, {1,2,94}, {1,2,94}, {1,2,94}, {1,2,94}, {1,2,94},
+    {1,2,94}, {1,2,94}, {1,2,94}, {1,2,94}, {1,3,160}, {1,3,160}, {1,3,160}, {1,3,160},
+    {1,3,160}, {1,3,160}, {1,3,160}, {1,3,160}, {1,3,128}, {1,3,128}, {1,3,128}, {1,3,128},
+    {1,3,128}, {1,3,128}, {1,3,128}, {1,3,128}, {1,5,222}, {1,5,222}, {3,6,41}, {4,6,16},
+    {1,4,171}, {1,4,171}, {1,4,171}, {1,4,171}, {1,4,212}, {1,4,212}, {1,4,212}, {1,4,212},
+    {1,4,170}, {1,4,170}, {1,4,170}, {1,4,170}, {1,3,136}, {1,3,152}, {2,2,14}, {2,2,14},
+    {1,1,65}, {1,1,65}, {1,1,65}, {1,1,65}, {1,1,73}, {1,1,73}, {1,1,73}, {1,1,73},
+    {7,3,1}, {1,3,145}, {1,3,132}, {1,3,147}, {1,2,107}, {4,2,2}, {10,1,0}, {10,1,0},
+    {1,2,104}, {1,2,104}, {1,2,104}, {1,2,104}, {1,2,104}, {1,2,104}, {1,2,104}, {1,2,104},
+    {1,2,104}, {1,2,104}, {1,2,104}, {1,2,104}, {1,2,104}, {1,2,104}, {1,2,104}, {1,2,104},
+    {2,6,68}, {2,6,63}, {2,6,65}, {1,6,298}, {1,5,310}, {1,5,310}, {1,5,289}, {1,5,289},
+    {1,5,234}, {1,5,234}, {1,5,309}, {1,5,309}, {1,5,301}, {1,5,301}, {1,5,273}, {1,5,273},
+    {1,5,254}, {1,5,254}, {2,5,76}, {2,5,76}, {1,5,272}, {1,5,272}, {3,5,42}, {3,5,42},
+    {1,5,265}, {1,5,265}, {1,5,256}, {1,5,256}, {1,4,192}, {1,4,192}, {1,4,192}, {1,4,192},
+    {4,4,8}, {4,4,8}, {4,4,8}, {4,4,8}, {1,4,255}, {1,4,255}, {1,4,255}, {1,4,255},
+    {1,3,185}, {1,3,185}, {1,3,185}, {1,3,185}, {1,3,185}, {1,3,185}, {1,3,185}, {1,3,185},
+    {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70}, {1,3,164}, {1,3,133}, {2,2,12}, {2,2,12},
+    {1,3,129}, {1,3,129}, {4,4,7}, {1,4,179}, {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13},
+    {1,2,106}, {1,2,106}, {1,2,106}, {1,2,106}, {1,4,197}, {1,4,176}, {2,3,40}, {2,3,40},
+    {1,3,153}, {1,3,130}, {1,3,244}, {1,3,184}, {3,2,6}, {3,2,6}, {1,2,121}, {1,2,121},
+    {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74},
+    {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74},
+    {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74},
+    {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74},
+    {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74},
+    {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74},
+    {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74},
+    {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74}, {1,1,74},
+    {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0},
+    {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0},
+    {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0},
+    {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0},
+    {1,6,296}, {1,6,296}, {4,7,15}, {2,7,66}, {1,5,240}, {1,5,240}, {1,5,240}, {1,5,240},
+    {1,5,235}, {1,5,235}, {1,5,235}, {1,5,235}, {2,5,54}, {2,5,54}, {2,5,54}, {2,5,54},
+    {32,5,0}, {32,5,0}, {32,5,0}, {32,5,0}, {1,5,249}, {1,5,249}, {1,5,249}, {1,5,249},
+    {3,5,25}, {3,5,25}, {3,5,25}, {3,5,25}, {4,5,10}, {4,5,10}, {4,5,10}, {4,5,10},
+    {1,1,82}, {1,1,82}, {1,1,82}, {1,1,82}, {1,1,82}, {1,1,82}, {1,1,82}, {1,1,82},
+    {1,1,82}, {1,1,82}, {1,1,82}, {1,1,82}, {1,1,82}, {1,1,82}, {1,1,82}, {1,1,82},
+    {3,5,26}, {1,5,263}, {7,5,3}, {1,5,288}, {1,4,218}, {1,4,218}, {9,4,1}, {9,4,1},
+    {3,4,12}, {3,4,12}, {1,4,189}, {1,4,189}, {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26},
+    {1,1,71}, {1,1,71}, {1,1,71}, {1,1,71}, {1,3,139}, {2,3,31}, {2,2,17}, {2,2,17},
+    {1,1,83}, {1,1,83}, {1,1,83}, {1,1,83}, {5,3,2}, {1,3,150}, {2,2,18}, {2,2,18},
+    {1,1,78}, {1,1,78}, {1,1,78}, {1,1,78}, {1,1,78}, {1,1,78}, {1,1,78}, {1,1,78},
+    {1,4,217}, {1,4,203}, {1,4,194}, {1,4,209}, {1,3,141}, {1,3,141}, {1,3,149}, {1,3,149},
+    {1,3,161}, {2,3,24}, {2,3,23}, {4,3,6}, {1,1,80}, {1,1,80}, {1,1,80}, {1,1,80},
+    {14,2,0}, {6,2,1}, {3,1,3}, {3,1,3}, {2,7,89}, {2,7,80}, {2,7,81}, {4,7,23},
+    {2,6,71}, {2,6,71}, {4,6,26}, {4,6,26}, {4,6,21}, {4,6,21}, {33,6,0}, {33,6,0},
+    {39,6,0}, {39,6,0}, {3,6,52}, {3,6,52}, {1,6,303}, {1,6,303}, {1,6,297}, {1,6,297},
+    {1,6,295}, {1,6,295}, {3,6,32}, {3,6,32}, {3,5,28}, {3,5,28}, {3,5,28}, {3,5,28},
+    {3,5,51}, {3,5,51}, {3,5,51}, {3,5,51}, {1,5,248}, {1,5,248}, {1,5,248}, {1,5,248},
+    {2,5,62}, {2,5,62}, {2,5,62}, {2,5,62}, {1,5,283}, {1,5,283}, {1,5,283}, {1,5,283},
+    {29,5,0}, {29,5,0}, {29,5,0}, {29,5,0}, {1,5,294}, {1,5,294}, {1,5,294}, {1,5,294},
+    {2,5,67}, {2,5,67}, {2,5,67}, {2,5,67}, {1,5,233}, {1,5,233}, {1,5,233}, {1,5,233},
+    {1,5,223}, {1,5,223}, {1,5,223}, {1,5,223}, {1,4,201}, {1,4,201}, {1,4,201}, {1,4,201},
+    {1,4,201}, {1,4,201}, {1,4,201}, {1,4,201}, {2,4,59}, {2,4,59}, {2,4,59}, {2,4,59},
+    {2,4,59}, {2,4,59}, {2,4,59}, {2,4,59}, {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0},
+    {24,4,0}, {24,4,0}, {24,4,0}, {24,4,0}, {1,4,177}, {1,4,177}, {1,4,177}, {1,4,177},
+    {1,4,177}, {1,4,177}, {1,4,177}, {1,4,177}, {6,4,2}, {6,4,2}, {6,4,2}, {6,4,2},
+    {6,4,2}, {6,4,2}, {6,4,2}, {6,4,2}, {1,4,241}, {1,4,241}, {1,4,241}, {1,4,241},
+    {1,4,241}, {1,4,241}, {1,4,241}, {1,4,241}, {1,3,143}, {1,3,143}, {1,3,143}, {1,3,143},
+    {1,3,143}, {1,3,143}, {1,3,143}, {1,3,143}, {1,3,143}, {1,3,143}, {1,3,143}, {1,3,143},
+    {1,3,143}, {1,3,143}, {1,3,143}, {1,3,143}, {1,2,108}, {1,2,105}, {1,1,79}, {1,1,79},
+    {1,4,215}, {1,4,215}, {1,4,215}, {1,4,215}, {4,5,17}, {4,5,17}, {3,6,37}, {2,6,85},
+    {1,3,138}, {1,3,138}, {1,3,138}, {1,3,138}, {1,3,138}, {1,3,138}, {1,3,138}, {1,3,138},
+    {1,2,124}, {1,2,124}, {1,2,124}, {1,2,124}, {1,2,124}, {1,2,124}, {1,2,124}, {1,2,124},
+    {1,2,124}, {1,2,124}, {1,2,124}, {1,2,124}, {1,2,124}, {1,2,124}, {1,2,124}, {1,2,124},
+    {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77},
+    {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77},
+    {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77},
+    {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77}, {1,1,77},
+    {1,1,84}, {1,1,84}, {1,1,84}, {1,1,84}, {1,1,84}, {1,1,84}, {1,1,84}, {1,1,84},
+    {1,3,183}, {1,3,183}, {1,4,196}, {1,4,191}, {1,3,146}, {1,3,146}, {1,3,148}, {1,3,148},
+    {1,2,109}, {1,2,109}, {1,2,120}, {1,2,120}, {2,3,32}, {1,3,243}, {2,2,19}, {2,2,19},
+    {1,5,251}, {1,5,274}, {1,5,291}, {2,5,78}, {1,5,262}, {1,5,224}, {1,5,275}, {11,5,1},
+    {4,5,18}, {4,5,12}, {36,5,0}, {30,5,0}, {2,4,58}, {2,4,58}, {22,4,0}, {22,4,0},
+    {4,4,9}, {4,4,9}, {2,4,48}, {2,4,48}, {1,3,166}, {1,3,166}, {1,3,166}, {1,3,166},
+    {1,3,140}, {1,3,140}, {1,3,140}, {1,3,140}, {2,3,41}, {2,3,41}, {2,3,41}, {2,3,41},
+    {1,3,154}, {1,3,154}, {1,3,154}, {1,3,154}, {1,3,154}, {1,3,154}, {1,3,154}, {1,3,154},
+    {1,4,221}, {1,4,221}, {1,4,221}, {1,4,221}, {3,5,30}, {3,5,30}, {2,6,64}, {3,6,50},
+    {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7},
+    {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {1,1,85}, {1,1,85}, {1,1,85}, {1,1,85}, {1,3,144}, {1,3,159}, {1,2,110}, {1,2,110},
+    {2,2,29}, {2,2,29}, {2,2,29}, {2,2,29}, {3,4,11}, {3,4,13}, {1,4,198}, {3,4,15},
+    {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0}, {11,1,0},
+};
+
+static const RL_VLC_ELEM coef2_rl_vlc[11650] = {
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {2,7,2}, {2,7,2}, {2,7,2}, {2,7,2}, {512,-2,0}, {516,-9,0}, {12,9,0}, {1140,-9,0},
+    {2,9,4}, {1668,-9,0}, {2,8,3}, {2,8,3}, {1,8,9}, {1,8,9}, {2210,-8,0}, {1,9,12},
+    {3,7,1}, {3,7,1}, {3,7,1}, {3,7,1}, {9,8,0}, {9,8,0}, {0,9,0}, {2466,-9,0},
+    {2982,-1,0}, {2984,-9,0}, {3562,-9,0}, {13,9,0}, {1,7,7}, {1,7,7}, {1,7,7}, {1,7,7},
+    {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0},
+    {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0},
+    {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0},
+    {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0},
+    {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0},
+    {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0},
+    {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0},
+    {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0}, {2,3,0},
+    {1,6,5}, {1,6,5}, {1,6,5}, {1,6,5}, {1,6,5}, {1,6,5}, {1,6,5}, {1,6,5},
+    {5,6,0}, {5,6,0}, {5,6,0}, {5,6,0}, {5,6,0}, {5,6,0}, {5,6,0}, {5,6,0},
+    {2,5,1}, {2,5,1}, {2,5,1}, {2,5,1}, {2,5,1}, {2,5,1}, {2,5,1}, {2,5,1},
+    {2,5,1}, {2,5,1}, {2,5,1}, {2,5,1}, {2,5,1}, {2,5,1}, {2,5,1}, {2,5,1},
+    {4074,-9,0}, {4602,-9,0}, {5140,-9,0}, {5660,-9,0}, {7,7,0}, {7,7,0}, {7,7,0}, {7,7,0},
+    {5,9,1}, {1,9,13}, {4,8,1}, {4,8,1}, {6176,-9,0}, {6748,-2,0}, {1,8,10}, {1,8,10},
+    {4,5,0}, {4,5,0}, {4,5,0}, {4,5,0}, {4,5,0}, {4,5,0}, {4,5,0}, {4,5,0},
+    {4,5,0}, {4,5,0}, {4,5,0}, {4,5,0}, {4,5,0}, {4,5,0}, {4,5,0}, {4,5,0},
+    {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0},
+    {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0},
+    {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0},
+    {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0}, {3,4,0},
+    {10,8,0}, {10,8,0}, {14,9,0}, {6752,-9,0}, {7264,-9,0}, {7786,-9,0}, {8334,-7,0}, {1,9,14},
+    {8462,-9,0}, {15,9,0}, {9048,-9,0}, {9560,-9,0}, {1,7,8}, {1,7,8}, {1,7,8}, {1,7,8},
+    {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4},
+    {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4},
+    {11,8,0}, {11,8,0}, {10074,-1,0}, {10076,-9,0}, {8,7,0}, {8,7,0}, {8,7,0}, {8,7,0},
+    {1,6,6}, {1,6,6}, {1,6,6}, {1,6,6}, {1,6,6}, {1,6,6}, {1,6,6}, {1,6,6},
+    {1,8,11}, {1,8,11}, {10590,-9,0}, {2,9,5}, {1,9,15}, {11130,-9,0}, {3,8,2}, {3,8,2},
+    {6,6,0}, {6,6,0}, {6,6,0}, {6,6,0}, {6,6,0}, {6,6,0}, {6,6,0}, {6,6,0},
+    {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3},
+    {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3},
+    {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3},
+    {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3},
+    {22,2,0}, {1,2,20}, {16,1,0}, {16,1,0}, {16,5,1}, {16,5,1}, {16,5,1}, {16,5,1},
+    {16,5,1}, {16,5,1}, {16,5,1}, {16,5,1}, {16,5,1}, {16,5,1}, {16,5,1}, {16,5,1},
+    {16,5,1}, {16,5,1}, {16,5,1}, {16,5,1}, {1028,-1,0}, {1030,-1,0}, {1032,-1,0}, {1034,-1,0},
+    {1036,-1,0}, {1038,-1,0}, {1040,-1,0}, {1042,-1,0}, {1044,-1,0}, {1046,-1,0}, {1048,-1,0}, {1,9,120},
+    {1,9,123}, {16,9,5}, {168,9,0}, {165,9,0}, {201,9,0}, {5,9,21}, {2,8,50}, {2,8,50},
+    {3,8,37}, {3,8,37}, {4,8,35}, {4,8,35}, {133,8,0}, {133,8,0}, {3,8,32}, {3,8,32},
+    {16,7,2}, {16,7,2}, {16,7,2}, {16,7,2}, {10,7,4}, {10,7,4}, {10,7,4}, {10,7,4},
+    {3,8,30}, {3,8,30}, {8,8,9}, {8,8,9}, {2,6,20}, {2,6,20}, {2,6,20}, {2,6,20},
+    {2,6,20}, {2,6,20}, {2,6,20}, {2,6,20}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0},
+    {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0},
+    {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0},
+    {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0},
+    {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0},
+    {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0},
+    {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0},
+    {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0},
+    {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0},
+    {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0},
+    {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0},
+    {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0},
+    {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0},
+    {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0},
+    {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0},
+    {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0},
+    {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {78,6,0}, {78,6,0}, {78,6,0}, {78,6,0},
+    {78,6,0}, {78,6,0}, {78,6,0}, {78,6,0}, {1,8,96}, {1,8,96}, {2,8,51}, {2,8,51},
+    {143,8,0}, {143,8,0}, {1050,-3,0}, {2,9,60}, {1,7,77}, {1,7,77}, {1,7,77}, {1,7,77},
+    {5,7,11}, {5,7,11}, {5,7,11}, {5,7,11}, {7,6,5}, {7,6,5}, {7,6,5}, {7,6,5},
+    {7,6,5}, {7,6,5}, {7,6,5}, {7,6,5}, {100,7,0}, {100,7,0}, {100,7,0}, {100,7,0},
+    {1,9,113}, {8,9,13}, {203,9,0}, {2,9,57}, {27,9,2}, {3,9,41}, {5,9,30}, {11,9,9},
+    {216,9,0}, {202,9,0}, {19,9,3}, {49,9,1}, {3,8,29}, {3,8,29}, {3,8,31}, {3,8,31},
+    {8,7,7}, {8,7,7}, {8,7,7}, {8,7,7}, {81,6,0}, {81,6,0}, {81,6,0}, {81,6,0},
+    {81,6,0}, {81,6,0}, {81,6,0}, {81,6,0}, {76,6,0}, {76,6,0}, {76,6,0}, {76,6,0},
+    {76,6,0}, {76,6,0}, {76,6,0}, {76,6,0}, {8,6,4}, {8,6,4}, {8,6,4}, {8,6,4},
+    {8,6,4}, {8,6,4}, {8,6,4}, {8,6,4}, {3,5,10}, {3,5,10}, {3,5,10}, {3,5,10},
+    {3,5,10}, {3,5,10}, {3,5,10}, {3,5,10}, {3,5,10}, {3,5,10}, {3,5,10}, {3,5,10},
+    {3,5,10}, {3,5,10}, {3,5,10}, {3,5,10}, {6,5,4}, {6,5,4}, {6,5,4}, {6,5,4},
+    {6,5,4}, {6,5,4}, {6,5,4}, {6,5,4}, {6,5,4}, {6,5,4}, {6,5,4}, {6,5,4},
+    {6,5,4}, {6,5,4}, {6,5,4}, {6,5,4}, {9,7,5}, {9,7,5}, {9,7,5}, {9,7,5},
+    {4,7,14}, {4,7,14}, {4,7,14}, {4,7,14}, {13,8,4}, {13,8,4}, {2,8,54}, {2,8,54},
+    {3,8,27}, {3,8,27}, {1058,-3,0}, {1066,-3,0}, {1,4,36}, {1,4,36}, {1,4,36}, {1,4,36},
+    {1,4,36}, {1,4,36}, {1,4,36}, {1,4,36}, {1,4,36}, {1,4,36}, {1,4,36}, {1,4,36},
+    {1,4,36}, {1,4,36}, {1,4,36}, {1,4,36}, {1,4,36}, {1,4,36}, {1,4,36}, {1,4,36},
+    {1,4,36}, {1,4,36}, {1,4,36}, {1,4,36}, {1,4,36}, {1,4,36}, {1,4,36}, {1,4,36},
+    {1,4,36}, {1,4,36}, {1,4,36}, {1,4,36}, {1,5,45}, {1,5,45}, {1,5,45}, {1,5,45},
+    {1,5,45}, {1,5,45}, {1,5,45}, {1,5,45}, {1,5,45}, {1,5,45}, {1,5,45}, {1,5,45},
+    {1,5,45}, {1,5,45}, {1,5,45}, {1,5,45}, {4,6,10}, {4,6,10}, {4,6,10}, {4,6,10},
+    {4,6,10}, {4,6,10}, {4,6,10}, {4,6,10}, {1074,-2,0}, {1078,-2,0}, {1082,-2,0}, {1086,-2,0},
+    {1090,-2,0}, {1094,-2,0}, {1098,-2,0}, {1102,-2,0}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5},
+    {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5},
+    {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5},
+    {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5},
+    {4,4,5}, {4,4,5}, {4,4,5}, {4,4,5}, {57,5,0}, {57,5,0}, {57,5,0}, {57,5,0},
+    {57,5,0}, {57,5,0}, {57,5,0}, {57,5,0}, {57,5,0}, {57,5,0}, {57,5,0}, {57,5,0},
+    {57,5,0}, {57,5,0}, {57,5,0}, {57,5,0}, {1106,-2,0}, {1110,-1,0}, {1112,-1,0}, {1114,-1,0},
+    {1116,-1,0}, {1118,-1,0}, {1120,-1,0}, {1122,-1,0}, {1124,-1,0}, {1126,-1,0}, {1128,-1,0}, {1130,-1,0},
+    {1132,-1,0}, {1134,-1,0}, {1136,-1,0}, {1138,-1,0}, {20,9,3}, {3,9,52}, {4,9,29}, {3,9,51},
+    {2,8,41}, {2,8,41}, {1,8,94}, {1,8,94}, {132,8,0}, {132,8,0}, {162,8,0}, {162,8,0},
+    {8,8,10}, {8,8,10}, {142,8,0}, {142,8,0}, {1,7,75}, {1,7,75}, {1,7,75}, {1,7,75},
+    {2,7,31}, {2,7,31}, {2,7,31}, {2,7,31}, {1,6,60}, {1,6,60}, {1,6,60}, {1,6,60},
+    {1,6,60}, {1,6,60}, {1,6,60}, {1,6,60}, {2,5,16}, {2,5,16}, {2,5,16}, {2,5,16},
+    {2,5,16}, {2,5,16}, {2,5,16}, {2,5,16}, {2,5,16}, {2,5,16}, {2,5,16}, {2,5,16},
+    {2,5,16}, {2,5,16}, {2,5,16}, {2,5,16}, {5,5,6}, {5,5,6}, {5,5,6}, {5,5,6},
+    {5,5,6}, {5,5,6}, {5,5,6}, {5,5,6}, {5,5,6}, {5,5,6}, {5,5,6}, {5,5,6},
+    {5,5,6}, {5,5,6}, {5,5,6}, {5,5,6}, {11,1,13}, {73,1,1}, {261,1,0}, {246,1,0},
+    {5,1,54}, {6,1,44}, {6,1,29}, {10,1,31}, {83,1,1}, {13,1,9}, {283,1,0}, {6,1,45},
+    {7,1,29}, {274,1,0}, {15,1,8}, {2,1,78}, {4,1,41}, {1,1,137}, {1,1,154}, {2,1,90},
+    {2,1,91}, {307,1,0}, {3,1,59}, {3,1,59}, {3,1,59}, {3,1,59}, {11,3,23}, {2,3,106},
+    {11,3,21}, {21,3,6}, {9,3,25}, {11,3,19}, {316,3,0}, {9,3,22}, {8,3,58}, {1,3,179},
+    {5,3,56}, {5,3,57}, {10,3,27}, {7,3,47}, {11,3,38}, {3,3,75}, {289,3,0}, {7,3,49},
+    {7,2,52}, {7,2,52}, {13,2,11}, {1,2,178}, {5,2,55}, {337,2,0}, {333,2,0}, {2,2,99},
+    {14,2,17}, {332,2,0}, {8,2,59}, {2,2,101}, {1,2,165}, {3,2,66}, {1,2,162}, {1,2,161},
+    {1,2,160}, {10,2,26}, {10,2,22}, {8,2,34}, {6,2,55}, {18,2,9}, {6,2,56}, {6,2,43},
+    {7,2,48}, {11,2,35}, {10,2,19}, {19,2,7}, {11,2,33}, {338,2,0}, {1,2,133}, {8,2,44},
+    {300,2,0}, {306,2,0}, {302,2,0}, {310,2,0}, {284,2,0}, {325,2,0}, {32,1,2}, {34,1,2},
+    {3,1,67}, {16,1,6}, {16,1,7}, {16,1,10}, {6,1,21}, {48,1,2}, {244,1,0}, {2,1,65},
+    {9,1,18}, {8,1,18}, {1,1,145}, {262,1,0}, {2,1,88}, {23,1,5}, {2,1,82}, {12,1,17},
+    {7,1,36}, {2,1,80}, {285,1,0}, {11,1,14}, {5,1,47}, {33,1,2}, {7,1,53}, {28,1,3},
+    {1,1,153}, {263,1,0}, {76,1,1}, {1,1,164}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7},
+    {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7},
+    {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7},
+    {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7},
+    {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7},
+    {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7},
+    {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7},
+    {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7},
+    {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7},
+    {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7},
+    {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7},
+    {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7},
+    {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7},
+    {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7},
+    {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7},
+    {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7},
+    {2,2,7}, {2,2,7}, {2,2,7}, {2,2,7}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27},
+    {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27},
+    {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27},
+    {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27},
+    {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27},
+    {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27},
+    {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27},
+    {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27},
+    {1,3,27}, {1,3,27}, {1,3,27}, {1,3,27}, {1,6,63}, {1,6,63}, {1,6,63}, {1,6,63},
+    {1,6,63}, {1,6,63}, {1,6,63}, {1,6,63}, {4,8,19}, {4,8,19}, {156,9,0}, {1652,-4,0},
+    {151,8,0}, {151,8,0}, {136,8,0}, {136,8,0}, {38,8,1}, {38,8,1}, {144,8,0}, {144,8,0},
+    {1,7,80}, {1,7,80}, {1,7,80}, {1,7,80}, {1,6,61}, {1,6,61}, {1,6,61}, {1,6,61},
+    {1,6,61}, {1,6,61}, {1,6,61}, {1,6,61}, {3,4,8}, {3,4,8}, {3,4,8}, {3,4,8},
+    {3,4,8}, {3,4,8}, {3,4,8}, {3,4,8}, {3,4,8}, {3,4,8}, {3,4,8}, {3,4,8},
+    {3,4,8}, {3,4,8}, {3,4,8}, {3,4,8}, {3,4,8}, {3,4,8}, {3,4,8}, {3,4,8},
+    {3,4,8}, {3,4,8}, {3,4,8}, {3,4,8}, {3,4,8}, {3,4,8}, {3,4,8}, {3,4,8},
+    {3,4,8}, {3,4,8}, {3,4,8}, {3,4,8}, {2,7,32}, {2,7,32}, {2,7,32}, {2,7,32},
+    {57,9,1}, {2,9,61}, {14,9,6}, {3,9,46}, {80,6,0}, {80,6,0}, {80,6,0}, {80,6,0},
+    {80,6,0}, {80,6,0}, {80,6,0}, {80,6,0}, {6,9,35}, {198,9,0}, {185,9,0}, {8,9,16},
+    {212,9,0}, {5,9,29}, {173,9,0}, {12,9,8}, {13,9,6}, {5,9,32}, {7,8,11}, {7,8,11},
+    {2,8,47}, {2,8,47}, {138,8,0}, {138,8,0}, {112,7,0}, {112,7,0}, {112,7,0}, {112,7,0},
+    {11,7,4}, {11,7,4}, {11,7,4}, {11,7,4}, {4,8,20}, {4,8,20}, {128,8,0}, {128,8,0},
+    {6,8,12}, {6,8,12}, {5,8,17}, {5,8,17}, {7,8,10}, {7,8,10}, {141,8,0}, {141,8,0},
+    {7,7,8}, {7,7,8}, {7,7,8}, {7,7,8}, {104,7,0}, {104,7,0}, {104,7,0}, {104,7,0},
+    {4,7,15}, {4,7,15}, {4,7,15}, {4,7,15}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0},
+    {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0},
+    {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0},
+    {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0},
+    {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0},
+    {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0},
+    {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0},
+    {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0},
+    {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {209,1,0}, {209,1,0}, {209,1,0}, {209,1,0},
+    {209,1,0}, {209,1,0}, {209,1,0}, {209,1,0}, {301,2,0}, {301,2,0}, {301,2,0}, {301,2,0},
+    {8,3,50}, {8,3,50}, {8,4,51}, {11,4,37}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {3,2,4}, {3,2,4}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9},
+    {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9},
+    {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9},
+    {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9},
+    {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9},
+    {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9},
+    {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9},
+    {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9},
+    {2,3,9}, {2,3,9}, {2,3,9}, {2,3,9}, {21,6,1}, {21,6,1}, {21,6,1}, {21,6,1},
+    {21,6,1}, {21,6,1}, {21,6,1}, {21,6,1}, {29,7,1}, {29,7,1}, {29,7,1}, {29,7,1},
+    {106,7,0}, {106,7,0}, {106,7,0}, {106,7,0}, {58,5,0}, {58,5,0}, {58,5,0}, {58,5,0},
+    {58,5,0}, {58,5,0}, {58,5,0}, {58,5,0}, {58,5,0}, {58,5,0}, {58,5,0}, {58,5,0},
+    {58,5,0}, {58,5,0}, {58,5,0}, {58,5,0}, {118,7,0}, {118,7,0}, {118,7,0}, {118,7,0},
+    {108,7,0}, {108,7,0}, {108,7,0}, {108,7,0}, {2180,-1,0}, {2182,-1,0}, {2184,-1,0}, {2186,-1,0},
+    {2188,-1,0}, {2190,-1,0}, {2192,-1,0}, {2194,-1,0}, {2196,-1,0}, {2198,-1,0}, {2200,-1,0}, {2202,-1,0},
+    {2204,-1,0}, {2206,-1,0}, {2208,-1,0}, {6,9,20}, {189,9,0}, {9,9,14}, {3,9,43}, {5,9,35},
+    {174,9,0}, {196,9,0}, {1,9,114}, {13,9,7}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {268,1,0}, {2,1,109}, {5,1,53}, {3,1,61},
+    {7,1,20}, {7,1,32}, {288,1,0}, {2,1,89}, {3,1,69}, {8,1,28}, {319,1,0}, {8,1,60},
+    {9,1,16}, {1,1,142}, {8,1,40}, {10,1,11}, {10,1,30}, {5,1,50}, {237,1,0}, {249,1,0},
+    {282,1,0}, {7,1,45}, {245,1,0}, {1,1,126}, {277,1,0}, {74,1,1}, {67,1,1}, {63,1,1},
+    {62,1,1}, {38,1,2}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16},
+    {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16},
+    {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16},
+    {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16},
+    {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16},
+    {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16},
+    {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16},
+    {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16},
+    {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16},
+    {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16},
+    {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16},
+    {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16},
+    {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16},
+    {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16},
+    {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16},
+    {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16}, {1,1,16},
+    {1,1,16}, {1,1,16}, {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28},
+    {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28},
+    {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28},
+    {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28}, {1,3,28},
+    {1,3,28}, {1,3,28}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1},
+    {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1},
+    {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1},
+    {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1},
+    {10,3,1}, {10,3,1}, {154,8,0}, {9,8,8}, {3,8,28}, {2,8,43}, {1,8,95}, {4,8,36},
+    {111,7,0}, {111,7,0}, {1,5,47}, {1,5,47}, {1,5,47}, {1,5,47}, {1,5,47}, {1,5,47},
+    {1,5,47}, {1,5,47}, {1,6,64}, {1,6,64}, {1,6,64}, {1,6,64}, {3,6,15}, {3,6,15},
+    {3,6,15}, {3,6,15}, {10,8,8}, {16,8,3}, {2,8,46}, {9,8,9}, {1,8,99}, {153,8,0},
+    {146,8,0}, {159,8,0}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2},
+    {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2},
+    {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2},
+    {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2},
+    {6,3,2}, {6,3,2}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21},
+    {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21},
+    {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21},
+    {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21},
+    {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21},
+    {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21},
+    {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21},
+    {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21},
+    {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21},
+    {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21},
+    {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21},
+    {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21},
+    {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21},
+    {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21},
+    {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21},
+    {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21}, {1,2,21},
+    {1,2,21}, {1,2,21}, {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12},
+    {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12},
+    {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12},
+    {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12}, {2,4,12},
+    {2,4,12}, {2,4,12}, {20,8,2}, {20,8,2}, {145,8,0}, {145,8,0}, {2,7,37}, {2,7,37},
+    {2,7,37}, {2,7,37}, {10,6,3}, {10,6,3}, {10,6,3}, {10,6,3}, {10,6,3}, {10,6,3},
+    {10,6,3}, {10,6,3}, {6,6,7}, {6,6,7}, {6,6,7}, {6,6,7}, {6,6,7}, {6,6,7},
+    {6,6,7}, {6,6,7}, {13,6,2}, {13,6,2}, {13,6,2}, {13,6,2}, {13,6,2}, {13,6,2},
+    {13,6,2}, {13,6,2}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0},
+    {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0},
+    {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0},
+    {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0},
+    {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0},
+    {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0},
+    {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0},
+    {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0},
+    {32,3,0}, {32,3,0}, {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0},
+    {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0},
+    {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0},
+    {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0},
+    {43,4,0}, {43,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0},
+    {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0},
+    {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0},
+    {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0},
+    {44,4,0}, {44,4,0}, {13,7,3}, {13,7,3}, {13,7,3}, {13,7,3}, {1,7,83}, {1,7,83},
+    {1,7,83}, {1,7,83}, {77,6,0}, {77,6,0}, {77,6,0}, {77,6,0}, {77,6,0}, {77,6,0},
+    {77,6,0}, {77,6,0}, {1,6,59}, {1,6,59}, {1,6,59}, {1,6,59}, {1,6,59}, {1,6,59},
+    {1,6,59}, {1,6,59}, {5,9,36}, {52,9,1}, {232,9,0}, {9,9,11}, {8,9,14}, {5,9,28},
+    {8,9,15}, {15,9,5}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1},
+    {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1},
+    {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1},
+    {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1},
+    {13,4,1}, {13,4,1}, {1,9,105}, {207,9,0}, {190,9,0}, {53,9,1}, {140,8,0}, {140,8,0},
+    {4,8,37}, {4,8,37}, {1,6,62}, {1,6,62}, {1,6,62}, {1,6,62}, {1,6,62}, {1,6,62},
+    {1,6,62}, {1,6,62}, {83,6,0}, {83,6,0}, {83,6,0}, {83,6,0}, {83,6,0}, {83,6,0},
+    {83,6,0}, {83,6,0}, {1,7,81}, {1,7,81}, {1,7,81}, {1,7,81}, {1,8,108}, {1,8,108},
+    {3,9,50}, {2978,-2,0}, {4,5,8}, {4,5,8}, {4,5,8}, {4,5,8}, {4,5,8}, {4,5,8},
+    {4,5,8}, {4,5,8}, {4,5,8}, {4,5,8}, {4,5,8}, {4,5,8}, {4,5,8}, {4,5,8},
+    {4,5,8}, {4,5,8}, {5,6,9}, {5,6,9}, {5,6,9}, {5,6,9}, {5,6,9}, {5,6,9},
+    {5,6,9}, {5,6,9}, {79,6,0}, {79,6,0}, {79,6,0}, {79,6,0}, {79,6,0}, {79,6,0},
+    {79,6,0}, {79,6,0}, {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37},
+    {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37},
+    {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37},
+    {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37}, {1,4,37},
+    {1,4,37}, {1,4,37}, {10,5,2}, {10,5,2}, {10,5,2}, {10,5,2}, {10,5,2}, {10,5,2},
+    {10,5,2}, {10,5,2}, {10,5,2}, {10,5,2}, {10,5,2}, {10,5,2}, {10,5,2}, {10,5,2},
+    {10,5,2}, {10,5,2}, {17,7,2}, {17,7,2}, {17,7,2}, {17,7,2}, {1,8,100}, {1,8,100},
+    {6,8,14}, {6,8,14}, {4,8,33}, {4,8,33}, {11,8,6}, {11,8,6}, {110,7,0}, {110,7,0},
+    {110,7,0}, {110,7,0}, {13,2,13}, {1,2,167}, {12,2,15}, {14,2,13}, {6,1,1}, {3,1,3},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0},
+    {22,6,1}, {22,6,1}, {22,6,1}, {22,6,1}, {22,6,1}, {22,6,1}, {22,6,1}, {22,6,1},
+    {3,6,14}, {3,6,14}, {3,6,14}, {3,6,14}, {3,6,14}, {3,6,14}, {3,6,14}, {3,6,14},
+    {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0},
+    {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0},
+    {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0},
+    {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0},
+    {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0},
+    {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0},
+    {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1},
+    {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1},
+    {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0},
+    {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0},
+    {1,7,84}, {1,7,84}, {1,7,84}, {1,7,84}, {10,7,5}, {10,7,5}, {10,7,5}, {10,7,5},
+    {3496,-2,0}, {3500,-2,0}, {3504,-2,0}, {3508,-2,0}, {3512,-2,0}, {3516,-2,0}, {3520,-1,0}, {3522,-1,0},
+    {3524,-1,0}, {3526,-1,0}, {3528,-1,0}, {3530,-1,0}, {3532,-1,0}, {3534,-1,0}, {3536,-1,0}, {3538,-1,0},
+    {3540,-1,0}, {3542,-1,0}, {3544,-1,0}, {3546,-1,0}, {3548,-1,0}, {3550,-1,0}, {3552,-1,0}, {3554,-1,0},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1}, {0,2,1},
+    {3556,-1,0}, {3558,-1,0}, {3560,-1,0}, {210,9,0}, {3,9,54}, {5,9,27}, {5,9,20}, {217,9,0},
+    {234,9,0}, {1,9,124}, {4,9,60}, {5,9,60}, {6,9,22}, {7,9,18}, {51,9,1}, {3,9,47},
+    {1,8,104}, {1,8,104}, {6,8,13}, {6,8,13}, {4,8,30}, {4,8,30}, {158,8,0}, {158,8,0},
+    {11,8,7}, {11,8,7}, {13,8,5}, {13,8,5}, {4,7,16}, {4,7,16}, {4,7,16}, {4,7,16},
+    {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4},
+    {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4},
+    {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4},
+    {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4},
+    {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29},
+    {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29},
+    {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29},
+    {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29},
+    {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29},
+    {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29},
+    {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29},
+    {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29}, {1,3,29},
+    {14,2,12}, {1,2,176}, {11,2,31}, {14,2,14}, {330,2,0}, {2,2,83}, {11,2,26}, {14,2,15},
+    {1,2,170}, {3,2,64}, {2,2,108}, {294,2,0}, {328,2,0}, {7,2,50}, {6,2,57}, {7,2,58},
+    {7,2,25}, {8,2,47}, {7,2,44}, {3,2,76}, {5,2,49}, {9,2,29}, {8,2,52}, {292,2,0},
+    {8,1,23}, {1,1,172}, {264,1,0}, {228,1,0}, {11,1,15}, {21,1,4}, {7,1,28}, {30,1,3},
+    {80,1,1}, {1,1,143}, {31,1,2}, {291,1,0}, {1,1,150}, {260,1,0}, {9,1,21}, {1,1,180},
+    {5,1,59}, {6,1,54}, {6,1,53}, {335,1,0}, {231,1,0}, {251,1,0}, {8,1,20}, {298,1,0},
+    {10,1,14}, {2,1,72}, {3,1,68}, {10,1,15}, {36,1,2}, {254,1,0}, {14,1,11}, {37,1,2},
+    {271,1,0}, {4,1,43}, {314,1,0}, {2,1,94}, {2,1,102}, {8,1,37}, {5,1,58}, {235,1,0},
+    {240,1,0}, {12,1,11}, {85,6,0}, {85,6,0}, {85,6,0}, {85,6,0}, {85,6,0}, {85,6,0},
+    {85,6,0}, {85,6,0}, {27,7,1}, {27,7,1}, {27,7,1}, {27,7,1}, {147,8,0}, {147,8,0},
+    {40,8,1}, {40,8,1}, {2,6,21}, {2,6,21}, {2,6,21}, {2,6,21}, {2,6,21}, {2,6,21},
+    {2,6,21}, {2,6,21}, {1,7,85}, {1,7,85}, {1,7,85}, {1,7,85}, {6,7,10}, {6,7,10},
+    {6,7,10}, {6,7,10}, {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38},
+    {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38},
+    {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38},
+    {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38}, {1,4,38},
+    {1,4,38}, {1,4,38}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0},
+    {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0},
+    {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0},
+    {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0},
+    {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0},
+    {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0},
+    {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0},
+    {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0},
+    {33,3,0}, {33,3,0}, {1,7,78}, {1,7,78}, {1,7,78}, {1,7,78}, {14,8,4}, {14,8,4},
+    {7,8,12}, {7,8,12}, {82,6,0}, {82,6,0}, {82,6,0}, {82,6,0}, {82,6,0}, {82,6,0},
+    {82,6,0}, {82,6,0}, {2,8,48}, {2,8,48}, {1,8,97}, {1,8,97}, {1,7,86}, {1,7,86},
+    {1,7,86}, {1,7,86}, {86,6,0}, {86,6,0}, {86,6,0}, {86,6,0}, {86,6,0}, {86,6,0},
+    {86,6,0}, {86,6,0}, {3,7,19}, {3,7,19}, {3,7,19}, {3,7,19}, {113,7,0}, {113,7,0},
+    {113,7,0}, {113,7,0}, {226,9,0}, {11,9,10}, {182,9,0}, {7,9,17}, {2,9,64}, {197,9,0},
+    {7,9,31}, {1,9,125}, {2,5,17}, {2,5,17}, {2,5,17}, {2,5,17}, {2,5,17}, {2,5,17},
+    {2,5,17}, {2,5,17}, {2,5,17}, {2,5,17}, {2,5,17}, {2,5,17}, {2,5,17}, {2,5,17},
+    {2,5,17}, {2,5,17}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0},
+    {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0},
+    {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0},
+    {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0},
+    {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0},
+    {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0},
+    {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0},
+    {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0},
+    {34,3,0}, {34,3,0}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3},
+    {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3},
+    {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3},
+    {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3},
+    {6,4,3}, {6,4,3}, {1,5,46}, {1,5,46}, {1,5,46}, {1,5,46}, {1,5,46}, {1,5,46},
+    {1,5,46}, {1,5,46}, {1,5,46}, {1,5,46}, {1,5,46}, {1,5,46}, {1,5,46}, {1,5,46},
+    {1,5,46}, {1,5,46}, {193,9,0}, {1,9,122}, {15,9,6}, {5,9,39}, {26,9,2}, {184,9,0},
+    {15,9,7}, {211,9,0}, {25,9,2}, {16,9,4}, {2,9,74}, {5,9,24}, {47,9,1}, {5,9,33},
+    {149,8,0}, {149,8,0}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6},
+    {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6},
+    {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6},
+    {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6},
+    {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6},
+    {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6},
+    {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6},
+    {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6},
+    {3,3,6}, {3,3,6}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1},
+    {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1},
+    {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1},
+    {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1},
+    {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1},
+    {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1},
+    {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1},
+    {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1},
+    {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1},
+    {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1},
+    {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1},
+    {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1},
+    {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1},
+    {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1},
+    {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1},
+    {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1}, {8,2,1},
+    {8,2,1}, {8,2,1}, {135,8,0}, {135,8,0}, {1,8,98}, {1,8,98}, {3,8,39}, {3,8,39},
+    {1,8,103}, {1,8,103}, {139,8,0}, {139,8,0}, {148,8,0}, {148,8,0}, {1,7,79}, {1,7,79},
+    {1,7,79}, {1,7,79}, {4,8,21}, {4,8,21}, {54,9,1}, {4586,-3,0}, {105,7,0}, {105,7,0},
+    {105,7,0}, {105,7,0}, {2,6,24}, {2,6,24}, {2,6,24}, {2,6,24}, {2,6,24}, {2,6,24},
+    {2,6,24}, {2,6,24}, {2,6,22}, {2,6,22}, {2,6,22}, {2,6,22}, {2,6,22}, {2,6,22},
+    {2,6,22}, {2,6,22}, {12,8,6}, {12,8,6}, {12,8,5}, {12,8,5}, {37,8,1}, {37,8,1},
+    {39,8,1}, {39,8,1}, {62,5,0}, {62,5,0}, {62,5,0}, {62,5,0}, {62,5,0}, {62,5,0},
+    {62,5,0}, {62,5,0}, {62,5,0}, {62,5,0}, {62,5,0}, {62,5,0}, {62,5,0}, {62,5,0},
+    {62,5,0}, {62,5,0}, {1,5,48}, {1,5,48}, {1,5,48}, {1,5,48}, {1,5,48}, {1,5,48},
+    {1,5,48}, {1,5,48}, {1,5,48}, {1,5,48}, {1,5,48}, {1,5,48}, {1,5,48}, {1,5,48},
+    {1,5,48}, {1,5,48}, {1,6,65}, {1,6,65}, {1,6,65}, {1,6,65}, {1,6,65}, {1,6,65},
+    {1,6,65}, {1,6,65}, {14,7,3}, {14,7,3}, {14,7,3}, {14,7,3}, {4594,-1,0}, {4596,-1,0},
+    {4598,-1,0}, {4600,-1,0}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2},
+    {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2},
+    {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2},
+    {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2},
+    {8,4,2}, {8,4,2}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22},
+    {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22},
+    {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22},
+    {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22},
+    {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22},
+    {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22},
+    {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22},
+    {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22},
+    {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22},
+    {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22},
+    {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22},
+    {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22},
+    {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22},
+    {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22},
+    {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22},
+    {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22}, {1,2,22},
+    {1,2,22}, {1,2,22}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {7,2,43}, {7,2,43}, {8,3,46}, {11,3,39}, {39,1,2}, {39,1,2},
+    {39,1,2}, {39,1,2}, {1,1,157}, {8,1,24}, {19,1,8}, {315,1,0}, {43,1,2}, {1,1,149},
+    {2,1,93}, {1,1,168}, {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7},
+    {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7},
+    {5,5,7}, {5,5,7}, {1,6,67}, {1,6,67}, {1,6,67}, {1,6,67}, {1,6,67}, {1,6,67},
+    {1,6,67}, {1,6,67}, {5114,-1,0}, {5116,-1,0}, {5118,-1,0}, {5120,-1,0}, {5122,-1,0}, {5124,-1,0},
+    {5126,-1,0}, {5128,-1,0}, {61,5,0}, {61,5,0}, {61,5,0}, {61,5,0}, {61,5,0}, {61,5,0},
+    {61,5,0}, {61,5,0}, {61,5,0}, {61,5,0}, {61,5,0}, {61,5,0}, {61,5,0}, {61,5,0},
+    {61,5,0}, {61,5,0}, {1,5,51}, {1,5,51}, {1,5,51}, {1,5,51}, {1,5,51}, {1,5,51},
+    {1,5,51}, {1,5,51}, {1,5,51}, {1,5,51}, {1,5,51}, {1,5,51}, {1,5,51}, {1,5,51},
+    {1,5,51}, {1,5,51}, {5130,-1,0}, {5132,-1,0}, {5134,-1,0}, {5136,-1,0}, {5138,-1,0}, {1,9,117},
+    {248,9,0}, {5,9,23}, {4,9,59}, {1,9,131}, {1,9,132}, {1,9,128}, {4,9,44}, {1,9,130},
+    {236,9,0}, {5,9,26}, {5,9,25}, {215,9,0}, {3,9,58}, {3,9,49}, {2,9,62}, {3,9,53},
+    {41,8,1}, {41,8,1}, {2,8,49}, {2,8,49}, {161,8,0}, {161,8,0}, {3,8,26}, {3,8,26},
+    {2,8,44}, {2,8,44}, {15,8,4}, {15,8,4}, {1,8,102}, {1,8,102}, {32,7,1}, {32,7,1},
+    {32,7,1}, {32,7,1}, {1,6,66}, {1,6,66}, {1,6,66}, {1,6,66}, {1,6,66}, {1,6,66},
+    {1,6,66}, {1,6,66}, {7,6,6}, {7,6,6}, {7,6,6}, {7,6,6}, {7,6,6}, {7,6,6},
+    {7,6,6}, {7,6,6}, {88,6,0}, {88,6,0}, {88,6,0}, {88,6,0}, {88,6,0}, {88,6,0},
+    {88,6,0}, {88,6,0}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30},
+    {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30},
+    {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30},
+    {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30},
+    {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30},
+    {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30},
+    {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30},
+    {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30}, {1,3,30},
+    {1,3,30}, {1,3,30}, {6,8,16}, {6,8,16}, {17,8,3}, {17,8,3}, {2,7,38}, {2,7,38},
+    {2,7,38}, {2,7,38}, {5,7,13}, {5,7,13}, {5,7,13}, {5,7,13}, {6,8,15}, {6,8,15},
+    {4,8,22}, {4,8,22}, {1,5,50}, {1,5,50}, {1,5,50}, {1,5,50}, {1,5,50}, {1,5,50},
+    {1,5,50}, {1,5,50}, {1,5,50}, {1,5,50}, {1,5,50}, {1,5,50}, {1,5,50}, {1,5,50},
+    {1,5,50}, {1,5,50}, {1,5,49}, {1,5,49}, {1,5,49}, {1,5,49}, {1,5,49}, {1,5,49},
+    {1,5,49}, {1,5,49}, {1,5,49}, {1,5,49}, {1,5,49}, {1,5,49}, {1,5,49}, {1,5,49},
+    {1,5,49}, {1,5,49}, {23,6,1}, {23,6,1}, {23,6,1}, {23,6,1}, {23,6,1}, {23,6,1},
+    {23,6,1}, {23,6,1}, {187,8,0}, {187,8,0}, {11,8,8}, {11,8,8}, {4,8,23}, {4,8,23},
+    {4,8,31}, {4,8,31}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {12,1,13}, {1,1,140}, {7,1,37}, {2,1,73}, {8,1,27}, {3,1,55},
+    {15,1,9}, {304,1,0}, {17,1,7}, {16,1,8}, {22,1,6}, {1,1,138}, {322,1,0}, {308,1,0},
+    {10,1,17}, {71,1,1}, {247,1,0}, {7,1,34}, {5,1,42}, {26,1,3}, {276,1,0}, {27,1,3},
+    {269,1,0}, {6,1,52}, {281,1,0}, {253,1,0}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17},
+    {1,1,17}, {1,1,17}, {1,1,17}, {1,1,17}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {64,5,0}, {64,5,0}, {64,5,0}, {64,5,0},
+    {64,5,0}, {64,5,0}, {64,5,0}, {64,5,0}, {64,5,0}, {64,5,0}, {64,5,0}, {64,5,0},
+    {64,5,0}, {64,5,0}, {64,5,0}, {64,5,0}, {66,5,0}, {66,5,0}, {66,5,0}, {66,5,0},
+    {66,5,0}, {66,5,0}, {66,5,0}, {66,5,0}, {66,5,0}, {66,5,0}, {66,5,0}, {66,5,0},
+    {66,5,0}, {66,5,0}, {66,5,0}, {66,5,0}, {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0},
+    {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0},
+    {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0},
+    {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0},
+    {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0}, {87,6,0}, {87,6,0}, {87,6,0}, {87,6,0},
+    {87,6,0}, {87,6,0}, {87,6,0}, {87,6,0}, {122,7,0}, {122,7,0}, {122,7,0}, {122,7,0},
+    {5652,-3,0}, {3,9,56}, {213,9,0}, {21,9,3}, {3,5,11}, {3,5,11}, {3,5,11}, {3,5,11},
+    {3,5,11}, {3,5,11}, {3,5,11}, {3,5,11}, {3,5,11}, {3,5,11}, {3,5,11}, {3,5,11},
+    {3,5,11}, {3,5,11}, {3,5,11}, {3,5,11}, {18,5,1}, {18,5,1}, {18,5,1}, {18,5,1},
+    {18,5,1}, {18,5,1}, {18,5,1}, {18,5,1}, {18,5,1}, {18,5,1}, {18,5,1}, {18,5,1},
+    {18,5,1}, {18,5,1}, {18,5,1}, {18,5,1}, {63,5,0}, {63,5,0}, {63,5,0}, {63,5,0},
+    {63,5,0}, {63,5,0}, {63,5,0}, {63,5,0}, {63,5,0}, {63,5,0}, {63,5,0}, {63,5,0},
+    {63,5,0}, {63,5,0}, {63,5,0}, {63,5,0}, {266,1,0}, {266,1,0}, {266,1,0}, {266,1,0},
+    {10,3,28}, {336,3,0}, {329,2,0}, {329,2,0}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0},
+    {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0},
+    {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0},
+    {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0},
+    {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0},
+    {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0},
+    {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0},
+    {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0},
+    {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {8,5,3}, {8,5,3}, {8,5,3}, {8,5,3},
+    {8,5,3}, {8,5,3}, {8,5,3}, {8,5,3}, {8,5,3}, {8,5,3}, {8,5,3}, {8,5,3},
+    {8,5,3}, {8,5,3}, {8,5,3}, {8,5,3}, {4,6,11}, {4,6,11}, {4,6,11}, {4,6,11},
+    {4,6,11}, {4,6,11}, {4,6,11}, {4,6,11}, {3,9,60}, {2,9,67}, {4,9,27}, {6,9,36},
+    {5,9,44}, {239,9,0}, {152,8,0}, {152,8,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0},
+    {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0},
+    {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0},
+    {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0},
+    {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4},
+    {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4},
+    {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4},
+    {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4},
+    {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4},
+    {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4},
+    {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4},
+    {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4},
+    {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {119,7,0}, {119,7,0}, {119,7,0}, {119,7,0},
+    {117,7,0}, {117,7,0}, {117,7,0}, {117,7,0}, {9,6,4}, {9,6,4}, {9,6,4}, {9,6,4},
+    {9,6,4}, {9,6,4}, {9,6,4}, {9,6,4}, {1,6,69}, {1,6,69}, {1,6,69}, {1,6,69},
+    {1,6,69}, {1,6,69}, {1,6,69}, {1,6,69}, {170,8,0}, {170,8,0}, {4,9,45}, {6172,-2,0},
+    {5,7,12}, {5,7,12}, {5,7,12}, {5,7,12}, {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1},
+    {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1},
+    {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1},
+    {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1},
+    {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1}, {30,7,1}, {30,7,1}, {30,7,1}, {30,7,1},
+    {22,8,2}, {22,8,2}, {5,8,18}, {5,8,18}, {89,6,0}, {89,6,0}, {89,6,0}, {89,6,0},
+    {89,6,0}, {89,6,0}, {89,6,0}, {89,6,0}, {84,6,0}, {84,6,0}, {84,6,0}, {84,6,0},
+    {84,6,0}, {84,6,0}, {84,6,0}, {84,6,0}, {166,8,0}, {166,8,0}, {157,8,0}, {157,8,0},
+    {7,7,9}, {7,7,9}, {7,7,9}, {7,7,9}, {2,4,13}, {2,4,13}, {2,4,13}, {2,4,13},
+    {2,4,13}, {2,4,13}, {2,4,13}, {2,4,13}, {2,4,13}, {2,4,13}, {2,4,13}, {2,4,13},
+    {2,4,13}, {2,4,13}, {2,4,13}, {2,4,13}, {2,4,13}, {2,4,13}, {2,4,13}, {2,4,13},
+    {2,4,13}, {2,4,13}, {2,4,13}, {2,4,13}, {2,4,13}, {2,4,13}, {2,4,13}, {2,4,13},
+    {2,4,13}, {2,4,13}, {2,4,13}, {2,4,13}, {1,4,39}, {1,4,39}, {1,4,39}, {1,4,39},
+    {1,4,39}, {1,4,39}, {1,4,39}, {1,4,39}, {1,4,39}, {1,4,39}, {1,4,39}, {1,4,39},
+    {1,4,39}, {1,4,39}, {1,4,39}, {1,4,39}, {1,4,39}, {1,4,39}, {1,4,39}, {1,4,39},
+    {1,4,39}, {1,4,39}, {1,4,39}, {1,4,39}, {1,4,39}, {1,4,39}, {1,4,39}, {1,4,39},
+    {1,4,39}, {1,4,39}, {1,4,39}, {1,4,39}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6},
+    {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6},
+    {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6},
+    {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6},
+    {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {10,2,16}, {8,2,57}, {11,2,20}, {10,2,29},
+    {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10},
+    {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10},
+    {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10},
+    {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10},
+    {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10},
+    {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10},
+    {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10},
+    {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10}, {2,3,10},
+    {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5},
+    {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5},
+    {3,6,16}, {3,6,16}, {3,6,16}, {3,6,16}, {3,6,16}, {3,6,16}, {3,6,16}, {3,6,16},
+    {6688,-2,0}, {6692,-2,0}, {6696,-2,0}, {6700,-2,0}, {6704,-2,0}, {6708,-2,0}, {6712,-2,0}, {6716,-1,0},
+    {6718,-1,0}, {6720,-1,0}, {6722,-1,0}, {6724,-1,0}, {6726,-1,0}, {6728,-1,0}, {6730,-1,0}, {6732,-1,0},
+    {6734,-1,0}, {6736,-1,0}, {6738,-1,0}, {6740,-1,0}, {6742,-1,0}, {6744,-1,0}, {6746,-1,0}, {59,9,1},
+    {229,9,0}, {19,9,4}, {7,9,30}, {2,9,68}, {18,9,4}, {242,9,0}, {22,9,3}, {250,9,0},
+    {220,9,0}, {55,9,1}, {191,9,0}, {6,9,19}, {3,8,38}, {3,8,38}, {179,8,0}, {179,8,0},
+    {4,8,34}, {4,8,34}, {21,8,2}, {21,8,2}, {3,8,40}, {3,8,40}, {24,8,2}, {24,8,2},
+    {114,7,0}, {114,7,0}, {114,7,0}, {114,7,0}, {124,7,0}, {124,7,0}, {124,7,0}, {124,7,0},
+    {2,6,23}, {2,6,23}, {2,6,23}, {2,6,23}, {2,6,23}, {2,6,23}, {2,6,23}, {2,6,23},
+    {1,6,68}, {1,6,68}, {1,6,68}, {1,6,68}, {1,6,68}, {1,6,68}, {1,6,68}, {1,6,68},
+    {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9},
+    {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9},
+    {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9},
+    {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9}, {3,4,9},
+    {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1},
+    {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1},
+    {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1},
+    {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1},
+    {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1},
+    {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1},
+    {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1},
+    {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1},
+    {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23},
+    {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23},
+    {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23},
+    {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23},
+    {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23},
+    {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23},
+    {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23},
+    {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23},
+    {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23},
+    {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23},
+    {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23},
+    {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23},
+    {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23},
+    {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23},
+    {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23},
+    {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23}, {1,2,23},
+    {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31},
+    {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31},
+    {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31},
+    {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31},
+    {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31},
+    {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31},
+    {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31},
+    {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31}, {1,3,31},
+    {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3},
+    {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3},
+    {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3},
+    {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3},
+    {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3},
+    {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3},
+    {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3},
+    {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3},
+    {8,2,54}, {14,2,9}, {8,2,49}, {11,2,24}, {11,2,29}, {8,2,45}, {11,2,18}, {331,2,0},
+    {8,2,38}, {8,2,22}, {8,2,19}, {7,2,56}, {7,2,38}, {7,2,55}, {317,2,0}, {2,2,96},
+    {327,2,0}, {1,2,173}, {6,2,51}, {313,2,0}, {7,2,41}, {318,2,0}, {3,2,65}, {6,2,48},
+    {6,2,42}, {6,2,49}, {320,1,0}, {320,1,0}, {12,1,16}, {10,1,23}, {10,1,24}, {2,1,87},
+    {295,1,0}, {4,1,58}, {5,1,46}, {9,1,30}, {257,1,0}, {243,1,0}, {290,1,0}, {25,1,3},
+    {87,1,1}, {1,1,158}, {18,1,7}, {3,1,77}, {32,1,3}, {287,1,0}, {7,1,23}, {286,1,0},
+    {1,1,155}, {14,1,16}, {19,1,9}, {1,1,169}, {22,1,5}, {1,1,159}, {10,1,39}, {7,1,54},
+    {7,1,59}, {7,1,39}, {272,1,0}, {8,1,39}, {19,1,0}, {19,1,0}, {26,2,0}, {4,2,3},
+    {1,7,82}, {1,7,82}, {1,7,82}, {1,7,82}, {116,7,0}, {116,7,0}, {116,7,0}, {116,7,0},
+    {127,7,0}, {127,7,0}, {127,7,0}, {127,7,0}, {3,7,34}, {3,7,34}, {3,7,34}, {3,7,34},
+    {3,8,44}, {3,8,44}, {155,8,0}, {155,8,0}, {10,8,9}, {10,8,9}, {4,8,25}, {4,8,25},
+    {164,8,0}, {164,8,0}, {3,9,42}, {199,9,0}, {3,7,20}, {3,7,20}, {3,7,20}, {3,7,20},
+    {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0},
+    {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0},
+    {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0},
+    {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0},
+    {8,6,5}, {8,6,5}, {8,6,5}, {8,6,5}, {8,6,5}, {8,6,5}, {8,6,5}, {8,6,5},
+    {4,9,53}, {30,9,2}, {7,9,16}, {208,9,0}, {2,9,71}, {4,9,48}, {4,9,54}, {205,9,0},
+    {12,9,10}, {6,9,24}, {17,9,4}, {6,9,23}, {218,9,0}, {5,9,22}, {43,8,1}, {43,8,1},
+    {1,8,101}, {1,8,101}, {14,8,5}, {14,8,5}, {50,8,1}, {50,8,1}, {7,8,14}, {7,8,14},
+    {1,6,72}, {1,6,72}, {1,6,72}, {1,6,72}, {1,6,72}, {1,6,72}, {1,6,72}, {1,6,72},
+    {1,7,88}, {1,7,88}, {1,7,88}, {1,7,88}, {120,7,0}, {120,7,0}, {120,7,0}, {120,7,0},
+    {1,5,52}, {1,5,52}, {1,5,52}, {1,5,52}, {1,5,52}, {1,5,52}, {1,5,52}, {1,5,52},
+    {1,5,52}, {1,5,52}, {1,5,52}, {1,5,52}, {1,5,52}, {1,5,52}, {1,5,52}, {1,5,52},
+    {2,5,18}, {2,5,18}, {2,5,18}, {2,5,18}, {2,5,18}, {2,5,18}, {2,5,18}, {2,5,18},
+    {2,5,18}, {2,5,18}, {2,5,18}, {2,5,18}, {2,5,18}, {2,5,18}, {2,5,18}, {2,5,18},
+    {65,5,0}, {65,5,0}, {65,5,0}, {65,5,0}, {65,5,0}, {65,5,0}, {65,5,0}, {65,5,0},
+    {65,5,0}, {65,5,0}, {65,5,0}, {65,5,0}, {65,5,0}, {65,5,0}, {65,5,0}, {65,5,0},
+    {67,5,0}, {67,5,0}, {67,5,0}, {67,5,0}, {67,5,0}, {67,5,0}, {67,5,0}, {67,5,0},
+    {67,5,0}, {67,5,0}, {67,5,0}, {67,5,0}, {67,5,0}, {67,5,0}, {67,5,0}, {67,5,0},
+    {90,6,0}, {90,6,0}, {90,6,0}, {90,6,0}, {90,6,0}, {90,6,0}, {90,6,0}, {90,6,0},
+    {167,8,0}, {167,8,0}, {1,8,119}, {1,8,119}, {2,7,39}, {2,7,39}, {2,7,39}, {2,7,39},
+    {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0},
+    {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0},
+    {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0},
+    {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0},
+    {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40},
+    {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40},
+    {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40},
+    {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40}, {1,4,40},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6}, {2,1,6},
+    {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8},
+    {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8},
+    {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8},
+    {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8},
+    {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8},
+    {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8},
+    {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8},
+    {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8},
+    {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8},
+    {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8},
+    {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8},
+    {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8},
+    {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8},
+    {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8},
+    {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8},
+    {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8}, {2,2,8},
+    {3,7,35}, {3,7,35}, {3,7,35}, {3,7,35}, {115,7,0}, {115,7,0}, {115,7,0}, {115,7,0},
+    {95,6,0}, {95,6,0}, {95,6,0}, {95,6,0}, {95,6,0}, {95,6,0}, {95,6,0}, {95,6,0},
+    {24,6,1}, {24,6,1}, {24,6,1}, {24,6,1}, {24,6,1}, {24,6,1}, {24,6,1}, {24,6,1},
+    {14,6,2}, {14,6,2}, {14,6,2}, {14,6,2}, {14,6,2}, {14,6,2}, {14,6,2}, {14,6,2},
+    {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9},
+    {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9},
+    {1,8,111}, {1,8,111}, {7776,-3,0}, {7784,-1,0}, {9,7,7}, {9,7,7}, {9,7,7}, {9,7,7},
+    {6,6,8}, {6,6,8}, {6,6,8}, {6,6,8}, {6,6,8}, {6,6,8}, {6,6,8}, {6,6,8},
+    {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0},
+    {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0},
+    {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0},
+    {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0},
+    {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0},
+    {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0},
+    {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0},
+    {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0}, {36,3,0},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18}, {1,1,18},
+    {311,2,0}, {311,2,0}, {3,3,74}, {7,3,57}, {259,1,0}, {259,1,0}, {259,1,0}, {259,1,0},
+    {10,1,32}, {258,1,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0},
+    {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0},
+    {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0},
+    {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0},
+    {49,4,0}, {49,4,0}, {2,6,34}, {2,6,34}, {2,6,34}, {2,6,34}, {2,6,34}, {2,6,34},
+    {2,6,34}, {2,6,34}, {8298,-1,0}, {8300,-1,0}, {8302,-1,0}, {8304,-1,0}, {8306,-1,0}, {8308,-1,0},
+    {8310,-1,0}, {8312,-1,0}, {1,5,53}, {1,5,53}, {1,5,53}, {1,5,53}, {1,5,53}, {1,5,53},
+    {1,5,53}, {1,5,53}, {1,5,53}, {1,5,53}, {1,5,53}, {1,5,53}, {1,5,53}, {1,5,53},
+    {1,5,53}, {1,5,53}, {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41},
+    {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41},
+    {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41},
+    {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41}, {1,4,41},
+    {1,4,41}, {1,4,41}, {8314,-1,0}, {8316,-1,0}, {8318,-1,0}, {8320,-1,0}, {8322,-1,0}, {8324,-1,0},
+    {8326,-1,0}, {8328,-1,0}, {8330,-1,0}, {8332,-1,0}, {2,9,69}, {64,9,1}, {66,9,1}, {8,9,17},
+    {1,9,152}, {206,9,0}, {10,9,18}, {2,9,66}, {2,9,63}, {2,9,77}, {4,9,46}, {6,9,32},
+    {6,9,30}, {1,9,139}, {5,9,37}, {12,9,9}, {13,9,8}, {29,9,2}, {14,9,7}, {14,9,8},
+    {172,8,0}, {172,8,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0},
+    {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0},
+    {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0},
+    {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0},
+    {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0},
+    {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0},
+    {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0},
+    {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0},
+    {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0},
+    {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0},
+    {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0},
+    {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0},
+    {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0},
+    {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0},
+    {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0},
+    {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0}, {27,2,0},
+    {27,2,0}, {27,2,0}, {4,8,28}, {4,8,28}, {42,8,1}, {42,8,1}, {160,8,0}, {160,8,0},
+    {23,8,2}, {23,8,2}, {8,7,8}, {8,7,8}, {8,7,8}, {8,7,8}, {121,7,0}, {121,7,0},
+    {121,7,0}, {121,7,0}, {31,7,1}, {31,7,1}, {31,7,1}, {31,7,1}, {35,7,1}, {35,7,1},
+    {35,7,1}, {35,7,1}, {4,6,12}, {4,6,12}, {4,6,12}, {4,6,12}, {4,6,12}, {4,6,12},
+    {4,6,12}, {4,6,12}, {7,6,7}, {7,6,7}, {7,6,7}, {7,6,7}, {7,6,7}, {7,6,7},
+    {7,6,7}, {7,6,7}, {4,7,17}, {4,7,17}, {4,7,17}, {4,7,17}, {3,7,36}, {3,7,36},
+    {3,7,36}, {3,7,36}, {19,5,1}, {19,5,1}, {19,5,1}, {19,5,1}, {19,5,1}, {19,5,1},
+    {19,5,1}, {19,5,1}, {19,5,1}, {19,5,1}, {19,5,1}, {19,5,1}, {19,5,1}, {19,5,1},
+    {19,5,1}, {19,5,1}, {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14},
+    {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14},
+    {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14},
+    {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14}, {2,4,14},
+    {2,4,14}, {2,4,14}, {4,7,18}, {4,7,18}, {4,7,18}, {4,7,18}, {225,9,0}, {3,9,48},
+    {175,8,0}, {175,8,0}, {2,6,25}, {2,6,25}, {2,6,25}, {2,6,25}, {2,6,25}, {2,6,25},
+    {2,6,25}, {2,6,25}, {123,7,0}, {123,7,0}, {123,7,0}, {123,7,0}, {9,7,6}, {9,7,6},
+    {9,7,6}, {9,7,6}, {25,6,1}, {25,6,1}, {25,6,1}, {25,6,1}, {25,6,1}, {25,6,1},
+    {25,6,1}, {25,6,1}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32},
+    {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32},
+    {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32},
+    {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32},
+    {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32},
+    {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32},
+    {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32},
+    {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32}, {1,3,32},
+    {1,3,32}, {1,3,32}, {2,6,28}, {2,6,28}, {2,6,28}, {2,6,28}, {2,6,28}, {2,6,28},
+    {2,6,28}, {2,6,28}, {1,7,87}, {1,7,87}, {1,7,87}, {1,7,87}, {150,8,0}, {150,8,0},
+    {1,9,129}, {6,9,60}, {68,5,0}, {68,5,0}, {68,5,0}, {68,5,0}, {68,5,0}, {68,5,0},
+    {68,5,0}, {68,5,0}, {68,5,0}, {68,5,0}, {68,5,0}, {68,5,0}, {68,5,0}, {68,5,0},
+    {68,5,0}, {68,5,0}, {2,6,27}, {2,6,27}, {2,6,27}, {2,6,27}, {2,6,27}, {2,6,27},
+    {2,6,27}, {2,6,27}, {1,6,70}, {1,6,70}, {1,6,70}, {1,6,70}, {1,6,70}, {1,6,70},
+    {1,6,70}, {1,6,70}, {69,5,0}, {69,5,0}, {69,5,0}, {69,5,0}, {69,5,0}, {69,5,0},
+    {69,5,0}, {69,5,0}, {69,5,0}, {69,5,0}, {69,5,0}, {69,5,0}, {69,5,0}, {69,5,0},
+    {69,5,0}, {69,5,0}, {11,1,12}, {11,1,32}, {9,1,24}, {57,1,2}, {8,1,53}, {40,1,2},
+    {13,1,12}, {8,1,33}, {81,1,1}, {8,1,30}, {8,1,29}, {15,1,11}, {34,1,3}, {16,1,9},
+    {8,1,35}, {32,1,4}, {86,1,1}, {88,1,1}, {6,1,41}, {296,1,0}, {1,1,148}, {303,1,0},
+    {326,1,0}, {323,1,0}, {305,1,0}, {275,1,0}, {4,1,49}, {7,1,26}, {321,1,0}, {2,1,81},
+    {2,1,92}, {312,1,0}, {280,1,0}, {3,1,72}, {5,1,41}, {7,1,33}, {1,2,24}, {1,2,24},
+    {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24},
+    {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24},
+    {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24},
+    {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24}, {1,2,24}, {37,3,0}, {37,3,0},
+    {37,3,0}, {37,3,0}, {37,3,0}, {37,3,0}, {37,3,0}, {37,3,0}, {37,3,0}, {37,3,0},
+    {37,3,0}, {37,3,0}, {37,3,0}, {37,3,0}, {37,3,0}, {37,3,0}, {11,5,2}, {11,5,2},
+    {11,5,2}, {11,5,2}, {1,7,89}, {18,7,2}, {109,7,0}, {130,7,0}, {51,4,0}, {51,4,0},
+    {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {20,1,0}, {20,1,0},
+    {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0},
+    {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0},
+    {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0},
+    {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0},
+    {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0},
+    {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0},
+    {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0},
+    {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {20,1,0}, {6,9,33}, {6,9,26},
+    {1,9,135}, {227,9,0}, {9,9,15}, {56,9,1}, {18,9,5}, {60,9,1}, {10,9,12}, {7,9,35},
+    {2,9,75}, {221,9,0}, {13,9,10}, {1,9,147}, {214,9,0}, {23,9,3}, {1,5,55}, {1,5,55},
+    {1,5,55}, {1,5,55}, {1,5,55}, {1,5,55}, {1,5,55}, {1,5,55}, {1,5,55}, {1,5,55},
+    {1,5,55}, {1,5,55}, {1,5,55}, {1,5,55}, {1,5,55}, {1,5,55}, {48,8,1}, {48,8,1},
+    {2,8,56}, {2,8,56}, {183,8,0}, {183,8,0}, {4,8,26}, {4,8,26}, {5,7,14}, {5,7,14},
+    {5,7,14}, {5,7,14}, {1,8,112}, {1,8,112}, {186,8,0}, {186,8,0}, {1,6,71}, {1,6,71},
+    {1,6,71}, {1,6,71}, {1,6,71}, {1,6,71}, {1,6,71}, {1,6,71}, {3,7,21}, {3,7,21},
+    {3,7,21}, {3,7,21}, {4,8,39}, {4,8,39}, {177,8,0}, {177,8,0}, {38,3,0}, {38,3,0},
+    {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0},
+    {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0},
+    {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0},
+    {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0},
+    {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0},
+    {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0},
+    {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0},
+    {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {38,3,0}, {91,6,0}, {91,6,0},
+    {91,6,0}, {91,6,0}, {91,6,0}, {91,6,0}, {91,6,0}, {91,6,0}, {6,6,9}, {6,6,9},
+    {6,6,9}, {6,6,9}, {6,6,9}, {6,6,9}, {6,6,9}, {6,6,9}, {7,8,13}, {7,8,13},
+    {3,8,45}, {3,8,45}, {3,7,23}, {3,7,23}, {3,7,23}, {3,7,23}, {126,7,0}, {126,7,0},
+    {126,7,0}, {126,7,0}, {171,8,0}, {171,8,0}, {8974,-2,0}, {8978,-2,0}, {52,4,0}, {52,4,0},
+    {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0},
+    {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0},
+    {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0},
+    {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0}, {52,4,0}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {28,2,0}, {28,2,0},
+    {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0},
+    {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0},
+    {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0},
+    {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0},
+    {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0},
+    {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0},
+    {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0},
+    {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0},
+    {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0},
+    {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0},
+    {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0},
+    {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0},
+    {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0},
+    {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0},
+    {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0},
+    {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {28,2,0}, {4,6,13}, {4,6,13},
+    {4,6,13}, {4,6,13}, {4,6,13}, {4,6,13}, {4,6,13}, {4,6,13}, {8,6,6}, {8,6,6},
+    {8,6,6}, {8,6,6}, {8,6,6}, {8,6,6}, {8,6,6}, {8,6,6}, {93,6,0}, {93,6,0},
+    {93,6,0}, {93,6,0}, {93,6,0}, {93,6,0}, {93,6,0}, {93,6,0}, {11,6,3}, {11,6,3},
+    {11,6,3}, {11,6,3}, {11,6,3}, {11,6,3}, {11,6,3}, {11,6,3}, {15,6,2}, {15,6,2},
+    {15,6,2}, {15,6,2}, {15,6,2}, {15,6,2}, {15,6,2}, {15,6,2}, {15,7,3}, {15,7,3},
+    {15,7,3}, {15,7,3}, {8982,-2,0}, {8986,-2,0}, {8990,-2,0}, {8994,-1,0}, {1,5,54}, {1,5,54},
+    {1,5,54}, {1,5,54}, {1,5,54}, {1,5,54}, {1,5,54}, {1,5,54}, {1,5,54}, {1,5,54},
+    {1,5,54}, {1,5,54}, {1,5,54}, {1,5,54}, {1,5,54}, {1,5,54}, {1,5,57}, {1,5,57},
+    {1,5,57}, {1,5,57}, {1,5,57}, {1,5,57}, {1,5,57}, {1,5,57}, {1,5,57}, {1,5,57},
+    {1,5,57}, {1,5,57}, {1,5,57}, {1,5,57}, {1,5,57}, {1,5,57}, {5,5,8}, {5,5,8},
+    {5,5,8}, {5,5,8}, {5,5,8}, {5,5,8}, {5,5,8}, {5,5,8}, {5,5,8}, {5,5,8},
+    {5,5,8}, {5,5,8}, {5,5,8}, {5,5,8}, {5,5,8}, {5,5,8}, {8996,-1,0}, {8998,-1,0},
+    {9000,-1,0}, {9002,-1,0}, {9004,-1,0}, {9006,-1,0}, {9008,-1,0}, {9010,-1,0}, {9012,-1,0}, {9014,-1,0},
+    {9016,-1,0}, {9018,-1,0}, {9020,-1,0}, {9022,-1,0}, {9024,-1,0}, {9026,-1,0}, {9028,-1,0}, {9030,-1,0},
+    {9032,-1,0}, {9034,-1,0}, {9036,-1,0}, {9038,-1,0}, {9040,-1,0}, {9042,-1,0}, {9044,-1,0}, {9046,-1,0},
+    {61,9,1}, {1,9,127}, {9,9,17}, {238,9,0}, {241,9,0}, {58,9,1}, {8,2,42}, {9,2,27},
+    {8,2,55}, {9,2,28}, {8,2,48}, {7,2,51}, {10,2,36}, {10,2,21}, {10,2,25}, {2,2,97},
+    {13,2,15}, {1,2,174}, {10,2,38}, {13,2,14}, {2,2,103}, {11,2,25}, {2,2,107}, {1,2,175},
+    {11,2,27}, {11,2,34}, {8,1,36}, {339,1,0}, {334,1,0}, {270,1,0}, {8,1,41}, {85,1,1},
+    {8,1,21}, {7,1,24}, {9,1,19}, {7,1,22}, {6,1,61}, {265,1,0}, {6,1,58}, {9,1,20},
+    {8,1,43}, {299,1,0}, {9,1,23}, {25,1,4}, {12,1,12}, {2,1,98}, {1,1,146}, {10,1,40},
+    {11,1,16}, {4,1,55}, {18,1,10}, {309,1,0}, {1,1,156}, {6,1,25}, {17,1,8}, {15,1,10},
+    {14,1,18}, {13,1,16}, {12,1,18}, {21,1,7}, {26,1,4}, {5,1,48}, {10,1,33}, {10,1,34},
+    {11,1,40}, {4,1,62}, {3,1,71}, {4,1,57}, {4,1,56}, {2,1,104}, {11,1,22}, {340,1,0},
+    {2,1,95}, {11,1,17}, {43,1,3}, {2,1,84}, {45,1,2}, {11,1,30}, {3,1,63}, {47,1,2},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {222,9,0}, {14,9,10}, {22,9,4}, {2,9,85}, {18,9,6}, {200,9,0}, {4,9,42}, {195,9,0},
+    {6,9,34}, {35,9,2}, {7,9,21}, {7,9,40}, {8,9,31}, {17,9,6}, {224,9,0}, {273,9,0},
+    {194,8,0}, {194,8,0}, {4,8,24}, {4,8,24}, {2,8,53}, {2,8,53}, {1,8,107}, {1,8,107},
+    {1,8,116}, {1,8,116}, {46,8,1}, {46,8,1}, {7,8,15}, {7,8,15}, {10,8,10}, {10,8,10},
+    {1,8,110}, {1,8,110}, {169,8,0}, {169,8,0}, {1,7,91}, {1,7,91}, {1,7,91}, {1,7,91},
+    {12,7,4}, {12,7,4}, {12,7,4}, {12,7,4}, {5,7,15}, {5,7,15}, {5,7,15}, {5,7,15},
+    {1,6,74}, {1,6,74}, {1,6,74}, {1,6,74}, {1,6,74}, {1,6,74}, {1,6,74}, {1,6,74},
+    {3,7,22}, {3,7,22}, {3,7,22}, {3,7,22}, {34,7,1}, {34,7,1}, {34,7,1}, {34,7,1},
+    {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0},
+    {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0},
+    {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0},
+    {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0}, {53,4,0},
+    {20,5,1}, {20,5,1}, {20,5,1}, {20,5,1}, {20,5,1}, {20,5,1}, {20,5,1}, {20,5,1},
+    {20,5,1}, {20,5,1}, {20,5,1}, {20,5,1}, {20,5,1}, {20,5,1}, {20,5,1}, {20,5,1},
+    {2,6,26}, {2,6,26}, {2,6,26}, {2,6,26}, {2,6,26}, {2,6,26}, {2,6,26}, {2,6,26},
+    {3,6,17}, {3,6,17}, {3,6,17}, {3,6,17}, {3,6,17}, {3,6,17}, {3,6,17}, {3,6,17},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19}, {1,1,19},
+    {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4},
+    {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4},
+    {1,7,92}, {1,7,92}, {1,7,92}, {1,7,92}, {5,8,31}, {5,8,31}, {188,8,0}, {188,8,0},
+    {92,6,0}, {92,6,0}, {92,6,0}, {92,6,0}, {92,6,0}, {92,6,0}, {92,6,0}, {92,6,0},
+    {2,5,19}, {2,5,19}, {2,5,19}, {2,5,19}, {2,5,19}, {2,5,19}, {2,5,19}, {2,5,19},
+    {2,5,19}, {2,5,19}, {2,5,19}, {2,5,19}, {2,5,19}, {2,5,19}, {2,5,19}, {2,5,19},
+    {45,8,1}, {45,8,1}, {176,8,0}, {176,8,0}, {18,8,3}, {18,8,3}, {6,8,17}, {6,8,17},
+    {1,6,73}, {1,6,73}, {1,6,73}, {1,6,73}, {1,6,73}, {1,6,73}, {1,6,73}, {1,6,73},
+    {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7},
+    {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7},
+    {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7},
+    {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7},
+    {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43},
+    {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43},
+    {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43},
+    {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43}, {1,4,43},
+    {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1},
+    {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1},
+    {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1},
+    {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1},
+    {98,6,0}, {98,6,0}, {98,6,0}, {98,6,0}, {98,6,0}, {98,6,0}, {98,6,0}, {98,6,0},
+    {125,7,0}, {125,7,0}, {125,7,0}, {125,7,0}, {33,7,1}, {33,7,1}, {33,7,1}, {33,7,1},
+    {99,6,0}, {99,6,0}, {99,6,0}, {99,6,0}, {99,6,0}, {99,6,0}, {99,6,0}, {99,6,0},
+    {19,7,2}, {19,7,2}, {19,7,2}, {19,7,2}, {10072,-1,0}, {1,9,144}, {65,9,1}, {69,9,1},
+    {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2},
+    {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2},
+    {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2},
+    {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2},
+    {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2},
+    {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2},
+    {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2},
+    {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33},
+    {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33},
+    {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33},
+    {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33},
+    {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33},
+    {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33},
+    {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33},
+    {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33}, {1,3,33},
+    {26,6,1}, {26,6,1}, {26,6,1}, {26,6,1}, {26,6,1}, {26,6,1}, {26,6,1}, {26,6,1},
+    {5,6,10}, {5,6,10}, {5,6,10}, {5,6,10}, {5,6,10}, {5,6,10}, {5,6,10}, {5,6,10},
+    {101,6,0}, {101,6,0}, {101,6,0}, {101,6,0}, {101,6,0}, {101,6,0}, {101,6,0}, {101,6,0},
+    {2,6,29}, {2,6,29}, {2,6,29}, {2,6,29}, {2,6,29}, {2,6,29}, {2,6,29}, {2,6,29},
+    {255,9,0}, {24,9,3}, {9,9,12}, {19,9,5}, {219,9,0}, {2,9,79}, {230,9,0}, {2,9,70},
+    {6,9,38}, {6,9,39}, {2,9,76}, {5,9,45}, {5,9,38}, {6,9,37}, {28,9,2}, {1,9,134},
+    {163,8,0}, {163,8,0}, {12,8,7}, {12,8,7}, {6,8,18}, {6,8,18}, {8,8,11}, {8,8,11},
+    {2,8,58}, {2,8,58}, {44,8,1}, {44,8,1}, {1,8,109}, {1,8,109}, {204,8,0}, {204,8,0},
+    {3,1,62}, {3,1,73}, {7,1,1}, {21,1,0}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25},
+    {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25},
+    {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25},
+    {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25},
+    {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25},
+    {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25},
+    {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25},
+    {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25},
+    {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25},
+    {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25},
+    {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25},
+    {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25},
+    {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25},
+    {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25},
+    {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25},
+    {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25},
+    {1,2,25}, {1,2,25}, {1,2,25}, {1,2,25}, {11,7,5}, {11,7,5}, {11,7,5}, {11,7,5},
+    {137,7,0}, {137,7,0}, {137,7,0}, {137,7,0}, {10,7,6}, {10,7,6}, {10,7,6}, {10,7,6},
+    {2,7,42}, {2,7,42}, {2,7,42}, {2,7,42}, {94,6,0}, {94,6,0}, {94,6,0}, {94,6,0},
+    {94,6,0}, {94,6,0}, {94,6,0}, {94,6,0}, {2,6,36}, {2,6,36}, {2,6,36}, {2,6,36},
+    {2,6,36}, {2,6,36}, {2,6,36}, {2,6,36}, {70,5,0}, {70,5,0}, {70,5,0}, {70,5,0},
+    {70,5,0}, {70,5,0}, {70,5,0}, {70,5,0}, {70,5,0}, {70,5,0}, {70,5,0}, {70,5,0},
+    {70,5,0}, {70,5,0}, {70,5,0}, {70,5,0}, {72,5,0}, {72,5,0}, {72,5,0}, {72,5,0},
+    {72,5,0}, {72,5,0}, {72,5,0}, {72,5,0}, {72,5,0}, {72,5,0}, {72,5,0}, {72,5,0},
+    {72,5,0}, {72,5,0}, {72,5,0}, {72,5,0}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34},
+    {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34},
+    {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34},
+    {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34},
+    {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34},
+    {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34},
+    {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34},
+    {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34},
+    {1,3,34}, {1,3,34}, {1,3,34}, {1,3,34}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3},
+    {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3},
+    {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3},
+    {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3},
+    {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {1,4,42}, {1,4,42}, {1,4,42}, {1,4,42},
+    {1,4,42}, {1,4,42}, {1,4,42}, {1,4,42}, {1,4,42}, {1,4,42}, {1,4,42}, {1,4,42},
+    {1,4,42}, {1,4,42}, {1,4,42}, {1,4,42}, {1,4,42}, {1,4,42}, {1,4,42}, {1,4,42},
+    {1,4,42}, {1,4,42}, {1,4,42}, {1,4,42}, {1,4,42}, {1,4,42}, {1,4,42}, {1,4,42},
+    {1,4,42}, {1,4,42}, {1,4,42}, {1,4,42}, {5,8,19}, {5,8,19}, {6,9,28}, {10588,-1,0},
+    {129,7,0}, {129,7,0}, {129,7,0}, {129,7,0}, {1,7,93}, {1,7,93}, {1,7,93}, {1,7,93},
+    {3,7,25}, {3,7,25}, {3,7,25}, {3,7,25}, {1,5,58}, {1,5,58}, {1,5,58}, {1,5,58},
+    {1,5,58}, {1,5,58}, {1,5,58}, {1,5,58}, {1,5,58}, {1,5,58}, {1,5,58}, {1,5,58},
+    {1,5,58}, {1,5,58}, {1,5,58}, {1,5,58}, {12,5,2}, {12,5,2}, {12,5,2}, {12,5,2},
+    {12,5,2}, {12,5,2}, {12,5,2}, {12,5,2}, {12,5,2}, {12,5,2}, {12,5,2}, {12,5,2},
+    {12,5,2}, {12,5,2}, {12,5,2}, {12,5,2}, {1,7,90}, {1,7,90}, {1,7,90}, {1,7,90},
+    {2,7,40}, {2,7,40}, {2,7,40}, {2,7,40}, {12,6,3}, {12,6,3}, {12,6,3}, {12,6,3},
+    {12,6,3}, {12,6,3}, {12,6,3}, {12,6,3}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2},
+    {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2},
+    {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2},
+    {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2},
+    {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5},
+    {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5},
+    {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5},
+    {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5},
+    {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0},
+    {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0},
+    {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0},
+    {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0},
+    {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0},
+    {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0},
+    {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0},
+    {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0},
+    {39,3,0}, {39,3,0}, {39,3,0}, {39,3,0}, {6,1,59}, {293,1,0}, {29,2,0}, {29,2,0},
+    {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0},
+    {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0},
+    {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0},
+    {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0},
+    {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0},
+    {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0},
+    {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0},
+    {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0},
+    {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0},
+    {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0},
+    {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0},
+    {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0},
+    {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0},
+    {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0},
+    {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0},
+    {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {29,2,0}, {2,4,15}, {2,4,15},
+    {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15},
+    {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15},
+    {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15},
+    {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15}, {2,4,15}, {97,6,0}, {97,6,0},
+    {97,6,0}, {97,6,0}, {97,6,0}, {97,6,0}, {97,6,0}, {97,6,0}, {107,6,0}, {107,6,0},
+    {107,6,0}, {107,6,0}, {107,6,0}, {107,6,0}, {107,6,0}, {107,6,0}, {73,5,0}, {73,5,0},
+    {73,5,0}, {73,5,0}, {73,5,0}, {73,5,0}, {73,5,0}, {73,5,0}, {73,5,0}, {73,5,0},
+    {73,5,0}, {73,5,0}, {73,5,0}, {73,5,0}, {73,5,0}, {73,5,0}, {2,3,11}, {2,3,11},
+    {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11},
+    {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11},
+    {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11},
+    {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11},
+    {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11},
+    {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11},
+    {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11},
+    {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {2,3,11}, {12,3,1}, {12,3,1},
+    {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1},
+    {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1},
+    {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1},
+    {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1},
+    {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1},
+    {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1},
+    {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1},
+    {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {1,8,106}, {1,8,106},
+    {1,8,118}, {1,8,118}, {9,8,10}, {9,8,10}, {11102,-1,0}, {11104,-1,0}, {5,7,16}, {5,7,16},
+    {5,7,16}, {5,7,16}, {2,7,52}, {2,7,52}, {2,7,52}, {2,7,52}, {3,5,12}, {3,5,12},
+    {3,5,12}, {3,5,12}, {3,5,12}, {3,5,12}, {3,5,12}, {3,5,12}, {3,5,12}, {3,5,12},
+    {3,5,12}, {3,5,12}, {3,5,12}, {3,5,12}, {3,5,12}, {3,5,12}, {3,5,13}, {3,5,13},
+    {3,5,13}, {3,5,13}, {3,5,13}, {3,5,13}, {3,5,13}, {3,5,13}, {3,5,13}, {3,5,13},
+    {3,5,13}, {3,5,13}, {3,5,13}, {3,5,13}, {3,5,13}, {3,5,13}, {6,5,6}, {6,5,6},
+    {6,5,6}, {6,5,6}, {6,5,6}, {6,5,6}, {6,5,6}, {6,5,6}, {6,5,6}, {6,5,6},
+    {6,5,6}, {6,5,6}, {6,5,6}, {6,5,6}, {6,5,6}, {6,5,6}, {3,7,33}, {3,7,33},
+    {3,7,33}, {3,7,33}, {2,7,45}, {2,7,45}, {2,7,45}, {2,7,45}, {96,6,0}, {96,6,0},
+    {96,6,0}, {96,6,0}, {96,6,0}, {96,6,0}, {96,6,0}, {96,6,0}, {2,6,30}, {2,6,30},
+    {2,6,30}, {2,6,30}, {2,6,30}, {2,6,30}, {2,6,30}, {2,6,30}, {102,6,0}, {102,6,0},
+    {102,6,0}, {102,6,0}, {102,6,0}, {102,6,0}, {102,6,0}, {102,6,0}, {75,5,0}, {75,5,0},
+    {75,5,0}, {75,5,0}, {75,5,0}, {75,5,0}, {75,5,0}, {75,5,0}, {75,5,0}, {75,5,0},
+    {75,5,0}, {75,5,0}, {75,5,0}, {75,5,0}, {75,5,0}, {75,5,0}, {131,7,0}, {131,7,0},
+    {131,7,0}, {131,7,0}, {11106,-1,0}, {11108,-1,0}, {11110,-1,0}, {11112,-1,0}, {2,6,35}, {2,6,35},
+    {2,6,35}, {2,6,35}, {2,6,35}, {2,6,35}, {2,6,35}, {2,6,35}, {3,6,18}, {3,6,18},
+    {3,6,18}, {3,6,18}, {3,6,18}, {3,6,18}, {3,6,18}, {3,6,18}, {11114,-1,0}, {11116,-1,0},
+    {11118,-1,0}, {11120,-1,0}, {11122,-1,0}, {11124,-1,0}, {11126,-1,0}, {11128,-1,0}, {1,5,56}, {1,5,56},
+    {1,5,56}, {1,5,56}, {1,5,56}, {1,5,56}, {1,5,56}, {1,5,56}, {1,5,56}, {1,5,56},
+    {1,5,56}, {1,5,56}, {1,5,56}, {1,5,56}, {1,5,56}, {1,5,56}, {10,9,13}, {5,9,40},
+    {9,9,32}, {9,9,31}, {20,9,5}, {7,9,27}, {1,9,136}, {20,9,4}, {223,9,0}, {8,9,32},
+    {233,9,0}, {7,9,19}, {6,9,31}, {17,9,5}, {5,9,43}, {5,9,52}, {6,9,40}, {4,9,50},
+    {4,9,61}, {1,9,141}, {4,9,47}, {72,9,1}, {267,9,0}, {3,9,57}, {181,8,0}, {181,8,0},
+    {4,8,40}, {4,8,40}, {4,8,32}, {4,8,32}, {8,8,12}, {8,8,12}, {3,1,70}, {10,1,35},
+    {297,1,0}, {7,1,46}, {5,1,51}, {2,1,105}, {6,1,50}, {10,1,20}, {21,1,5}, {6,1,46},
+    {2,1,100}, {6,1,47}, {9,1,26}, {1,1,171}, {324,1,0}, {23,1,4}, {11,1,36}, {1,1,151},
+    {279,1,0}, {19,1,6}, {2,1,86}, {8,1,25}, {18,1,8}, {278,1,0}, {1,1,163}, {12,1,14},
+    {1,1,166}, {1,1,177}, {103,6,0}, {103,6,0}, {103,6,0}, {103,6,0}, {103,6,0}, {103,6,0},
+    {103,6,0}, {103,6,0}, {2,6,33}, {2,6,33}, {2,6,33}, {2,6,33}, {2,6,33}, {2,6,33},
+    {2,6,33}, {2,6,33}, {4,8,38}, {4,8,38}, {4,8,51}, {4,8,51}, {10,7,7}, {10,7,7},
+    {10,7,7}, {10,7,7}, {1,6,76}, {1,6,76}, {1,6,76}, {1,6,76}, {1,6,76}, {1,6,76},
+    {1,6,76}, {1,6,76}, {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0},
+    {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0},
+    {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0},
+    {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0}, {54,4,0},
+    {54,4,0}, {54,4,0}, {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0},
+    {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0},
+    {74,5,0}, {74,5,0}, {28,6,1}, {28,6,1}, {28,6,1}, {28,6,1}, {28,6,1}, {28,6,1},
+    {28,6,1}, {28,6,1}, {2,8,55}, {2,8,55}, {2,8,59}, {2,8,59}, {1,8,115}, {1,8,115},
+    {192,8,0}, {192,8,0}, {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0},
+    {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0},
+    {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0},
+    {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0}, {55,4,0},
+    {55,4,0}, {55,4,0}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26},
+    {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26},
+    {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26},
+    {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26},
+    {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26},
+    {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26},
+    {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26},
+    {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26},
+    {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26},
+    {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26},
+    {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26},
+    {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26},
+    {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26},
+    {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26},
+    {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26},
+    {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26}, {1,2,26},
+    {1,2,26}, {1,2,26}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35},
+    {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35},
+    {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35},
+    {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35},
+    {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35},
+    {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35},
+    {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35},
+    {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35}, {1,3,35},
+    {1,3,35}, {1,3,35}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0},
+    {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0},
+    {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0},
+    {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0},
+    {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0},
+    {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0},
+    {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0},
+    {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0}, {40,3,0},
+    {40,3,0}, {40,3,0}, {4,8,52}, {4,8,52}, {180,8,0}, {180,8,0}, {5,8,34}, {5,8,34},
+    {178,8,0}, {178,8,0}, {6,7,11}, {6,7,11}, {6,7,11}, {6,7,11}, {3,7,24}, {3,7,24},
+    {3,7,24}, {3,7,24}, {71,5,0}, {71,5,0}, {71,5,0}, {71,5,0}, {71,5,0}, {71,5,0},
+    {71,5,0}, {71,5,0}, {71,5,0}, {71,5,0}, {71,5,0}, {71,5,0}, {71,5,0}, {71,5,0},
+    {71,5,0}, {71,5,0}, {9,5,3}, {9,5,3}, {9,5,3}, {9,5,3}, {9,5,3}, {9,5,3},
+    {9,5,3}, {9,5,3}, {9,5,3}, {9,5,3}, {9,5,3}, {9,5,3}, {9,5,3}, {9,5,3},
+    {9,5,3}, {9,5,3}, {1,8,121}, {1,8,121}, {11642,-3,0}, {11,9,11}, {36,7,1}, {36,7,1},
+    {36,7,1}, {36,7,1}, {134,7,0}, {134,7,0}, {134,7,0}, {134,7,0}, {256,9,0}, {6,9,27},
+    {252,9,0}, {9,9,13}, {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0},
+    {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0},
+    {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0},
+    {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0}, {56,4,0},
+    {56,4,0}, {56,4,0}, {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44},
+    {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44},
+    {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44},
+    {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44}, {1,4,44},
+    {1,4,44}, {1,4,44}, {8,1,26}, {8,1,26}, {8,1,26}, {8,1,26}, {11,3,28}, {7,3,42},
+    {8,3,56}, {10,3,37},
+};
+
+static const RL_VLC_ELEM coef3_rl_vlc[10992] = {
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {2,6,1}, {2,6,1}, {2,6,1}, {2,6,1}, {2,6,1}, {2,6,1}, {2,6,1}, {2,6,1},
+    {4,6,0}, {4,6,0}, {4,6,0}, {4,6,0}, {4,6,0}, {4,6,0}, {4,6,0}, {4,6,0},
+    {1,6,6}, {1,6,6}, {1,6,6}, {1,6,6}, {1,6,6}, {1,6,6}, {1,6,6}, {1,6,6},
+    {2,9,4}, {512,-9,0}, {1024,-8,0}, {1280,-9,0}, {1,9,22}, {1792,-6,0}, {1,8,15}, {1,8,15},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0},
+    {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0},
+    {1,7,10}, {1,7,10}, {1,7,10}, {1,7,10}, {1856,-9,0}, {2372,-8,0}, {11,9,0}, {2628,-8,0},
+    {3,9,2}, {2884,-9,0}, {8,8,0}, {8,8,0}, {1,9,23}, {3404,-9,0}, {1,8,16}, {1,8,16},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4},
+    {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4},
+    {6,7,0}, {6,7,0}, {6,7,0}, {6,7,0}, {3926,-8,0}, {4182,-7,0}, {2,8,3}, {2,8,3},
+    {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7},
+    {4310,-8,0}, {1,9,24}, {4566,-2,0}, {4570,-9,0}, {2,7,2}, {2,7,2}, {2,7,2}, {2,7,2},
+    {1,7,11}, {1,7,11}, {1,7,11}, {1,7,11}, {1,8,17}, {1,8,17}, {1,9,25}, {5082,-2,0},
+    {5086,-8,0}, {12,9,0}, {5342,-9,0}, {5858,-9,0}, {1,9,26}, {6374,-7,0}, {1,9,27}, {2,9,5},
+    {1,8,18}, {1,8,18}, {9,8,0}, {9,8,0}, {1,7,12}, {1,7,12}, {1,7,12}, {1,7,12},
+    {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8},
+    {6502,-9,0}, {7018,-7,0}, {7146,-1,0}, {7148,-7,0}, {3,7,1}, {3,7,1}, {3,7,1}, {3,7,1},
+    {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5},
+    {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5},
+    {5,9,1}, {7276,-8,0}, {1,9,28}, {7532,-7,0}, {0,7,0}, {0,7,0}, {0,7,0}, {0,7,0},
+    {5,6,0}, {5,6,0}, {5,6,0}, {5,6,0}, {5,6,0}, {5,6,0}, {5,6,0}, {5,6,0},
+    {1,8,19}, {1,8,19}, {0,9,1}, {7660,-7,0}, {1,7,13}, {1,7,13}, {1,7,13}, {1,7,13},
+    {7788,-9,0}, {13,9,0}, {8302,-6,0}, {8366,-9,0}, {7,7,0}, {7,7,0}, {7,7,0}, {7,7,0},
+    {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3},
+    {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3},
+    {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3},
+    {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3},
+    {4,8,1}, {4,8,1}, {8878,-8,0}, {1,9,29}, {1,8,20}, {1,8,20}, {9134,-7,0}, {9262,-9,0},
+    {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9},
+    {10,8,0}, {10,8,0}, {9776,-8,0}, {1,9,30}, {10032,-6,0}, {2,9,6}, {14,9,0}, {10096,-7,0},
+    {1,7,14}, {1,7,14}, {1,7,14}, {1,7,14}, {1,8,21}, {1,8,21}, {10224,-9,0}, {10736,-8,0},
+    {1,8,204}, {1,8,204}, {4,8,26}, {4,8,26}, {7,8,12}, {7,8,12}, {1,8,244}, {1,8,244},
+    {95,7,0}, {95,7,0}, {95,7,0}, {95,7,0}, {30,7,1}, {30,7,1}, {30,7,1}, {30,7,1},
+    {1,7,185}, {1,7,185}, {1,7,185}, {1,7,185}, {1,7,176}, {1,7,176}, {1,7,176}, {1,7,176},
+    {9,7,8}, {9,7,8}, {9,7,8}, {9,7,8}, {123,7,0}, {123,7,0}, {123,7,0}, {123,7,0},
+    {2,7,56}, {2,7,56}, {2,7,56}, {2,7,56}, {29,7,1}, {29,7,1}, {29,7,1}, {29,7,1},
+    {76,6,0}, {76,6,0}, {76,6,0}, {76,6,0}, {76,6,0}, {76,6,0}, {76,6,0}, {76,6,0},
+    {1,5,97}, {1,5,97}, {1,5,97}, {1,5,97}, {1,5,97}, {1,5,97}, {1,5,97}, {1,5,97},
+    {1,5,97}, {1,5,97}, {1,5,97}, {1,5,97}, {1,5,97}, {1,5,97}, {1,5,97}, {1,5,97},
+    {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0},
+    {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0},
+    {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0},
+    {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0},
+    {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0},
+    {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0},
+    {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0},
+    {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0}, {26,3,0},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4},
+    {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4},
+    {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4},
+    {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4}, {5,4,4},
+    {1,6,125}, {1,6,125}, {1,6,125}, {1,6,125}, {1,6,125}, {1,6,125}, {1,6,125}, {1,6,125},
+    {1,6,150}, {1,6,150}, {1,6,150}, {1,6,150}, {1,6,150}, {1,6,150}, {1,6,150}, {1,6,150},
+    {5,8,23}, {5,8,23}, {8,9,29}, {1,9,323}, {1,7,164}, {1,7,164}, {1,7,164}, {1,7,164},
+    {26,7,1}, {26,7,1}, {26,7,1}, {26,7,1}, {6,7,11}, {6,7,11}, {6,7,11}, {6,7,11},
+    {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55},
+    {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55},
+    {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55},
+    {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55},
+    {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55},
+    {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55},
+    {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55},
+    {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55},
+    {1,5,95}, {1,5,95}, {1,5,95}, {1,5,95}, {1,5,95}, {1,5,95}, {1,5,95}, {1,5,95},
+    {1,5,95}, {1,5,95}, {1,5,95}, {1,5,95}, {1,5,95}, {1,5,95}, {1,5,95}, {1,5,95},
+    {3,7,27}, {3,7,27}, {3,7,27}, {3,7,27}, {13,8,4}, {13,8,4}, {5,8,21}, {5,8,21},
+    {1,6,128}, {1,6,128}, {1,6,128}, {1,6,128}, {1,6,128}, {1,6,128}, {1,6,128}, {1,6,128},
+    {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76},
+    {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76},
+    {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76},
+    {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76}, {1,4,76},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0},
+    {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0},
+    {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0},
+    {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0}, {27,3,0},
+    {4,6,14}, {4,6,14}, {4,6,14}, {4,6,14}, {1,6,134}, {1,6,134}, {1,6,134}, {1,6,134},
+    {1,5,106}, {1,5,106}, {1,5,106}, {1,5,106}, {1,5,106}, {1,5,106}, {1,5,106}, {1,5,106},
+    {16,5,1}, {16,5,1}, {16,5,1}, {16,5,1}, {16,5,1}, {16,5,1}, {16,5,1}, {16,5,1},
+    {2,8,74}, {1,8,241}, {1,8,242}, {9,8,10}, {1,8,259}, {1,8,206}, {7,8,17}, {7,8,11},
+    {5,8,31}, {1,8,302}, {8,8,12}, {1,8,213}, {1,8,280}, {1,8,281}, {148,8,0}, {146,8,0},
+    {1,8,269}, {4,8,28}, {2,7,59}, {2,7,59}, {3,7,31}, {3,7,31}, {1,7,169}, {1,7,169},
+    {1,5,107}, {1,5,107}, {1,5,107}, {1,5,107}, {1,5,107}, {1,5,107}, {1,5,107}, {1,5,107},
+    {4,7,23}, {4,7,23}, {16,7,2}, {16,7,2}, {4,6,17}, {4,6,17}, {4,6,17}, {4,6,17},
+    {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4},
+    {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4},
+    {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4},
+    {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4}, {4,3,4},
+    {71,6,0}, {71,6,0}, {71,6,0}, {71,6,0}, {71,6,0}, {71,6,0}, {71,6,0}, {71,6,0},
+    {3,6,20}, {3,6,20}, {3,6,20}, {3,6,20}, {3,6,20}, {3,6,20}, {3,6,20}, {3,6,20},
+    {1,5,100}, {1,5,100}, {1,5,100}, {1,5,100}, {1,5,100}, {1,5,100}, {1,5,100}, {1,5,100},
+    {1,5,100}, {1,5,100}, {1,5,100}, {1,5,100}, {1,5,100}, {1,5,100}, {1,5,100}, {1,5,100},
+    {53,5,0}, {53,5,0}, {53,5,0}, {53,5,0}, {53,5,0}, {53,5,0}, {53,5,0}, {53,5,0},
+    {53,5,0}, {53,5,0}, {53,5,0}, {53,5,0}, {53,5,0}, {53,5,0}, {53,5,0}, {53,5,0},
+    {3,5,15}, {3,5,15}, {3,5,15}, {3,5,15}, {3,5,15}, {3,5,15}, {3,5,15}, {3,5,15},
+    {3,5,15}, {3,5,15}, {3,5,15}, {3,5,15}, {3,5,15}, {3,5,15}, {3,5,15}, {3,5,15},
+    {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0},
+    {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0},
+    {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0},
+    {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0}, {36,4,0},
+    {1,7,193}, {1,7,193}, {1,7,193}, {1,7,193}, {1,7,170}, {1,7,170}, {1,7,170}, {1,7,170},
+    {1,7,177}, {1,7,177}, {1,7,177}, {1,7,177}, {1,7,173}, {1,7,173}, {1,7,173}, {1,7,173},
+    {101,7,0}, {101,7,0}, {101,7,0}, {101,7,0}, {3,7,29}, {3,7,29}, {3,7,29}, {3,7,29},
+    {4,7,22}, {4,7,22}, {4,7,22}, {4,7,22}, {120,7,0}, {120,7,0}, {120,7,0}, {120,7,0},
+    {7,6,5}, {7,6,5}, {7,6,5}, {7,6,5}, {7,6,5}, {7,6,5}, {7,6,5}, {7,6,5},
+    {20,6,1}, {20,6,1}, {20,6,1}, {20,6,1}, {20,6,1}, {20,6,1}, {20,6,1}, {20,6,1},
+    {3,5,16}, {3,5,16}, {3,5,16}, {3,5,16}, {3,5,16}, {3,5,16}, {3,5,16}, {3,5,16},
+    {3,5,16}, {3,5,16}, {3,5,16}, {3,5,16}, {3,5,16}, {3,5,16}, {3,5,16}, {3,5,16},
+    {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75},
+    {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75},
+    {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75},
+    {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75}, {1,4,75},
+    {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17},
+    {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17}, {3,5,17},
+    {2,5,29}, {2,5,29}, {2,5,29}, {2,5,29}, {2,5,29}, {2,5,29}, {2,5,29}, {2,5,29},
+    {2,5,29}, {2,5,29}, {2,5,29}, {2,5,29}, {2,5,29}, {2,5,29}, {2,5,29}, {2,5,29},
+    {21,6,1}, {21,6,1}, {21,6,1}, {21,6,1}, {21,6,1}, {21,6,1}, {21,6,1}, {21,6,1},
+    {1,9,324}, {1,9,318}, {6,9,41}, {34,9,2}, {1,9,317}, {16,9,4}, {2,9,84}, {1,9,327},
+    {15,9,4}, {1,9,326}, {1,9,331}, {1,9,247}, {4,9,49}, {14,9,5}, {4,9,58}, {2,9,90},
+    {1,9,310}, {12,9,8}, {10,9,10}, {4,9,42}, {19,9,3}, {69,9,1}, {80,9,1}, {4,9,56},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {60,9,1}, {2,9,92}, {6,9,27}, {64,9,1}, {62,9,1}, {2,9,94}, {3,8,58}, {3,8,58},
+    {1,8,270}, {1,8,270}, {1,8,229}, {1,8,229}, {40,8,1}, {40,8,1}, {4,8,32}, {4,8,32},
+    {21,8,2}, {21,8,2}, {1,8,226}, {1,8,226}, {47,8,1}, {47,8,1}, {1,8,203}, {1,8,203},
+    {11,8,6}, {11,8,6}, {1,8,223}, {1,8,223}, {1,8,199}, {1,8,199}, {1,8,212}, {1,8,212},
+    {1,7,166}, {1,7,166}, {1,7,166}, {1,7,166}, {5,7,18}, {5,7,18}, {5,7,18}, {5,7,18},
+    {6,7,18}, {6,7,18}, {6,7,18}, {6,7,18}, {1,7,190}, {1,7,190}, {1,7,190}, {1,7,190},
+    {1,5,105}, {1,5,105}, {1,5,105}, {1,5,105}, {1,5,105}, {1,5,105}, {1,5,105}, {1,5,105},
+    {1,5,105}, {1,5,105}, {1,5,105}, {1,5,105}, {1,5,105}, {1,5,105}, {1,5,105}, {1,5,105},
+    {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0},
+    {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0},
+    {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0},
+    {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0}, {37,4,0},
+    {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78},
+    {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78},
+    {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78},
+    {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78}, {1,4,78},
+    {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32},
+    {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32},
+    {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32},
+    {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32}, {1,1,32},
+    {1,3,57}, {1,3,57}, {1,3,57}, {1,3,57}, {1,3,57}, {1,3,57}, {1,3,57}, {1,3,57},
+    {1,6,152}, {81,6,0}, {2,5,28}, {2,5,28}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7},
+    {20,2,0}, {20,2,0}, {20,2,0}, {20,2,0}, {20,2,0}, {20,2,0}, {20,2,0}, {20,2,0},
+    {20,2,0}, {20,2,0}, {20,2,0}, {20,2,0}, {20,2,0}, {20,2,0}, {20,2,0}, {20,2,0},
+    {1,5,98}, {1,5,98}, {1,5,98}, {1,5,98}, {1,5,98}, {1,5,98}, {1,5,98}, {1,5,98},
+    {1,5,98}, {1,5,98}, {1,5,98}, {1,5,98}, {1,5,98}, {1,5,98}, {1,5,98}, {1,5,98},
+    {78,6,0}, {78,6,0}, {78,6,0}, {78,6,0}, {78,6,0}, {78,6,0}, {78,6,0}, {78,6,0},
+    {1,8,220}, {1,8,220}, {1,9,296}, {2368,-2,0}, {1,7,184}, {1,7,184}, {1,7,184}, {1,7,184},
+    {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20},
+    {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20},
+    {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20},
+    {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20}, {2,4,20},
+    {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2},
+    {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2},
+    {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2},
+    {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2},
+    {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2},
+    {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2},
+    {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2},
+    {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2},
+    {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0},
+    {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0},
+    {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0},
+    {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0}, {38,4,0},
+    {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82},
+    {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82},
+    {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82},
+    {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82}, {1,4,82},
+    {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7},
+    {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7},
+    {104,7,0}, {104,7,0}, {104,7,0}, {104,7,0}, {5,7,19}, {5,7,19}, {5,7,19}, {5,7,19},
+    {100,7,0}, {100,7,0}, {100,7,0}, {100,7,0}, {10,8,8}, {10,8,8}, {1,8,208}, {1,8,208},
+    {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79},
+    {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79},
+    {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79},
+    {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79}, {1,4,79},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0}, {15,1,0},
+    {1,2,340}, {1,2,348}, {2,1,117}, {2,1,117}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33},
+    {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33},
+    {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33},
+    {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33},
+    {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33},
+    {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33},
+    {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33},
+    {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33},
+    {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33},
+    {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33},
+    {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33},
+    {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33},
+    {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33},
+    {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33},
+    {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33},
+    {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33},
+    {1,1,33}, {1,1,33}, {1,1,33}, {1,1,33}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43},
+    {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43},
+    {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43},
+    {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43},
+    {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43},
+    {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43},
+    {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43},
+    {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43},
+    {1,2,43}, {1,2,43}, {1,2,43}, {1,2,43}, {1,6,144}, {1,6,144}, {1,6,144}, {1,6,144},
+    {1,6,138}, {1,6,138}, {1,6,138}, {1,6,138}, {1,6,131}, {1,6,131}, {1,6,131}, {1,6,131},
+    {138,8,0}, {4,8,60}, {173,8,0}, {2,8,75}, {1,4,77}, {1,4,77}, {1,4,77}, {1,4,77},
+    {1,4,77}, {1,4,77}, {1,4,77}, {1,4,77}, {1,4,77}, {1,4,77}, {1,4,77}, {1,4,77},
+    {1,4,77}, {1,4,77}, {1,4,77}, {1,4,77}, {1,3,59}, {1,3,59}, {1,3,59}, {1,3,59},
+    {1,3,59}, {1,3,59}, {1,3,59}, {1,3,59}, {1,3,59}, {1,3,59}, {1,3,59}, {1,3,59},
+    {1,3,59}, {1,3,59}, {1,3,59}, {1,3,59}, {1,3,59}, {1,3,59}, {1,3,59}, {1,3,59},
+    {1,3,59}, {1,3,59}, {1,3,59}, {1,3,59}, {1,3,59}, {1,3,59}, {1,3,59}, {1,3,59},
+    {1,3,59}, {1,3,59}, {1,3,59}, {1,3,59}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3},
+    {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3},
+    {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {39,4,0}, {39,4,0}, {39,4,0}, {39,4,0},
+    {39,4,0}, {39,4,0}, {39,4,0}, {39,4,0}, {39,4,0}, {39,4,0}, {39,4,0}, {39,4,0},
+    {39,4,0}, {39,4,0}, {39,4,0}, {39,4,0}, {3,8,47}, {12,8,5}, {5,8,29}, {1,8,215},
+    {1,8,218}, {7,8,14}, {2,8,65}, {4,8,37}, {1,8,227}, {1,8,201}, {7,8,13}, {147,8,0},
+    {1,7,191}, {1,7,191}, {3,7,28}, {3,7,28}, {6,7,10}, {6,7,10}, {109,7,0}, {109,7,0},
+    {9,6,4}, {9,6,4}, {9,6,4}, {9,6,4}, {73,6,0}, {73,6,0}, {73,6,0}, {73,6,0},
+    {8,6,4}, {8,6,4}, {8,6,4}, {8,6,4}, {2,5,30}, {2,5,30}, {2,5,30}, {2,5,30},
+    {2,5,30}, {2,5,30}, {2,5,30}, {2,5,30}, {54,5,0}, {54,5,0}, {54,5,0}, {54,5,0},
+    {54,5,0}, {54,5,0}, {54,5,0}, {54,5,0}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1},
+    {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1},
+    {13,4,1}, {13,4,1}, {13,4,1}, {13,4,1}, {1,6,133}, {1,6,133}, {1,6,133}, {1,6,133},
+    {5,7,17}, {5,7,17}, {114,7,0}, {114,7,0}, {10,5,2}, {10,5,2}, {10,5,2}, {10,5,2},
+    {10,5,2}, {10,5,2}, {10,5,2}, {10,5,2}, {1,4,83}, {1,4,83}, {1,4,83}, {1,4,83},
+    {1,4,83}, {1,4,83}, {1,4,83}, {1,4,83}, {1,4,83}, {1,4,83}, {1,4,83}, {1,4,83},
+    {1,4,83}, {1,4,83}, {1,4,83}, {1,4,83}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58},
+    {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58},
+    {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58},
+    {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58},
+    {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58},
+    {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58},
+    {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58},
+    {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58},
+    {1,3,58}, {1,3,58}, {1,3,58}, {1,3,58}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15},
+    {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15},
+    {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15},
+    {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15},
+    {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15},
+    {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15},
+    {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15},
+    {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15},
+    {2,3,15}, {2,3,15}, {2,3,15}, {2,3,15}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0},
+    {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0},
+    {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0},
+    {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0},
+    {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0},
+    {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0},
+    {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0},
+    {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0},
+    {28,3,0}, {28,3,0}, {28,3,0}, {28,3,0}, {2,7,60}, {2,7,60}, {2,7,60}, {2,7,60},
+    {1,7,172}, {1,7,172}, {1,7,172}, {1,7,172}, {1,7,187}, {1,7,187}, {1,7,187}, {1,7,187},
+    {103,7,0}, {103,7,0}, {103,7,0}, {103,7,0}, {10,6,3}, {10,6,3}, {10,6,3}, {10,6,3},
+    {10,6,3}, {10,6,3}, {10,6,3}, {10,6,3}, {1,6,139}, {1,6,139}, {1,6,139}, {1,6,139},
+    {1,6,139}, {1,6,139}, {1,6,139}, {1,6,139}, {52,5,0}, {52,5,0}, {52,5,0}, {52,5,0},
+    {52,5,0}, {52,5,0}, {52,5,0}, {52,5,0}, {52,5,0}, {52,5,0}, {52,5,0}, {52,5,0},
+    {52,5,0}, {52,5,0}, {52,5,0}, {52,5,0}, {1,6,135}, {1,6,135}, {1,6,135}, {1,6,135},
+    {1,6,135}, {1,6,135}, {1,6,135}, {1,6,135}, {3,7,34}, {3,7,34}, {3,7,34}, {3,7,34},
+    {3396,-1,0}, {3398,-1,0}, {3400,-1,0}, {3402,-1,0}, {5,1,38}, {2,1,98}, {3,1,65}, {2,1,112},
+    {2,1,118}, {1,1,345}, {1,1,286}, {8,1,25}, {55,5,0}, {55,5,0}, {55,5,0}, {55,5,0},
+    {55,5,0}, {55,5,0}, {55,5,0}, {55,5,0}, {55,5,0}, {55,5,0}, {55,5,0}, {55,5,0},
+    {55,5,0}, {55,5,0}, {55,5,0}, {55,5,0}, {1,5,104}, {1,5,104}, {1,5,104}, {1,5,104},
+    {1,5,104}, {1,5,104}, {1,5,104}, {1,5,104}, {1,5,104}, {1,5,104}, {1,5,104}, {1,5,104},
+    {1,5,104}, {1,5,104}, {1,5,104}, {1,5,104}, {3,6,24}, {3,6,24}, {3,6,24}, {3,6,24},
+    {3,6,24}, {3,6,24}, {3,6,24}, {3,6,24}, {1,6,148}, {1,6,148}, {1,6,148}, {1,6,148},
+    {1,6,148}, {1,6,148}, {1,6,148}, {1,6,148}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5},
+    {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5},
+    {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0},
+    {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0},
+    {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0},
+    {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0},
+    {41,4,0}, {41,4,0}, {41,4,0}, {41,4,0}, {1,5,108}, {1,5,108}, {1,5,108}, {1,5,108},
+    {1,5,108}, {1,5,108}, {1,5,108}, {1,5,108}, {1,5,108}, {1,5,108}, {1,5,108}, {1,5,108},
+    {1,5,108}, {1,5,108}, {1,5,108}, {1,5,108}, {1,6,142}, {1,6,142}, {1,6,142}, {1,6,142},
+    {1,6,142}, {1,6,142}, {1,6,142}, {1,6,142}, {3916,-1,0}, {3918,-1,0}, {3920,-1,0}, {3922,-1,0},
+    {3924,-1,0}, {9,9,17}, {1,9,312}, {18,9,4}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10},
+    {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10},
+    {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10},
+    {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10},
+    {3,4,10}, {3,4,10}, {3,4,10}, {3,4,10}, {1,4,81}, {1,4,81}, {1,4,81}, {1,4,81},
+    {1,4,81}, {1,4,81}, {1,4,81}, {1,4,81}, {1,4,81}, {1,4,81}, {1,4,81}, {1,4,81},
+    {1,4,81}, {1,4,81}, {1,4,81}, {1,4,81}, {1,4,81}, {1,4,81}, {1,4,81}, {1,4,81},
+    {1,4,81}, {1,4,81}, {1,4,81}, {1,4,81}, {1,4,81}, {1,4,81}, {1,4,81}, {1,4,81},
+    {1,4,81}, {1,4,81}, {1,4,81}, {1,4,81}, {11,9,10}, {1,9,341}, {2,9,97}, {13,9,6},
+    {9,9,14}, {19,9,4}, {9,9,21}, {29,9,2}, {1,9,314}, {2,9,81}, {2,9,114}, {1,9,294},
+    {14,9,7}, {38,9,2}, {1,9,300}, {63,9,1}, {6,9,33}, {3,9,75}, {1,9,290}, {5,9,30},
+    {5,9,35}, {8,9,23}, {3,9,74}, {7,9,21}, {81,9,1}, {1,9,277}, {150,8,0}, {150,8,0},
+    {152,8,0}, {152,8,0}, {4,8,34}, {4,8,34}, {169,8,0}, {169,8,0}, {175,8,0}, {175,8,0},
+    {1,8,222}, {1,8,222}, {3,8,54}, {3,8,54}, {3,8,42}, {3,8,42}, {1,8,245}, {1,8,245},
+    {43,8,1}, {43,8,1}, {52,8,1}, {52,8,1}, {8,8,17}, {8,8,17}, {2,8,85}, {2,8,85},
+    {3,8,50}, {3,8,50}, {1,8,273}, {1,8,273}, {3,8,48}, {3,8,48}, {1,8,249}, {1,8,249},
+    {1,7,179}, {1,7,179}, {1,7,179}, {1,7,179}, {1,7,182}, {1,7,182}, {1,7,182}, {1,7,182},
+    {9,7,6}, {9,7,6}, {9,7,6}, {9,7,6}, {72,6,0}, {72,6,0}, {72,6,0}, {72,6,0},
+    {72,6,0}, {72,6,0}, {72,6,0}, {72,6,0}, {3,6,23}, {3,6,23}, {3,6,23}, {3,6,23},
+    {3,6,23}, {3,6,23}, {3,6,23}, {3,6,23}, {13,6,2}, {13,6,2}, {13,6,2}, {13,6,2},
+    {13,6,2}, {13,6,2}, {13,6,2}, {13,6,2}, {5,5,8}, {5,5,8}, {5,5,8}, {5,5,8},
+    {5,5,8}, {5,5,8}, {5,5,8}, {5,5,8}, {5,5,8}, {5,5,8}, {5,5,8}, {5,5,8},
+    {5,5,8}, {5,5,8}, {5,5,8}, {5,5,8}, {58,5,0}, {58,5,0}, {58,5,0}, {58,5,0},
+    {58,5,0}, {58,5,0}, {58,5,0}, {58,5,0}, {58,5,0}, {58,5,0}, {58,5,0}, {58,5,0},
+    {58,5,0}, {58,5,0}, {58,5,0}, {58,5,0}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1},
+    {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1},
+    {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1},
+    {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1},
+    {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1},
+    {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1},
+    {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1},
+    {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1},
+    {10,3,1}, {10,3,1}, {10,3,1}, {10,3,1}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {1,1,347}, {8,1,21}, {2,1,120}, {2,1,107},
+    {3,1,62}, {1,1,339}, {1,1,338}, {9,1,15}, {4,1,52}, {8,1,24}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {2,4,21}, {2,4,21},
+    {2,4,21}, {2,4,21}, {2,4,21}, {2,4,21}, {2,4,21}, {2,4,21}, {2,4,21}, {2,4,21},
+    {2,4,21}, {2,4,21}, {2,4,21}, {2,4,21}, {2,4,21}, {2,4,21}, {8,4,2}, {8,4,2},
+    {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2},
+    {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {8,4,2}, {1,4,80}, {1,4,80},
+    {1,4,80}, {1,4,80}, {1,4,80}, {1,4,80}, {1,4,80}, {1,4,80}, {1,4,80}, {1,4,80},
+    {1,4,80}, {1,4,80}, {1,4,80}, {1,4,80}, {1,4,80}, {1,4,80}, {4,7,20}, {4,7,20},
+    {1,8,254}, {1,8,236}, {7,6,7}, {7,6,7}, {7,6,7}, {7,6,7}, {5,6,11}, {5,6,11},
+    {5,6,11}, {5,6,11}, {88,6,0}, {88,6,0}, {88,6,0}, {88,6,0}, {18,5,1}, {18,5,1},
+    {18,5,1}, {18,5,1}, {18,5,1}, {18,5,1}, {18,5,1}, {18,5,1}, {8,5,3}, {8,5,3},
+    {8,5,3}, {8,5,3}, {8,5,3}, {8,5,3}, {8,5,3}, {8,5,3}, {40,4,0}, {40,4,0},
+    {40,4,0}, {40,4,0}, {40,4,0}, {40,4,0}, {40,4,0}, {40,4,0}, {40,4,0}, {40,4,0},
+    {40,4,0}, {40,4,0}, {40,4,0}, {40,4,0}, {40,4,0}, {40,4,0}, {1,3,60}, {1,3,60},
+    {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60},
+    {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60},
+    {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60},
+    {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60}, {1,3,60}, {1,2,45}, {1,2,45},
+    {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45},
+    {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45},
+    {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45},
+    {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45}, {1,2,45}, {1,2,44}, {1,2,44},
+    {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44},
+    {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44},
+    {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44},
+    {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44}, {1,2,44}, {5,3,3}, {5,3,3},
+    {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3},
+    {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {80,6,0}, {80,6,0},
+    {3,7,30}, {8,7,8}, {1,7,165}, {112,7,0}, {9,7,5}, {1,7,205}, {3,7,41}, {10,7,5},
+    {1,6,136}, {1,6,136}, {56,5,0}, {56,5,0}, {56,5,0}, {56,5,0}, {1,2,46}, {1,2,46},
+    {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46},
+    {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46},
+    {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46},
+    {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46}, {1,2,46}, {6,1,1}, {6,1,1},
+    {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1},
+    {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1},
+    {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1},
+    {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1},
+    {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1},
+    {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1},
+    {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1},
+    {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1},
+    {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1},
+    {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1},
+    {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1},
+    {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1},
+    {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1},
+    {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1},
+    {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1},
+    {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {6,1,1}, {2,3,14}, {2,3,14},
+    {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14},
+    {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14},
+    {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14},
+    {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {2,3,14}, {3,3,8}, {3,3,8},
+    {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8},
+    {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8},
+    {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8},
+    {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {23,6,1}, {23,6,1},
+    {23,6,1}, {23,6,1}, {177,8,0}, {1,8,320}, {165,8,0}, {1,8,232}, {4,5,10}, {4,5,10},
+    {4,5,10}, {4,5,10}, {4,5,10}, {4,5,10}, {4,5,10}, {4,5,10}, {1,4,84}, {1,4,84},
+    {1,4,84}, {1,4,84}, {1,4,84}, {1,4,84}, {1,4,84}, {1,4,84}, {1,4,84}, {1,4,84},
+    {1,4,84}, {1,4,84}, {1,4,84}, {1,4,84}, {1,4,84}, {1,4,84}, {1,8,272}, {161,8,0},
+    {164,8,0}, {2,8,67}, {6,8,20}, {14,8,4}, {1,8,211}, {41,8,1}, {22,8,2}, {1,8,239},
+    {4,8,36}, {2,8,63}, {4,8,33}, {2,8,79}, {102,7,0}, {102,7,0}, {3,7,33}, {3,7,33},
+    {1,7,163}, {1,7,163}, {116,7,0}, {116,7,0}, {1,7,175}, {1,7,175}, {75,6,0}, {75,6,0},
+    {75,6,0}, {75,6,0}, {3,6,22}, {3,6,22}, {3,6,22}, {3,6,22}, {1,1,35}, {1,1,35},
+    {21,2,0}, {5,2,2}, {1,6,132}, {1,6,132}, {1,6,132}, {1,6,132}, {1,6,132}, {1,6,132},
+    {1,6,132}, {1,6,132}, {82,6,0}, {82,6,0}, {82,6,0}, {82,6,0}, {82,6,0}, {82,6,0},
+    {82,6,0}, {82,6,0}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4},
+    {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4},
+    {7,5,4}, {7,5,4}, {11,7,5}, {11,7,5}, {11,7,5}, {11,7,5}, {6,7,13}, {6,7,13},
+    {6,7,13}, {6,7,13}, {3,6,25}, {3,6,25}, {3,6,25}, {3,6,25}, {3,6,25}, {3,6,25},
+    {3,6,25}, {3,6,25}, {4,6,15}, {4,6,15}, {4,6,15}, {4,6,15}, {4,6,15}, {4,6,15},
+    {4,6,15}, {4,6,15}, {4,6,16}, {4,6,16}, {4,6,16}, {4,6,16}, {4,6,16}, {4,6,16},
+    {4,6,16}, {4,6,16}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61},
+    {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61},
+    {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61},
+    {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61},
+    {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61},
+    {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61},
+    {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61},
+    {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61}, {1,3,61},
+    {1,3,61}, {1,3,61}, {4,6,18}, {4,6,18}, {4,6,18}, {4,6,18}, {4,6,18}, {4,6,18},
+    {4,6,18}, {4,6,18}, {5,6,10}, {5,6,10}, {5,6,10}, {5,6,10}, {5,6,10}, {5,6,10},
+    {5,6,10}, {5,6,10}, {1,5,111}, {1,5,111}, {1,5,111}, {1,5,111}, {1,5,111}, {1,5,111},
+    {1,5,111}, {1,5,111}, {1,5,111}, {1,5,111}, {1,5,111}, {1,5,111}, {1,5,111}, {1,5,111},
+    {1,5,111}, {1,5,111}, {7,7,9}, {7,7,9}, {7,7,9}, {7,7,9}, {3,7,32}, {3,7,32},
+    {3,7,32}, {3,7,32}, {2,7,51}, {2,7,51}, {2,7,51}, {2,7,51}, {131,7,0}, {131,7,0},
+    {131,7,0}, {131,7,0}, {2,7,57}, {2,7,57}, {2,7,57}, {2,7,57}, {1,7,161}, {1,7,161},
+    {1,7,161}, {1,7,161}, {1,6,141}, {1,6,141}, {1,6,141}, {1,6,141}, {1,6,141}, {1,6,141},
+    {1,6,141}, {1,6,141}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0},
+    {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0},
+    {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0},
+    {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0},
+    {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0},
+    {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0},
+    {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0},
+    {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0}, {29,3,0},
+    {29,3,0}, {29,3,0}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16},
+    {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16},
+    {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16},
+    {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16},
+    {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16},
+    {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16},
+    {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16},
+    {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16}, {2,3,16},
+    {2,3,16}, {2,3,16}, {1,5,103}, {1,5,103}, {1,5,103}, {1,5,103}, {1,5,103}, {1,5,103},
+    {1,5,103}, {1,5,103}, {1,5,103}, {1,5,103}, {1,5,103}, {1,5,103}, {1,5,103}, {1,5,103},
+    {1,5,103}, {1,5,103}, {6,9,32}, {6,9,29}, {6,9,24}, {179,9,0}, {1,9,333}, {2,9,93},
+    {10,9,13}, {4,9,44}, {4,9,43}, {2,9,104}, {5,9,36}, {3,9,72}, {18,9,3}, {8,9,10},
+    {9,9,12}, {1,9,346}, {1,9,343}, {8,9,13}, {6,9,36}, {1,9,315}, {174,8,0}, {174,8,0},
+    {7,8,19}, {7,8,19}, {1,8,256}, {1,8,256}, {2,8,96}, {2,8,96}, {1,8,238}, {1,8,238},
+    {35,8,1}, {35,8,1}, {4,8,27}, {4,8,27}, {23,8,2}, {23,8,2}, {16,8,3}, {16,8,3},
+    {1,8,251}, {1,8,251}, {1,8,235}, {1,8,235}, {1,8,231}, {1,8,231}, {6,8,25}, {6,8,25},
+    {1,8,248}, {1,8,248}, {8,2,1}, {2,2,10}, {16,1,0}, {16,1,0}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {2,8,86}, {3,8,44},
+    {17,8,3}, {160,8,0}, {162,8,0}, {159,8,0}, {1,8,243}, {4,8,59}, {5,8,27}, {9,8,9},
+    {1,7,192}, {1,7,192}, {6,7,12}, {6,7,12}, {3,7,38}, {3,7,38}, {4,7,21}, {4,7,21},
+    {28,7,1}, {28,7,1}, {110,7,0}, {110,7,0}, {3,7,40}, {3,7,40}, {4,7,24}, {4,7,24},
+    {11,7,4}, {11,7,4}, {5,6,12}, {5,6,12}, {5,6,12}, {5,6,12}, {1,3,63}, {1,3,63},
+    {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63},
+    {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63},
+    {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63},
+    {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63}, {1,3,63}, {1,2,47}, {1,2,47},
+    {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47},
+    {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47},
+    {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47},
+    {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47},
+    {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47},
+    {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47},
+    {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47},
+    {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {1,2,47}, {17,5,1}, {17,5,1},
+    {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1},
+    {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1}, {17,5,1}, {1,6,137}, {1,6,137},
+    {1,6,137}, {1,6,137}, {1,6,137}, {1,6,137}, {1,6,137}, {1,6,137}, {83,6,0}, {83,6,0},
+    {83,6,0}, {83,6,0}, {83,6,0}, {83,6,0}, {83,6,0}, {83,6,0}, {59,5,0}, {59,5,0},
+    {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0},
+    {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0}, {59,5,0}, {1,5,115}, {1,5,115},
+    {1,5,115}, {1,5,115}, {1,5,115}, {1,5,115}, {1,5,115}, {1,5,115}, {1,5,115}, {1,5,115},
+    {1,5,115}, {1,5,115}, {1,5,115}, {1,5,115}, {1,5,115}, {1,5,115}, {1,4,87}, {1,4,87},
+    {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87},
+    {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87},
+    {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87},
+    {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87}, {1,4,87}, {3,7,35}, {3,7,35},
+    {3,7,35}, {3,7,35}, {3,7,37}, {3,7,37}, {3,7,37}, {3,7,37}, {1,7,194}, {1,7,194},
+    {1,7,194}, {1,7,194}, {36,7,1}, {36,7,1}, {36,7,1}, {36,7,1}, {7,7,10}, {7,7,10},
+    {7,7,10}, {7,7,10}, {1,7,171}, {1,7,171}, {1,7,171}, {1,7,171}, {118,7,0}, {118,7,0},
+    {118,7,0}, {118,7,0}, {137,7,0}, {137,7,0}, {137,7,0}, {137,7,0}, {1,6,153}, {1,6,153},
+    {1,6,153}, {1,6,153}, {1,6,153}, {1,6,153}, {1,6,153}, {1,6,153}, {10,6,4}, {10,6,4},
+    {10,6,4}, {10,6,4}, {10,6,4}, {10,6,4}, {10,6,4}, {10,6,4}, {2,5,35}, {2,5,35},
+    {2,5,35}, {2,5,35}, {2,5,35}, {2,5,35}, {2,5,35}, {2,5,35}, {2,5,35}, {2,5,35},
+    {2,5,35}, {2,5,35}, {2,5,35}, {2,5,35}, {2,5,35}, {2,5,35}, {57,5,0}, {57,5,0},
+    {57,5,0}, {57,5,0}, {57,5,0}, {57,5,0}, {57,5,0}, {57,5,0}, {57,5,0}, {57,5,0},
+    {57,5,0}, {57,5,0}, {57,5,0}, {57,5,0}, {57,5,0}, {57,5,0}, {1,6,146}, {1,6,146},
+    {1,6,146}, {1,6,146}, {1,6,146}, {1,6,146}, {1,6,146}, {1,6,146}, {126,7,0}, {126,7,0},
+    {126,7,0}, {126,7,0}, {1,9,319}, {5854,-2,0}, {1,8,274}, {1,8,274}, {30,3,0}, {30,3,0},
+    {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0},
+    {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0},
+    {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0},
+    {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0},
+    {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0},
+    {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0},
+    {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0},
+    {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {30,3,0}, {1,3,62}, {1,3,62},
+    {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62},
+    {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62},
+    {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62},
+    {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62},
+    {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62},
+    {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62},
+    {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62},
+    {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {1,3,62}, {3,4,12}, {3,4,12},
+    {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12},
+    {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12},
+    {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12},
+    {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12}, {3,4,12}, {42,4,0}, {42,4,0},
+    {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0},
+    {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0},
+    {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0},
+    {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {42,4,0}, {1,6,147}, {1,6,147},
+    {1,6,147}, {1,6,147}, {1,6,147}, {1,6,147}, {1,6,147}, {1,6,147}, {1,6,149}, {1,6,149},
+    {1,6,149}, {1,6,149}, {1,6,149}, {1,6,149}, {1,6,149}, {1,6,149}, {1,6,145}, {1,6,145},
+    {1,6,145}, {1,6,145}, {1,6,145}, {1,6,145}, {1,6,145}, {1,6,145}, {2,6,45}, {2,6,45},
+    {2,6,45}, {2,6,45}, {2,6,45}, {2,6,45}, {2,6,45}, {2,6,45}, {1,4,89}, {1,4,89},
+    {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89},
+    {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89},
+    {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89},
+    {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89}, {1,4,89}, {3,4,11}, {3,4,11},
+    {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11},
+    {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11},
+    {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11},
+    {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11}, {3,4,11}, {92,6,0}, {92,6,0},
+    {92,6,0}, {92,6,0}, {92,6,0}, {92,6,0}, {92,6,0}, {92,6,0}, {3,8,43}, {3,8,43},
+    {1,8,275}, {1,8,275}, {3,8,59}, {3,8,59}, {3,8,49}, {3,8,49}, {1,8,304}, {1,8,304},
+    {50,8,1}, {50,8,1}, {5,8,28}, {5,8,28}, {1,8,298}, {1,8,298}, {54,8,1}, {54,8,1},
+    {1,8,255}, {1,8,255}, {3,8,52}, {3,8,52}, {1,8,258}, {1,8,258}, {2,2,111}, {3,2,68},
+    {1,1,342}, {1,1,342}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,8,266}, {1,8,266}, {5,8,24}, {5,8,24}, {1,8,267}, {1,8,267},
+    {149,8,0}, {149,8,0}, {168,8,0}, {168,8,0}, {2,8,91}, {2,8,91}, {11,8,9}, {11,8,9},
+    {2,8,87}, {2,8,87}, {128,7,0}, {128,7,0}, {128,7,0}, {128,7,0}, {4,7,29}, {4,7,29},
+    {4,7,29}, {4,7,29}, {122,7,0}, {122,7,0}, {122,7,0}, {122,7,0}, {32,7,1}, {32,7,1},
+    {32,7,1}, {32,7,1}, {2,5,39}, {2,5,39}, {2,5,39}, {2,5,39}, {2,5,39}, {2,5,39},
+    {2,5,39}, {2,5,39}, {2,5,39}, {2,5,39}, {2,5,39}, {2,5,39}, {2,5,39}, {2,5,39},
+    {2,5,39}, {2,5,39}, {2,5,31}, {2,5,31}, {2,5,31}, {2,5,31}, {2,5,31}, {2,5,31},
+    {2,5,31}, {2,5,31}, {2,5,31}, {2,5,31}, {2,5,31}, {2,5,31}, {2,5,31}, {2,5,31},
+    {2,5,31}, {2,5,31}, {79,6,0}, {79,6,0}, {79,6,0}, {79,6,0}, {79,6,0}, {79,6,0},
+    {79,6,0}, {79,6,0}, {1,7,189}, {1,7,189}, {1,7,189}, {1,7,189}, {172,8,0}, {172,8,0},
+    {6370,-1,0}, {6372,-1,0}, {3,5,18}, {3,5,18}, {3,5,18}, {3,5,18}, {3,5,18}, {3,5,18},
+    {3,5,18}, {3,5,18}, {3,5,18}, {3,5,18}, {3,5,18}, {3,5,18}, {3,5,18}, {3,5,18},
+    {3,5,18}, {3,5,18}, {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23},
+    {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23},
+    {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23},
+    {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23}, {2,4,23},
+    {2,4,23}, {2,4,23}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0},
+    {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0},
+    {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0},
+    {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0},
+    {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0},
+    {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0},
+    {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0},
+    {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0}, {31,3,0},
+    {31,3,0}, {31,3,0}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64},
+    {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64},
+    {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64},
+    {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64},
+    {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64},
+    {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64},
+    {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64},
+    {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64}, {1,3,64},
+    {1,3,64}, {1,3,64}, {8,1,26}, {5,1,37}, {4,1,46}, {1,1,335}, {22,2,0}, {22,2,0},
+    {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0},
+    {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0},
+    {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0},
+    {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0}, {22,2,0}, {14,4,1}, {14,4,1},
+    {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1}, {14,4,1}, {7,6,6}, {7,6,6},
+    {5,7,20}, {4,7,39}, {1,5,109}, {1,5,109}, {1,5,109}, {1,5,109}, {4,4,8}, {4,4,8},
+    {4,4,8}, {4,4,8}, {4,4,8}, {4,4,8}, {4,4,8}, {4,4,8}, {1,4,86}, {1,4,86},
+    {1,4,86}, {1,4,86}, {1,4,86}, {1,4,86}, {1,4,86}, {1,4,86}, {1,2,48}, {1,2,48},
+    {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48},
+    {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48},
+    {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48},
+    {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48}, {1,2,48}, {44,4,0}, {44,4,0},
+    {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {44,4,0}, {1,7,195}, {151,7,0},
+    {136,7,0}, {3,7,60}, {10,7,6}, {125,7,0}, {115,7,0}, {1,7,188}, {43,4,0}, {43,4,0},
+    {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0}, {43,4,0}, {5,4,5}, {5,4,5},
+    {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5}, {1,6,143}, {1,6,143},
+    {1,6,143}, {1,6,143}, {1,6,143}, {1,6,143}, {1,6,143}, {1,6,143}, {15,6,2}, {15,6,2},
+    {15,6,2}, {15,6,2}, {15,6,2}, {15,6,2}, {15,6,2}, {15,6,2}, {60,5,0}, {60,5,0},
+    {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0},
+    {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0}, {60,5,0}, {1,6,156}, {1,6,156},
+    {1,6,156}, {1,6,156}, {1,6,156}, {1,6,156}, {1,6,156}, {1,6,156}, {24,6,1}, {24,6,1},
+    {24,6,1}, {24,6,1}, {24,6,1}, {24,6,1}, {24,6,1}, {24,6,1}, {1,5,114}, {1,5,114},
+    {1,5,114}, {1,5,114}, {1,5,114}, {1,5,114}, {1,5,114}, {1,5,114}, {1,5,114}, {1,5,114},
+    {1,5,114}, {1,5,114}, {1,5,114}, {1,5,114}, {1,5,114}, {1,5,114}, {3,5,19}, {3,5,19},
+    {3,5,19}, {3,5,19}, {3,5,19}, {3,5,19}, {3,5,19}, {3,5,19}, {3,5,19}, {3,5,19},
+    {3,5,19}, {3,5,19}, {3,5,19}, {3,5,19}, {3,5,19}, {3,5,19}, {2,5,34}, {2,5,34},
+    {2,5,34}, {2,5,34}, {2,5,34}, {2,5,34}, {2,5,34}, {2,5,34}, {2,5,34}, {2,5,34},
+    {2,5,34}, {2,5,34}, {2,5,34}, {2,5,34}, {2,5,34}, {2,5,34}, {11,5,2}, {11,5,2},
+    {11,5,2}, {11,5,2}, {11,5,2}, {11,5,2}, {11,5,2}, {11,5,2}, {11,5,2}, {11,5,2},
+    {11,5,2}, {11,5,2}, {11,5,2}, {11,5,2}, {11,5,2}, {11,5,2}, {2,5,32}, {2,5,32},
+    {2,5,32}, {2,5,32}, {2,5,32}, {2,5,32}, {2,5,32}, {2,5,32}, {2,5,32}, {2,5,32},
+    {2,5,32}, {2,5,32}, {2,5,32}, {2,5,32}, {2,5,32}, {2,5,32}, {2,4,24}, {2,4,24},
+    {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24},
+    {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24},
+    {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24},
+    {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {2,4,24}, {1,5,110}, {1,5,110},
+    {1,5,110}, {1,5,110}, {1,5,110}, {1,5,110}, {1,5,110}, {1,5,110}, {1,5,110}, {1,5,110},
+    {1,5,110}, {1,5,110}, {1,5,110}, {1,5,110}, {1,5,110}, {1,5,110}, {5,5,9}, {5,5,9},
+    {5,5,9}, {5,5,9}, {5,5,9}, {5,5,9}, {5,5,9}, {5,5,9}, {5,5,9}, {5,5,9},
+    {5,5,9}, {5,5,9}, {5,5,9}, {5,5,9}, {5,5,9}, {5,5,9}, {11,3,1}, {11,3,1},
+    {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1},
+    {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1},
+    {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1},
+    {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1},
+    {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1},
+    {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1},
+    {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1},
+    {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {11,3,1}, {1,5,151}, {1,5,151},
+    {1,5,151}, {1,5,151}, {1,5,151}, {1,5,151}, {1,5,151}, {1,5,151}, {1,5,151}, {1,5,151},
+    {1,5,151}, {1,5,151}, {1,5,151}, {1,5,151}, {1,5,151}, {1,5,151}, {1,5,120}, {1,5,120},
+    {1,5,120}, {1,5,120}, {1,5,120}, {1,5,120}, {1,5,120}, {1,5,120}, {1,5,120}, {1,5,120},
+    {1,5,120}, {1,5,120}, {1,5,120}, {1,5,120}, {1,5,120}, {1,5,120}, {1,4,85}, {1,4,85},
+    {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85},
+    {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85},
+    {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85},
+    {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85}, {1,4,85}, {1,3,66}, {1,3,66},
+    {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66},
+    {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66},
+    {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66},
+    {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66},
+    {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66},
+    {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66},
+    {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66},
+    {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {1,3,66}, {7014,-1,0}, {7016,-1,0},
+    {1,9,313}, {8,9,19}, {2,9,110}, {1,9,282}, {8,9,16}, {1,9,285}, {8,9,28}, {3,9,70},
+    {2,9,103}, {1,9,332}, {2,9,106}, {2,9,99}, {10,9,17}, {9,9,20}, {2,9,105}, {1,9,337},
+    {13,9,8}, {6,9,26}, {154,8,0}, {154,8,0}, {42,8,1}, {42,8,1}, {1,8,284}, {1,8,284},
+    {5,8,26}, {5,8,26}, {1,8,297}, {1,8,297}, {4,8,41}, {4,8,41}, {1,8,279}, {1,8,279},
+    {1,8,287}, {1,8,287}, {1,8,283}, {1,8,283}, {1,8,271}, {1,8,271}, {1,8,325}, {1,8,325},
+    {171,8,0}, {171,8,0}, {8,8,11}, {8,8,11}, {5,8,40}, {5,8,40}, {4,8,31}, {4,8,31},
+    {4,8,35}, {4,8,35}, {6,8,22}, {6,8,22}, {1,8,252}, {1,8,252}, {13,8,5}, {13,8,5},
+    {6,8,35}, {6,8,35}, {3,7,36}, {3,7,36}, {3,7,36}, {3,7,36}, {33,7,1}, {33,7,1},
+    {33,7,1}, {33,7,1}, {1,7,186}, {1,7,186}, {1,7,186}, {1,7,186}, {117,7,0}, {117,7,0},
+    {117,7,0}, {117,7,0}, {1,7,221}, {1,7,221}, {1,7,221}, {1,7,221}, {5,7,15}, {5,7,15},
+    {5,7,15}, {5,7,15}, {2,7,62}, {2,7,62}, {2,7,62}, {2,7,62}, {97,6,0}, {97,6,0},
+    {97,6,0}, {97,6,0}, {97,6,0}, {97,6,0}, {97,6,0}, {97,6,0}, {3,6,26}, {3,6,26},
+    {3,6,26}, {3,6,26}, {3,6,26}, {3,6,26}, {3,6,26}, {3,6,26}, {22,6,1}, {22,6,1},
+    {22,6,1}, {22,6,1}, {22,6,1}, {22,6,1}, {22,6,1}, {22,6,1}, {98,6,0}, {98,6,0},
+    {98,6,0}, {98,6,0}, {98,6,0}, {98,6,0}, {98,6,0}, {98,6,0}, {2,6,42}, {2,6,42},
+    {2,6,42}, {2,6,42}, {2,6,42}, {2,6,42}, {2,6,42}, {2,6,42}, {2,1,115}, {2,1,119},
+    {4,1,47}, {3,1,67}, {1,3,65}, {1,3,65}, {1,3,65}, {1,3,65}, {1,3,65}, {1,3,65},
+    {1,3,65}, {1,3,65}, {1,3,65}, {1,3,65}, {1,3,65}, {1,3,65}, {1,3,65}, {1,3,65},
+    {1,3,65}, {1,3,65}, {1,5,118}, {1,5,118}, {1,5,118}, {1,5,118}, {2,5,33}, {2,5,33},
+    {2,5,33}, {2,5,33}, {63,5,0}, {63,5,0}, {63,5,0}, {63,5,0}, {1,5,113}, {1,5,113},
+    {1,5,113}, {1,5,113}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0},
+    {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0}, {32,3,0},
+    {32,3,0}, {32,3,0}, {1,3,69}, {1,3,69}, {1,3,69}, {1,3,69}, {1,3,69}, {1,3,69},
+    {1,3,69}, {1,3,69}, {1,3,69}, {1,3,69}, {1,3,69}, {1,3,69}, {1,3,69}, {1,3,69},
+    {1,3,69}, {1,3,69}, {1,3,68}, {1,3,68}, {1,3,68}, {1,3,68}, {1,3,68}, {1,3,68},
+    {1,3,68}, {1,3,68}, {1,3,68}, {1,3,68}, {1,3,68}, {1,3,68}, {1,3,68}, {1,3,68},
+    {1,3,68}, {1,3,68}, {4,3,5}, {4,3,5}, {4,3,5}, {4,3,5}, {4,3,5}, {4,3,5},
+    {4,3,5}, {4,3,5}, {4,3,5}, {4,3,5}, {4,3,5}, {4,3,5}, {4,3,5}, {4,3,5},
+    {4,3,5}, {4,3,5}, {1,7,196}, {1,7,207}, {84,6,0}, {84,6,0}, {2,6,46}, {2,6,46},
+    {8,6,5}, {8,6,5}, {6,5,6}, {6,5,6}, {6,5,6}, {6,5,6}, {1,5,119}, {1,5,119},
+    {1,5,119}, {1,5,119}, {4,5,11}, {4,5,11}, {4,5,11}, {4,5,11}, {61,5,0}, {61,5,0},
+    {61,5,0}, {61,5,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0}, {45,4,0},
+    {45,4,0}, {45,4,0}, {1,1,37}, {2,1,8}, {2,4,22}, {2,4,22}, {2,4,22}, {2,4,22},
+    {2,4,22}, {2,4,22}, {2,4,22}, {2,4,22}, {1,7,209}, {4,7,25}, {6,7,17}, {1,7,210},
+    {2,7,72}, {132,7,0}, {86,6,0}, {86,6,0}, {1,6,157}, {1,6,157}, {25,6,1}, {25,6,1},
+    {1,5,117}, {1,5,117}, {1,5,117}, {1,5,117}, {1,4,88}, {1,4,88}, {1,4,88}, {1,4,88},
+    {1,4,88}, {1,4,88}, {1,4,88}, {1,4,88}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11},
+    {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11},
+    {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11},
+    {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11},
+    {2,2,11}, {2,2,11}, {2,2,11}, {2,2,11}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0},
+    {23,2,0}, {23,2,0}, {23,2,0}, {23,2,0}, {1,2,50}, {1,2,50}, {1,2,50}, {1,2,50},
+    {1,2,50}, {1,2,50}, {1,2,50}, {1,2,50}, {1,2,50}, {1,2,50}, {1,2,50}, {1,2,50},
+    {1,2,50}, {1,2,50}, {1,2,50}, {1,2,50}, {1,2,50}, {1,2,50}, {1,2,50}, {1,2,50},
+    {1,2,50}, {1,2,50}, {1,2,50}, {1,2,50}, {1,2,50}, {1,2,50}, {1,2,50}, {1,2,50},
+    {1,2,50}, {1,2,50}, {1,2,50}, {1,2,50}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0},
+    {17,1,0}, {17,1,0}, {17,1,0}, {17,1,0}, {1,4,91}, {1,4,91}, {1,4,91}, {1,4,91},
+    {1,4,91}, {1,4,91}, {1,4,91}, {1,4,91}, {1,4,91}, {1,4,91}, {1,4,91}, {1,4,91},
+    {1,4,91}, {1,4,91}, {1,4,91}, {1,4,91}, {89,6,0}, {89,6,0}, {89,6,0}, {89,6,0},
+    {14,6,2}, {14,6,2}, {14,6,2}, {14,6,2}, {90,6,0}, {90,6,0}, {90,6,0}, {90,6,0},
+    {2,6,44}, {2,6,44}, {2,6,44}, {2,6,44}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1},
+    {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1},
+    {15,4,1}, {15,4,1}, {15,4,1}, {15,4,1}, {6,5,7}, {6,5,7}, {6,5,7}, {6,5,7},
+    {6,5,7}, {6,5,7}, {6,5,7}, {6,5,7}, {5,6,13}, {5,6,13}, {5,6,13}, {5,6,13},
+    {3,8,56}, {8,8,15}, {8,8,18}, {7,8,18}, {2,4,25}, {2,4,25}, {2,4,25}, {2,4,25},
+    {2,4,25}, {2,4,25}, {2,4,25}, {2,4,25}, {2,4,25}, {2,4,25}, {2,4,25}, {2,4,25},
+    {2,4,25}, {2,4,25}, {2,4,25}, {2,4,25}, {6,5,8}, {6,5,8}, {6,5,8}, {6,5,8},
+    {6,5,8}, {6,5,8}, {6,5,8}, {6,5,8}, {1,5,122}, {1,5,122}, {1,5,122}, {1,5,122},
+    {1,5,122}, {1,5,122}, {1,5,122}, {1,5,122}, {68,5,0}, {68,5,0}, {68,5,0}, {68,5,0},
+    {68,5,0}, {68,5,0}, {68,5,0}, {68,5,0}, {7,8,15}, {2,8,73}, {1,8,292}, {2,8,82},
+    {2,8,78}, {1,8,228}, {45,8,1}, {1,8,299}, {1,8,240}, {166,8,0}, {13,8,7}, {1,8,261},
+    {1,8,264}, {1,8,233}, {46,8,1}, {1,8,253}, {8,7,9}, {8,7,9}, {13,7,3}, {13,7,3},
+    {121,7,0}, {121,7,0}, {17,7,2}, {17,7,2}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38},
+    {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38},
+    {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38},
+    {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38},
+    {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38},
+    {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38},
+    {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38},
+    {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38},
+    {1,1,38}, {1,1,38}, {1,1,38}, {1,1,38}, {2,7,71}, {1,7,216}, {87,6,0}, {87,6,0},
+    {2,5,40}, {2,5,40}, {2,5,40}, {2,5,40}, {1,4,90}, {1,4,90}, {1,4,90}, {1,4,90},
+    {1,4,90}, {1,4,90}, {1,4,90}, {1,4,90}, {99,6,0}, {99,6,0}, {1,7,200}, {6,7,19},
+    {62,5,0}, {62,5,0}, {62,5,0}, {62,5,0}, {2,6,47}, {2,6,47}, {12,6,3}, {12,6,3},
+    {2,6,54}, {2,6,54}, {11,6,3}, {11,6,3}, {2,3,17}, {2,3,17}, {2,3,17}, {2,3,17},
+    {2,3,17}, {2,3,17}, {2,3,17}, {2,3,17}, {2,3,17}, {2,3,17}, {2,3,17}, {2,3,17},
+    {2,3,17}, {2,3,17}, {2,3,17}, {2,3,17}, {1,3,71}, {1,3,71}, {1,3,71}, {1,3,71},
+    {1,3,71}, {1,3,71}, {1,3,71}, {1,3,71}, {1,3,71}, {1,3,71}, {1,3,71}, {1,3,71},
+    {1,3,71}, {1,3,71}, {1,3,71}, {1,3,71}, {1,4,93}, {1,4,93}, {1,4,93}, {1,4,93},
+    {1,4,93}, {1,4,93}, {1,4,93}, {1,4,93}, {1,5,116}, {1,5,116}, {1,5,116}, {1,5,116},
+    {66,5,0}, {66,5,0}, {66,5,0}, {66,5,0}, {1,3,70}, {1,3,70}, {1,3,70}, {1,3,70},
+    {1,3,70}, {1,3,70}, {1,3,70}, {1,3,70}, {1,3,70}, {1,3,70}, {1,3,70}, {1,3,70},
+    {1,3,70}, {1,3,70}, {1,3,70}, {1,3,70}, {1,5,121}, {1,5,121}, {1,5,121}, {1,5,121},
+    {1,5,112}, {1,5,112}, {1,5,112}, {1,5,112}, {1,4,96}, {1,4,96}, {1,4,96}, {1,4,96},
+    {1,4,96}, {1,4,96}, {1,4,96}, {1,4,96}, {6,4,4}, {6,4,4}, {6,4,4}, {6,4,4},
+    {6,4,4}, {6,4,4}, {6,4,4}, {6,4,4}, {6,7,14}, {1,7,202}, {119,7,0}, {130,7,0},
+    {12,7,4}, {39,7,1}, {6,7,16}, {139,7,0}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39},
+    {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39},
+    {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39},
+    {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39},
+    {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39},
+    {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39},
+    {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39},
+    {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39},
+    {1,1,39}, {1,1,39}, {1,1,39}, {1,1,39}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49},
+    {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49},
+    {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49},
+    {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49},
+    {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49},
+    {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49},
+    {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49},
+    {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49},
+    {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49},
+    {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49},
+    {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49},
+    {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49},
+    {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49},
+    {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49},
+    {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49},
+    {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49},
+    {1,2,49}, {1,2,49}, {1,2,49}, {1,2,49}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72},
+    {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72},
+    {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72},
+    {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72},
+    {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72},
+    {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72},
+    {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72},
+    {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72},
+    {1,3,72}, {1,3,72}, {1,3,72}, {1,3,72}, {113,7,0}, {113,7,0}, {113,7,0}, {113,7,0},
+    {1,7,197}, {1,7,197}, {1,7,197}, {1,7,197}, {10,7,7}, {10,7,7}, {10,7,7}, {10,7,7},
+    {5,7,16}, {5,7,16}, {5,7,16}, {5,7,16}, {2,6,52}, {2,6,52}, {2,6,52}, {2,6,52},
+    {2,6,52}, {2,6,52}, {2,6,52}, {2,6,52}, {3,6,39}, {3,6,39}, {3,6,39}, {3,6,39},
+    {3,6,39}, {3,6,39}, {3,6,39}, {3,6,39}, {85,6,0}, {85,6,0}, {85,6,0}, {85,6,0},
+    {85,6,0}, {85,6,0}, {85,6,0}, {85,6,0}, {4,7,40}, {4,7,40}, {4,7,40}, {4,7,40},
+    {8300,-1,0}, {4,9,48}, {1,9,316}, {4,9,51}, {4,5,12}, {4,5,12}, {4,5,12}, {4,5,12},
+    {4,5,12}, {4,5,12}, {4,5,12}, {4,5,12}, {4,5,12}, {4,5,12}, {4,5,12}, {4,5,12},
+    {4,5,12}, {4,5,12}, {4,5,12}, {4,5,12}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51},
+    {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51},
+    {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51},
+    {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51},
+    {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51},
+    {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51},
+    {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51},
+    {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51},
+    {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51},
+    {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51},
+    {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51},
+    {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51},
+    {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51},
+    {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51},
+    {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51},
+    {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51},
+    {1,2,51}, {1,2,51}, {1,2,51}, {1,2,51}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6},
+    {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6},
+    {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6},
+    {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6},
+    {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6},
+    {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6},
+    {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6},
+    {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6},
+    {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6},
+    {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6},
+    {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6},
+    {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6},
+    {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6},
+    {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6},
+    {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6},
+    {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6},
+    {3,2,6}, {3,2,6}, {3,2,6}, {3,2,6}, {4,1,57}, {2,1,113}, {2,2,12}, {2,2,12},
+    {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12},
+    {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {2,2,12}, {3,3,9}, {3,3,9},
+    {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9}, {2,6,50}, {91,6,0},
+    {2,6,48}, {2,6,55}, {47,4,0}, {47,4,0}, {47,4,0}, {47,4,0}, {33,3,0}, {33,3,0},
+    {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {33,3,0}, {7,3,2}, {7,3,2},
+    {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {7,3,2}, {24,2,0}, {24,2,0},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0},
+    {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {24,2,0}, {1,3,67}, {1,3,67},
+    {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67},
+    {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67},
+    {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67},
+    {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67},
+    {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67},
+    {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67},
+    {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67},
+    {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {1,3,67}, {19,5,1}, {19,5,1},
+    {19,5,1}, {19,5,1}, {19,5,1}, {19,5,1}, {19,5,1}, {19,5,1}, {19,5,1}, {19,5,1},
+    {19,5,1}, {19,5,1}, {19,5,1}, {19,5,1}, {19,5,1}, {19,5,1}, {1,9,336}, {1,9,334},
+    {8,9,22}, {1,9,311}, {10,9,15}, {6,9,38}, {9,9,16}, {6,9,37}, {10,9,16}, {1,9,328},
+    {1,9,321}, {8,9,27}, {5,9,32}, {6,9,31}, {10,9,11}, {14,9,6}, {1,4,92}, {1,4,92},
+    {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92},
+    {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92},
+    {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92},
+    {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92}, {1,4,92}, {2,4,26}, {2,4,26},
+    {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26},
+    {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26},
+    {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26},
+    {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {2,4,26}, {50,4,0}, {50,4,0},
+    {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0},
+    {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0},
+    {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0},
+    {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {50,4,0}, {6,9,40}, {1,9,349},
+    {6,9,28}, {9,9,18}, {6,9,39}, {2,9,77}, {4,9,55}, {4,9,53}, {3,9,64}, {3,9,73},
+    {49,8,1}, {49,8,1}, {1,8,305}, {1,8,305}, {12,8,6}, {12,8,6}, {1,8,293}, {1,8,293},
+    {11,8,8}, {11,8,8}, {1,8,307}, {1,8,307}, {1,8,303}, {1,8,303}, {1,8,288}, {1,8,288},
+    {1,8,262}, {1,8,262}, {53,8,1}, {53,8,1}, {167,8,0}, {167,8,0}, {1,8,301}, {1,8,301},
+    {44,8,1}, {44,8,1}, {2,8,109}, {2,8,109}, {1,8,257}, {1,8,257}, {180,8,0}, {180,8,0},
+    {4,8,45}, {4,8,45}, {8,8,14}, {8,8,14}, {3,8,51}, {3,8,51}, {1,8,250}, {1,8,250},
+    {1,8,276}, {1,8,276}, {2,8,88}, {2,8,88}, {3,8,55}, {3,8,55}, {1,8,329}, {1,8,329},
+    {3,8,57}, {3,8,57}, {2,8,64}, {2,8,64}, {2,8,108}, {2,8,108}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4},
+    {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {3,1,4}, {10,8,9}, {6,8,34},
+    {6,8,23}, {5,8,39}, {37,7,1}, {37,7,1}, {127,7,0}, {127,7,0}, {141,7,0}, {141,7,0},
+    {15,7,3}, {15,7,3}, {7,6,8}, {7,6,8}, {7,6,8}, {7,6,8}, {1,5,140}, {1,5,140},
+    {1,5,140}, {1,5,140}, {1,5,140}, {1,5,140}, {1,5,140}, {1,5,140}, {9,5,3}, {9,5,3},
+    {9,5,3}, {9,5,3}, {9,5,3}, {9,5,3}, {9,5,3}, {9,5,3}, {5,4,6}, {5,4,6},
+    {5,4,6}, {5,4,6}, {5,4,6}, {5,4,6}, {5,4,6}, {5,4,6}, {5,4,6}, {5,4,6},
+    {5,4,6}, {5,4,6}, {5,4,6}, {5,4,6}, {5,4,6}, {5,4,6}, {3,4,13}, {3,4,13},
+    {3,4,13}, {3,4,13}, {3,4,13}, {3,4,13}, {3,4,13}, {3,4,13}, {3,4,13}, {3,4,13},
+    {3,4,13}, {3,4,13}, {3,4,13}, {3,4,13}, {3,4,13}, {3,4,13}, {1,2,53}, {1,2,53},
+    {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53},
+    {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53},
+    {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53},
+    {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53},
+    {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53},
+    {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53},
+    {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53},
+    {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {1,2,53}, {2,6,43}, {2,6,43},
+    {2,6,43}, {2,6,43}, {94,6,0}, {94,6,0}, {94,6,0}, {94,6,0}, {64,5,0}, {64,5,0},
+    {64,5,0}, {64,5,0}, {64,5,0}, {64,5,0}, {64,5,0}, {64,5,0}, {1,5,123}, {1,5,123},
+    {1,5,123}, {1,5,123}, {1,5,123}, {1,5,123}, {1,5,123}, {1,5,123}, {1,6,158}, {1,6,158},
+    {1,6,158}, {1,6,158}, {124,7,0}, {124,7,0}, {31,7,1}, {31,7,1}, {2,3,18}, {2,3,18},
+    {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18},
+    {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18},
+    {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18},
+    {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {2,3,18}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1},
+    {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {9,2,1}, {4,5,13}, {4,5,13},
+    {4,5,13}, {4,5,13}, {69,5,0}, {69,5,0}, {69,5,0}, {69,5,0}, {1,7,246}, {14,7,3},
+    {2,6,53}, {2,6,53}, {1,6,159}, {1,6,159}, {1,6,168}, {1,6,168}, {27,6,1}, {27,6,1},
+    {1,6,162}, {1,6,162}, {1,5,130}, {1,5,130}, {1,5,130}, {1,5,130}, {1,4,94}, {1,4,94},
+    {1,4,94}, {1,4,94}, {1,4,94}, {1,4,94}, {1,4,94}, {1,4,94}, {1,2,52}, {1,2,52},
+    {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52},
+    {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52},
+    {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52},
+    {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52}, {1,2,52}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0},
+    {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {18,1,0}, {34,3,0}, {34,3,0},
+    {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0},
+    {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0},
+    {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0},
+    {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0},
+    {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0},
+    {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0},
+    {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0},
+    {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {34,3,0}, {12,3,1}, {12,3,1},
+    {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1},
+    {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1},
+    {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1},
+    {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1},
+    {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1},
+    {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1},
+    {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1},
+    {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {12,3,1}, {2,5,36}, {2,5,36},
+    {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36},
+    {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {107,6,0}, {107,6,0},
+    {107,6,0}, {107,6,0}, {107,6,0}, {107,6,0}, {107,6,0}, {107,6,0}, {145,7,0}, {145,7,0},
+    {145,7,0}, {145,7,0}, {1,9,322}, {9774,-1,0}, {153,8,0}, {153,8,0}, {2,6,49}, {2,6,49},
+    {2,6,49}, {2,6,49}, {2,6,49}, {2,6,49}, {2,6,49}, {2,6,49}, {1,6,160}, {1,6,160},
+    {1,6,160}, {1,6,160}, {1,6,160}, {1,6,160}, {1,6,160}, {1,6,160}, {8,6,6}, {8,6,6},
+    {8,6,6}, {8,6,6}, {8,6,6}, {8,6,6}, {8,6,6}, {8,6,6}, {1,6,174}, {1,6,174},
+    {1,6,174}, {1,6,174}, {1,6,174}, {1,6,174}, {1,6,174}, {1,6,174}, {2,3,19}, {2,3,19},
+    {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19},
+    {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19},
+    {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19},
+    {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19},
+    {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19},
+    {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19},
+    {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19},
+    {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {2,3,19}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1},
+    {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {7,1,1}, {1,1,344}, {1,1,350},
+    {65,5,0}, {65,5,0}, {65,5,0}, {65,5,0}, {65,5,0}, {65,5,0}, {65,5,0}, {65,5,0},
+    {12,5,2}, {12,5,2}, {12,5,2}, {12,5,2}, {12,5,2}, {12,5,2}, {12,5,2}, {12,5,2},
+    {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2},
+    {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2}, {9,4,2},
+    {1,6,155}, {1,6,155}, {1,6,155}, {1,6,155}, {2,8,83}, {5,8,34}, {2,8,102}, {155,8,0},
+    {70,5,0}, {70,5,0}, {70,5,0}, {70,5,0}, {70,5,0}, {70,5,0}, {70,5,0}, {70,5,0},
+    {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3},
+    {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3}, {7,4,3},
+    {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0},
+    {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0}, {46,4,0},
+    {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27},
+    {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27}, {2,4,27},
+    {142,8,0}, {3,8,69}, {5,8,25}, {170,8,0}, {11,8,7}, {25,8,2}, {1,8,309}, {57,8,1},
+    {1,8,289}, {1,8,278}, {2,8,121}, {6,8,21}, {51,8,1}, {67,8,1}, {9,8,13}, {1,8,230},
+    {3,8,53}, {33,8,2}, {1,8,265}, {3,8,46}, {24,8,2}, {7,8,22}, {134,7,0}, {134,7,0},
+    {4,7,30}, {4,7,30}, {1,7,198}, {1,7,198}, {163,7,0}, {163,7,0}, {144,7,0}, {144,7,0},
+    {1,7,225}, {1,7,225}, {135,7,0}, {135,7,0}, {9,7,7}, {9,7,7}, {140,7,0}, {140,7,0},
+    {4,7,38}, {4,7,38}, {1,7,214}, {1,7,214}, {38,7,1}, {38,7,1}, {1,7,234}, {1,7,234},
+    {105,6,0}, {105,6,0}, {105,6,0}, {105,6,0}, {93,6,0}, {93,6,0}, {93,6,0}, {93,6,0},
+    {1,6,154}, {1,6,154}, {1,6,154}, {1,6,154}, {5,6,14}, {5,6,14}, {5,6,14}, {5,6,14},
+    {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73},
+    {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73},
+    {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73},
+    {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73}, {1,3,73},
+    {3,5,21}, {3,5,21}, {3,5,21}, {3,5,21}, {3,5,21}, {3,5,21}, {3,5,21}, {3,5,21},
+    {77,5,0}, {77,5,0}, {77,5,0}, {77,5,0}, {77,5,0}, {77,5,0}, {77,5,0}, {77,5,0},
+    {3,4,14}, {3,4,14}, {3,4,14}, {3,4,14}, {3,4,14}, {3,4,14}, {3,4,14}, {3,4,14},
+    {3,4,14}, {3,4,14}, {3,4,14}, {3,4,14}, {3,4,14}, {3,4,14}, {3,4,14}, {3,4,14},
+    {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0},
+    {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0}, {49,4,0},
+    {2,5,38}, {2,5,38}, {2,5,38}, {2,5,38}, {2,5,38}, {2,5,38}, {2,5,38}, {2,5,38},
+    {3,7,45}, {3,7,45}, {1,7,260}, {1,7,260}, {2,6,61}, {2,6,61}, {2,6,61}, {2,6,61},
+    {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0}, {35,3,0},
+    {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6},
+    {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74}, {1,3,74},
+    {4,6,19}, {106,6,0}, {1,6,183}, {8,6,7}, {108,6,0}, {6,6,9}, {67,5,0}, {67,5,0},
+    {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40},
+    {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40},
+    {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40},
+    {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40}, {1,1,40},
+    {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9},
+    {1,5,129}, {1,5,129}, {1,5,129}, {1,5,129}, {1,7,219}, {2,7,69}, {1,7,217}, {3,7,61},
+    {157,7,0}, {129,7,0}, {143,7,0}, {156,7,0}, {111,7,0}, {5,7,22}, {34,7,1}, {20,7,2},
+    {1,6,178}, {1,6,178}, {1,6,167}, {1,6,167}, {1,6,180}, {1,6,180}, {96,6,0}, {96,6,0},
+    {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13},
+    {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13},
+    {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13},
+    {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13}, {2,2,13},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0}, {25,2,0},
+    {1,5,127}, {1,5,127}, {1,5,127}, {1,5,127}, {2,5,37}, {2,5,37}, {2,5,37}, {2,5,37},
+    {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0}, {48,4,0},
+    {1,5,124}, {1,5,124}, {1,5,124}, {1,5,124}, {2,6,58}, {2,6,58}, {1,6,181}, {1,6,181},
+    {1,4,102}, {1,4,102}, {1,4,102}, {1,4,102}, {1,4,102}, {1,4,102}, {1,4,102}, {1,4,102},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54},
+    {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54},
+    {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54},
+    {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54},
+    {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54},
+    {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54},
+    {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54},
+    {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54},
+    {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54},
+    {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54},
+    {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54},
+    {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54},
+    {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54},
+    {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54},
+    {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54},
+    {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54}, {1,2,54},
+    {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0},
+    {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0}, {74,5,0},
+    {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41},
+    {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41},
+    {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126},
+    {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126}, {1,5,126},
+    {6,9,30}, {2,9,100}, {1,9,295}, {9,9,19}, {3,9,63}, {3,9,71}, {8,9,20}, {10,9,12},
+    {2,9,116}, {10,9,14}, {2,8,66}, {2,8,66}, {2,8,80}, {2,8,80}, {5,8,33}, {5,8,33},
+    {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99},
+    {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99},
+    {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99},
+    {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99}, {1,4,99},
+    {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0},
+    {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0},
+    {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0},
+    {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0}, {51,4,0},
+    {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0},
+    {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0},
+    {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0},
+    {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0},
+    {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0},
+    {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0},
+    {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0},
+    {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0},
+    {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0},
+    {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0},
+    {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0},
+    {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0},
+    {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0},
+    {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0},
+    {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0},
+    {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0}, {19,1,0},
+    {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56},
+    {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56},
+    {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56},
+    {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56},
+    {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56},
+    {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56},
+    {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56},
+    {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56}, {1,2,56},
+    {1,4,101}, {1,4,101}, {1,4,101}, {1,4,101}, {1,4,101}, {1,4,101}, {1,4,101}, {1,4,101},
+    {1,4,101}, {1,4,101}, {1,4,101}, {1,4,101}, {1,4,101}, {1,4,101}, {1,4,101}, {1,4,101},
+    {3,8,66}, {4,8,50}, {176,8,0}, {26,8,2}, {178,8,0}, {1,8,263}, {7,8,16}, {1,8,308},
+    {7,8,20}, {1,8,291}, {58,8,1}, {10,8,18}, {7,8,23}, {12,8,7}, {1,8,330}, {1,8,306},
+    {66,8,1}, {4,8,54}, {2,8,101}, {2,8,95}, {13,8,9}, {65,8,1}, {83,8,1}, {1,8,268},
+    {9,8,11}, {2,8,89}, {2,7,76}, {2,7,76}, {1,7,237}, {1,7,237}, {158,7,0}, {158,7,0},
+    {6,7,15}, {6,7,15}, {2,7,70}, {2,7,70}, {1,7,224}, {1,7,224}, {2,7,68}, {2,7,68},
+    {18,7,2}, {18,7,2}, {19,7,2}, {19,7,2}, {133,7,0}, {133,7,0}, {48,7,1}, {48,7,1},
+};
+
+static const RL_VLC_ELEM coef4_rl_vlc[5794] = {
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4},
+    {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4},
+    {3,8,1}, {3,8,1}, {1,9,23}, {512,-9,0}, {5,7,0}, {5,7,0}, {5,7,0}, {5,7,0},
+    {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,8,17}, {1,8,17}, {1024,-9,0}, {1,9,24}, {1,7,12}, {1,7,12}, {1,7,12}, {1,7,12},
+    {1544,-2,0}, {1548,-8,0}, {2,8,3}, {2,8,3}, {4,9,1}, {1804,-3,0}, {1,8,18}, {1,8,18},
+    {0,6,0}, {0,6,0}, {0,6,0}, {0,6,0}, {0,6,0}, {0,6,0}, {0,6,0}, {0,6,0},
+    {4,6,0}, {4,6,0}, {4,6,0}, {4,6,0}, {4,6,0}, {4,6,0}, {4,6,0}, {4,6,0},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1}, {1,3,1},
+    {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0},
+    {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0}, {3,5,0},
+    {2,6,1}, {2,6,1}, {2,6,1}, {2,6,1}, {2,6,1}, {2,6,1}, {2,6,1}, {2,6,1},
+    {1812,-7,0}, {3,9,2}, {1940,-9,0}, {1,9,25}, {2452,-8,0}, {1,9,26}, {1,8,19}, {1,8,19},
+    {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8},
+    {1,7,13}, {1,7,13}, {1,7,13}, {1,7,13}, {2708,-8,0}, {2964,-2,0}, {7,8,0}, {7,8,0},
+    {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5},
+    {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5},
+    {2968,-1,0}, {1,9,27}, {2970,-8,0}, {3226,-8,0}, {2,7,2}, {2,7,2}, {2,7,2}, {2,7,2},
+    {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9},
+    {2,9,6}, {3482,-7,0}, {1,8,20}, {1,8,20}, {9,9,0}, {3610,-7,0}, {2,8,4}, {2,8,4},
+    {1,7,14}, {1,7,14}, {1,7,14}, {1,7,14}, {3738,-1,0}, {1,9,28}, {3740,-9,0}, {4254,-7,0},
+    {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3},
+    {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3},
+    {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3},
+    {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3}, {1,4,3},
+    {1,7,15}, {1,7,15}, {1,7,15}, {1,7,15}, {6,7,0}, {6,7,0}, {6,7,0}, {6,7,0},
+    {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10},
+    {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6},
+    {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6},
+    {4382,-9,0}, {4894,-7,0}, {5022,-8,0}, {1,9,29}, {1,8,21}, {1,8,21}, {5278,-1,0}, {5280,-8,0},
+    {1,8,22}, {1,8,22}, {5536,-6,0}, {2,9,7}, {1,7,16}, {1,7,16}, {1,7,16}, {1,7,16},
+    {1,6,11}, {1,6,11}, {1,6,11}, {1,6,11}, {1,6,11}, {1,6,11}, {1,6,11}, {1,6,11},
+    {5600,-6,0}, {10,9,0}, {8,8,0}, {8,8,0}, {5664,-7,0}, {5792,-1,0}, {2,8,5}, {2,8,5},
+    {3,5,28}, {3,5,28}, {3,5,28}, {3,5,28}, {3,5,28}, {3,5,28}, {3,5,28}, {3,5,28},
+    {3,5,28}, {3,5,28}, {3,5,28}, {3,5,28}, {3,5,28}, {3,5,28}, {3,5,28}, {3,5,28},
+    {1,6,75}, {1,6,75}, {1,6,75}, {1,6,75}, {1,6,75}, {1,6,75}, {1,6,75}, {1,6,75},
+    {4,7,30}, {4,7,30}, {4,7,30}, {4,7,30}, {2,7,54}, {2,7,54}, {2,7,54}, {2,7,54},
+    {6,6,6}, {6,6,6}, {6,6,6}, {6,6,6}, {6,6,6}, {6,6,6}, {6,6,6}, {6,6,6},
+    {32,6,0}, {32,6,0}, {32,6,0}, {32,6,0}, {32,6,0}, {32,6,0}, {32,6,0}, {32,6,0},
+    {3,6,30}, {3,6,30}, {3,6,30}, {3,6,30}, {3,6,30}, {3,6,30}, {3,6,30}, {3,6,30},
+    {2,7,42}, {2,7,42}, {2,7,42}, {2,7,42}, {4,9,37}, {3,9,44}, {2,9,66}, {3,9,42},
+    {2,5,33}, {2,5,33}, {2,5,33}, {2,5,33}, {2,5,33}, {2,5,33}, {2,5,33}, {2,5,33},
+    {2,5,33}, {2,5,33}, {2,5,33}, {2,5,33}, {2,5,33}, {2,5,33}, {2,5,33}, {2,5,33},
+    {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2},
+    {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2}, {8,5,2},
+    {4,5,11}, {4,5,11}, {4,5,11}, {4,5,11}, {4,5,11}, {4,5,11}, {4,5,11}, {4,5,11},
+    {4,5,11}, {4,5,11}, {4,5,11}, {4,5,11}, {4,5,11}, {4,5,11}, {4,5,11}, {4,5,11},
+    {14,6,1}, {14,6,1}, {14,6,1}, {14,6,1}, {14,6,1}, {14,6,1}, {14,6,1}, {14,6,1},
+    {4,6,19}, {4,6,19}, {4,6,19}, {4,6,19}, {4,6,19}, {4,6,19}, {4,6,19}, {4,6,19},
+    {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37},
+    {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37},
+    {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37},
+    {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37},
+    {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37},
+    {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37},
+    {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37},
+    {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37},
+    {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37},
+    {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37},
+    {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37},
+    {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37},
+    {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37},
+    {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37},
+    {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37},
+    {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37}, {1,2,37},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,5,22}, {3,5,22}, {3,5,22}, {3,5,22}, {3,5,22}, {3,5,22}, {3,5,22}, {3,5,22},
+    {3,5,22}, {3,5,22}, {3,5,22}, {3,5,22}, {3,5,22}, {3,5,22}, {3,5,22}, {3,5,22},
+    {12,5,1}, {12,5,1}, {12,5,1}, {12,5,1}, {12,5,1}, {12,5,1}, {12,5,1}, {12,5,1},
+    {12,5,1}, {12,5,1}, {12,5,1}, {12,5,1}, {12,5,1}, {12,5,1}, {12,5,1}, {12,5,1},
+    {4,6,25}, {4,6,25}, {4,6,25}, {4,6,25}, {4,6,25}, {4,6,25}, {4,6,25}, {4,6,25},
+    {49,9,0}, {65,9,0}, {8,8,7}, {8,8,7}, {7,8,26}, {7,8,26}, {14,8,2}, {14,8,2},
+    {23,5,0}, {23,5,0}, {23,5,0}, {23,5,0}, {23,5,0}, {23,5,0}, {23,5,0}, {23,5,0},
+    {23,5,0}, {23,5,0}, {23,5,0}, {23,5,0}, {23,5,0}, {23,5,0}, {23,5,0}, {23,5,0},
+    {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0},
+    {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0},
+    {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0},
+    {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0}, {19,4,0},
+    {7,8,20}, {7,8,20}, {4,8,38}, {4,8,38}, {6,8,26}, {6,8,26}, {2,8,63}, {2,8,63},
+    {1,8,111}, {1,8,111}, {50,8,0}, {50,8,0}, {47,8,0}, {47,8,0}, {2,8,58}, {2,8,58},
+    {6,7,11}, {6,7,11}, {6,7,11}, {6,7,11}, {7,7,7}, {7,7,7}, {7,7,7}, {7,7,7},
+    {4,7,39}, {4,7,39}, {4,7,39}, {4,7,39}, {5,7,25}, {5,7,25}, {5,7,25}, {5,7,25},
+    {1,7,84}, {1,7,84}, {1,7,84}, {1,7,84}, {2,7,55}, {2,7,55}, {2,7,55}, {2,7,55},
+    {7,6,6}, {7,6,6}, {7,6,6}, {7,6,6}, {7,6,6}, {7,6,6}, {7,6,6}, {7,6,6},
+    {3,5,25}, {3,5,25}, {3,5,25}, {3,5,25}, {3,5,25}, {3,5,25}, {3,5,25}, {3,5,25},
+    {3,5,25}, {3,5,25}, {3,5,25}, {3,5,25}, {3,5,25}, {3,5,25}, {3,5,25}, {3,5,25},
+    {1,5,64}, {1,5,64}, {1,5,64}, {1,5,64}, {1,5,64}, {1,5,64}, {1,5,64}, {1,5,64},
+    {1,5,64}, {1,5,64}, {1,5,64}, {1,5,64}, {1,5,64}, {1,5,64}, {1,5,64}, {1,5,64},
+    {3,7,38}, {3,7,38}, {3,7,38}, {3,7,38}, {62,8,0}, {62,8,0}, {61,9,0}, {1536,-3,0},
+    {4,6,20}, {4,6,20}, {4,6,20}, {4,6,20}, {4,6,20}, {4,6,20}, {4,6,20}, {4,6,20},
+    {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56},
+    {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56},
+    {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56},
+    {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56}, {1,4,56},
+    {5,6,13}, {5,6,13}, {5,6,13}, {5,6,13}, {5,6,13}, {5,6,13}, {5,6,13}, {5,6,13},
+    {3,6,39}, {3,6,39}, {3,6,39}, {3,6,39}, {3,6,39}, {3,6,39}, {3,6,39}, {3,6,39},
+    {1,5,70}, {1,5,70}, {1,5,70}, {1,5,70}, {1,5,70}, {1,5,70}, {1,5,70}, {1,5,70},
+    {1,5,70}, {1,5,70}, {1,5,70}, {1,5,70}, {1,5,70}, {1,5,70}, {1,5,70}, {1,5,70},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30}, {1,1,30},
+    {70,1,0}, {70,1,0}, {70,1,0}, {70,1,0}, {59,3,0}, {9,3,7}, {8,2,13}, {8,2,13},
+    {6,2,1}, {1,2,39}, {2,1,8}, {2,1,8}, {1,4,57}, {1,4,57}, {1,4,57}, {1,4,57},
+    {1,4,57}, {1,4,57}, {1,4,57}, {1,4,57}, {1,4,57}, {1,4,57}, {1,4,57}, {1,4,57},
+    {1,4,57}, {1,4,57}, {1,4,57}, {1,4,57}, {3,7,35}, {3,7,35}, {7,7,10}, {7,7,10},
+    {1,7,85}, {1,7,85}, {9,7,3}, {9,7,3}, {29,6,0}, {29,6,0}, {29,6,0}, {29,6,0},
+    {1,6,76}, {1,6,76}, {1,6,76}, {1,6,76}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21},
+    {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21},
+    {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21},
+    {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21},
+    {2,3,21}, {2,3,21}, {2,3,21}, {2,3,21}, {2,5,40}, {2,5,40}, {2,5,40}, {2,5,40},
+    {2,5,40}, {2,5,40}, {2,5,40}, {2,5,40}, {13,6,1}, {13,6,1}, {13,6,1}, {13,6,1},
+    {6,8,21}, {6,8,31}, {5,8,24}, {6,8,24}, {3,4,14}, {3,4,14}, {3,4,14}, {3,4,14},
+    {3,4,14}, {3,4,14}, {3,4,14}, {3,4,14}, {3,4,14}, {3,4,14}, {3,4,14}, {3,4,14},
+    {3,4,14}, {3,4,14}, {3,4,14}, {3,4,14}, {16,3,0}, {16,3,0}, {16,3,0}, {16,3,0},
+    {16,3,0}, {16,3,0}, {16,3,0}, {16,3,0}, {16,3,0}, {16,3,0}, {16,3,0}, {16,3,0},
+    {16,3,0}, {16,3,0}, {16,3,0}, {16,3,0}, {16,3,0}, {16,3,0}, {16,3,0}, {16,3,0},
+    {16,3,0}, {16,3,0}, {16,3,0}, {16,3,0}, {16,3,0}, {16,3,0}, {16,3,0}, {16,3,0},
+    {16,3,0}, {16,3,0}, {16,3,0}, {16,3,0}, {1,3,44}, {1,3,44}, {1,3,44}, {1,3,44},
+    {1,3,44}, {1,3,44}, {1,3,44}, {1,3,44}, {1,3,44}, {1,3,44}, {1,3,44}, {1,3,44},
+    {1,3,44}, {1,3,44}, {1,3,44}, {1,3,44}, {1,3,44}, {1,3,44}, {1,3,44}, {1,3,44},
+    {1,3,44}, {1,3,44}, {1,3,44}, {1,3,44}, {1,3,44}, {1,3,44}, {1,3,44}, {1,3,44},
+    {1,3,44}, {1,3,44}, {1,3,44}, {1,3,44}, {1,3,43}, {1,3,43}, {1,3,43}, {1,3,43},
+    {1,3,43}, {1,3,43}, {1,3,43}, {1,3,43}, {1,3,43}, {1,3,43}, {1,3,43}, {1,3,43},
+    {1,3,43}, {1,3,43}, {1,3,43}, {1,3,43}, {1,3,43}, {1,3,43}, {1,3,43}, {1,3,43},
+    {1,3,43}, {1,3,43}, {1,3,43}, {1,3,43}, {1,3,43}, {1,3,43}, {1,3,43}, {1,3,43},
+    {1,3,43}, {1,3,43}, {1,3,43}, {1,3,43}, {2,5,35}, {2,5,35}, {2,5,35}, {2,5,35},
+    {2,5,35}, {2,5,35}, {2,5,35}, {2,5,35}, {6,5,4}, {6,5,4}, {6,5,4}, {6,5,4},
+    {6,5,4}, {6,5,4}, {6,5,4}, {6,5,4}, {2,4,31}, {2,4,31}, {2,4,31}, {2,4,31},
+    {2,4,31}, {2,4,31}, {2,4,31}, {2,4,31}, {2,4,31}, {2,4,31}, {2,4,31}, {2,4,31},
+    {2,4,31}, {2,4,31}, {2,4,31}, {2,4,31}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7},
+    {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7},
+    {4,4,7}, {4,4,7}, {4,4,7}, {4,4,7}, {5,8,34}, {5,8,26}, {45,8,0}, {40,8,0},
+    {46,7,0}, {46,7,0}, {17,7,1}, {17,7,1}, {24,5,0}, {24,5,0}, {24,5,0}, {24,5,0},
+    {24,5,0}, {24,5,0}, {24,5,0}, {24,5,0}, {2,2,14}, {2,2,14}, {3,3,8}, {1,3,47},
+    {5,1,1}, {5,1,1}, {5,1,1}, {5,1,1}, {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5},
+    {5,4,5}, {5,4,5}, {5,4,5}, {5,4,5}, {4,5,13}, {4,5,13}, {4,5,13}, {4,5,13},
+    {2,7,46}, {2,7,52}, {30,6,0}, {30,6,0}, {1,3,45}, {1,3,45}, {1,3,45}, {1,3,45},
+    {1,3,45}, {1,3,45}, {1,3,45}, {1,3,45}, {1,3,45}, {1,3,45}, {1,3,45}, {1,3,45},
+    {1,3,45}, {1,3,45}, {1,3,45}, {1,3,45}, {4,3,5}, {4,3,5}, {4,3,5}, {4,3,5},
+    {4,3,5}, {4,3,5}, {4,3,5}, {4,3,5}, {4,3,5}, {4,3,5}, {4,3,5}, {4,3,5},
+    {4,3,5}, {4,3,5}, {4,3,5}, {4,3,5}, {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30},
+    {2,4,30}, {2,4,30}, {2,4,30}, {2,4,30}, {1,5,67}, {1,5,67}, {1,5,67}, {1,5,67},
+    {1,5,65}, {1,5,65}, {1,5,65}, {1,5,65}, {2,3,22}, {2,3,22}, {2,3,22}, {2,3,22},
+    {2,3,22}, {2,3,22}, {2,3,22}, {2,3,22}, {2,3,22}, {2,3,22}, {2,3,22}, {2,3,22},
+    {2,3,22}, {2,3,22}, {2,3,22}, {2,3,22}, {1,3,46}, {1,3,46}, {1,3,46}, {1,3,46},
+    {1,3,46}, {1,3,46}, {1,3,46}, {1,3,46}, {1,3,46}, {1,3,46}, {1,3,46}, {1,3,46},
+    {1,3,46}, {1,3,46}, {1,3,46}, {1,3,46}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0},
+    {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0},
+    {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0},
+    {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0},
+    {13,2,0}, {13,2,0}, {13,2,0}, {13,2,0}, {1,6,77}, {1,6,77}, {1,6,77}, {1,6,77},
+    {1,6,77}, {1,6,77}, {1,6,77}, {1,6,77}, {4,7,22}, {4,7,22}, {4,7,22}, {4,7,22},
+    {5,7,29}, {5,7,29}, {5,7,29}, {5,7,29}, {1,5,66}, {1,5,66}, {1,5,66}, {1,5,66},
+    {1,5,66}, {1,5,66}, {1,5,66}, {1,5,66}, {1,5,66}, {1,5,66}, {1,5,66}, {1,5,66},
+    {1,5,66}, {1,5,66}, {1,5,66}, {1,5,66}, {11,7,2}, {11,7,2}, {11,7,2}, {11,7,2},
+    {4,7,40}, {4,7,40}, {4,7,40}, {4,7,40}, {1,7,95}, {1,7,95}, {1,7,95}, {1,7,95},
+    {5,7,21}, {5,7,21}, {5,7,21}, {5,7,21}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5},
+    {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5},
+    {6,5,5}, {6,5,5}, {6,5,5}, {6,5,5}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27},
+    {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27},
+    {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27},
+    {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27},
+    {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27},
+    {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27},
+    {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27},
+    {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27},
+    {2,3,27}, {2,3,27}, {2,3,27}, {2,3,27}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23},
+    {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23},
+    {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23},
+    {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23},
+    {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23},
+    {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23},
+    {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23},
+    {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23},
+    {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {26,5,0}, {26,5,0}, {26,5,0}, {26,5,0},
+    {26,5,0}, {26,5,0}, {26,5,0}, {26,5,0}, {26,5,0}, {26,5,0}, {26,5,0}, {26,5,0},
+    {26,5,0}, {26,5,0}, {26,5,0}, {26,5,0}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36},
+    {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36},
+    {2,5,36}, {2,5,36}, {2,5,36}, {2,5,36}, {2,7,45}, {2,7,45}, {2,7,45}, {2,7,45},
+    {6,9,27}, {1,9,102}, {5,9,33}, {57,9,0}, {1,6,78}, {1,6,78}, {1,6,78}, {1,6,78},
+    {1,6,78}, {1,6,78}, {1,6,78}, {1,6,78}, {1,5,74}, {1,5,74}, {1,5,74}, {1,5,74},
+    {1,5,74}, {1,5,74}, {1,5,74}, {1,5,74}, {1,5,74}, {1,5,74}, {1,5,74}, {1,5,74},
+    {1,5,74}, {1,5,74}, {1,5,74}, {1,5,74}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31},
+    {1,1,31}, {1,1,31}, {1,1,31}, {1,1,31}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0},
+    {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0},
+    {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0},
+    {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0},
+    {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0},
+    {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0},
+    {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0},
+    {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0},
+    {14,2,0}, {14,2,0}, {14,2,0}, {14,2,0}, {10,6,2}, {10,6,2}, {10,6,2}, {10,6,2},
+    {3,8,47}, {64,8,0}, {8,8,14}, {58,8,0}, {4,5,12}, {4,5,12}, {4,5,12}, {4,5,12},
+    {4,5,12}, {4,5,12}, {4,5,12}, {4,5,12}, {1,4,61}, {1,4,61}, {1,4,61}, {1,4,61},
+    {1,4,61}, {1,4,61}, {1,4,61}, {1,4,61}, {1,4,61}, {1,4,61}, {1,4,61}, {1,4,61},
+    {1,4,61}, {1,4,61}, {1,4,61}, {1,4,61}, {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24},
+    {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24},
+    {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24},
+    {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24},
+    {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {3,3,10}, {3,3,10}, {3,3,10}, {3,3,10},
+    {3,3,10}, {3,3,10}, {3,3,10}, {3,3,10}, {3,3,10}, {3,3,10}, {3,3,10}, {3,3,10},
+    {3,3,10}, {3,3,10}, {3,3,10}, {3,3,10}, {3,3,10}, {3,3,10}, {3,3,10}, {3,3,10},
+    {3,3,10}, {3,3,10}, {3,3,10}, {3,3,10}, {3,3,10}, {3,3,10}, {3,3,10}, {3,3,10},
+    {3,3,10}, {3,3,10}, {3,3,10}, {3,3,10}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17},
+    {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17},
+    {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {1,8,104}, {9,8,9}, {8,8,8}, {7,8,25},
+    {1,8,101}, {55,8,0}, {3,8,48}, {1,8,110}, {18,7,1}, {18,7,1}, {6,7,17}, {6,7,17},
+    {2,7,53}, {2,7,53}, {6,7,9}, {6,7,9}, {1,5,71}, {1,5,71}, {1,5,71}, {1,5,71},
+    {1,5,71}, {1,5,71}, {1,5,71}, {1,5,71}, {3,5,26}, {3,5,26}, {3,5,26}, {3,5,26},
+    {3,5,26}, {3,5,26}, {3,5,26}, {3,5,26}, {1,4,58}, {1,4,58}, {1,4,58}, {1,4,58},
+    {1,4,58}, {1,4,58}, {1,4,58}, {1,4,58}, {1,4,58}, {1,4,58}, {1,4,58}, {1,4,58},
+    {1,4,58}, {1,4,58}, {1,4,58}, {1,4,58}, {4,5,14}, {4,5,14}, {4,5,14}, {4,5,14},
+    {4,5,14}, {4,5,14}, {4,5,14}, {4,5,14}, {6,7,14}, {6,7,14}, {2,7,51}, {2,7,51},
+    {6,7,12}, {6,7,12}, {1,8,112}, {7,8,16}, {20,4,0}, {20,4,0}, {20,4,0}, {20,4,0},
+    {20,4,0}, {20,4,0}, {20,4,0}, {20,4,0}, {20,4,0}, {20,4,0}, {20,4,0}, {20,4,0},
+    {20,4,0}, {20,4,0}, {20,4,0}, {20,4,0}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3},
+    {4,2,3}, {4,2,3}, {4,2,3}, {4,2,3}, {7,4,2}, {7,4,2}, {7,4,2}, {7,4,2},
+    {7,4,2}, {7,4,2}, {7,4,2}, {7,4,2}, {7,4,2}, {7,4,2}, {7,4,2}, {7,4,2},
+    {7,4,2}, {7,4,2}, {7,4,2}, {7,4,2}, {3,6,32}, {3,6,32}, {3,6,32}, {3,6,32},
+    {4,6,21}, {4,6,21}, {4,6,21}, {4,6,21}, {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7},
+    {5,5,7}, {5,5,7}, {5,5,7}, {5,5,7}, {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9},
+    {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9},
+    {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9},
+    {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9},
+    {3,3,9}, {3,3,9}, {3,3,9}, {3,3,9}, {1,2,40}, {3,2,6}, {1,1,32}, {1,1,32},
+    {3,1,4}, {11,1,0}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25},
+    {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25},
+    {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25},
+    {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25}, {2,3,25},
+    {2,3,25}, {2,3,25}, {3,4,15}, {3,4,15}, {3,4,15}, {3,4,15}, {3,4,15}, {3,4,15},
+    {3,4,15}, {3,4,15}, {3,4,15}, {3,4,15}, {3,4,15}, {3,4,15}, {3,4,15}, {3,4,15},
+    {3,4,15}, {3,4,15}, {1,7,93}, {1,7,93}, {6,7,25}, {6,7,25}, {2,7,47}, {2,7,47},
+    {1,7,92}, {1,7,92}, {8,7,6}, {8,7,6}, {5,7,23}, {5,7,23}, {42,7,0}, {42,7,0},
+    {6,7,15}, {6,7,15}, {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0},
+    {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0},
+    {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0},
+    {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0}, {17,3,0},
+    {17,3,0}, {17,3,0}, {27,5,0}, {27,5,0}, {27,5,0}, {27,5,0}, {27,5,0}, {27,5,0},
+    {27,5,0}, {27,5,0}, {3,6,33}, {3,6,33}, {3,6,33}, {3,6,33}, {33,6,0}, {33,6,0},
+    {33,6,0}, {33,6,0}, {1,4,59}, {1,4,59}, {1,4,59}, {1,4,59}, {1,4,59}, {1,4,59},
+    {1,4,59}, {1,4,59}, {1,4,59}, {1,4,59}, {1,4,59}, {1,4,59}, {1,4,59}, {1,4,59},
+    {1,4,59}, {1,4,59}, {1,5,69}, {1,5,69}, {1,5,69}, {1,5,69}, {1,5,69}, {1,5,69},
+    {1,5,69}, {1,5,69}, {7,5,3}, {7,5,3}, {7,5,3}, {7,5,3}, {7,5,3}, {7,5,3},
+    {7,5,3}, {7,5,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3},
+    {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3}, {6,4,3},
+    {6,4,3}, {6,4,3}, {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1},
+    {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1},
+    {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1},
+    {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1}, {8,3,1},
+    {8,3,1}, {8,3,1}, {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26},
+    {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26},
+    {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26},
+    {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26}, {2,3,26},
+    {2,3,26}, {2,3,26}, {1,5,72}, {1,5,72}, {1,5,72}, {1,5,72}, {1,5,72}, {1,5,72},
+    {1,5,72}, {1,5,72}, {7,8,18}, {7,8,19}, {8,8,11}, {68,8,0}, {54,8,0}, {6,8,23},
+    {2,8,64}, {51,8,0}, {3,4,18}, {3,4,18}, {3,4,18}, {3,4,18}, {3,4,18}, {3,4,18},
+    {3,4,18}, {3,4,18}, {3,4,18}, {3,4,18}, {3,4,18}, {3,4,18}, {3,4,18}, {3,4,18},
+    {3,4,18}, {3,4,18}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15},
+    {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15},
+    {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15},
+    {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15},
+    {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15},
+    {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15},
+    {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15},
+    {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15},
+    {2,2,15}, {2,2,15}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3},
+    {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3},
+    {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3},
+    {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3}, {5,3,3},
+    {5,3,3}, {5,3,3}, {21,4,0}, {21,4,0}, {21,4,0}, {21,4,0}, {21,4,0}, {21,4,0},
+    {21,4,0}, {21,4,0}, {21,4,0}, {21,4,0}, {21,4,0}, {21,4,0}, {21,4,0}, {21,4,0},
+    {21,4,0}, {21,4,0}, {1,8,107}, {4,8,36}, {5,7,16}, {5,7,16}, {1,7,86}, {1,7,86},
+    {4,7,29}, {4,7,29}, {4,7,34}, {4,7,34}, {12,7,2}, {12,7,2}, {6,7,20}, {6,7,20},
+    {10,7,4}, {10,7,4}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {7,7,12}, {2,7,49}, {4,6,24}, {4,6,24}, {1,6,79}, {1,6,79},
+    {1,6,80}, {1,6,80}, {1,6,83}, {1,6,83}, {5,6,15}, {5,6,15}, {1,6,81}, {1,6,81},
+    {16,6,1}, {16,6,1}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1}, {10,4,1},
+    {10,4,1}, {10,4,1}, {3,4,16}, {3,4,16}, {3,4,16}, {3,4,16}, {3,4,16}, {3,4,16},
+    {3,4,16}, {3,4,16}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17},
+    {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17},
+    {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17},
+    {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17},
+    {2,2,17}, {2,2,17}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2}, {4,1,2},
+    {4,1,2}, {4,1,2}, {1,3,48}, {1,3,48}, {1,3,48}, {1,3,48}, {1,3,48}, {1,3,48},
+    {1,3,48}, {1,3,48}, {1,3,48}, {1,3,48}, {1,3,48}, {1,3,48}, {1,3,48}, {1,3,48},
+    {1,3,48}, {1,3,48}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2},
+    {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2}, {6,3,2},
+    {6,3,2}, {6,3,2}, {1,4,60}, {1,4,60}, {1,4,60}, {1,4,60}, {1,4,60}, {1,4,60},
+    {1,4,60}, {1,4,60}, {6,6,7}, {6,6,7}, {7,7,13}, {6,7,19}, {43,7,0}, {1,7,98},
+    {5,7,31}, {7,7,8}, {4,4,8}, {4,4,8}, {4,4,8}, {4,4,8}, {4,4,8}, {4,4,8},
+    {4,4,8}, {4,4,8}, {34,6,0}, {34,6,0}, {15,6,1}, {15,6,1}, {5,5,8}, {5,5,8},
+    {5,5,8}, {5,5,8}, {1,4,62}, {1,4,62}, {1,4,62}, {1,4,62}, {1,4,62}, {1,4,62},
+    {1,4,62}, {1,4,62}, {3,4,19}, {3,4,19}, {3,4,19}, {3,4,19}, {3,4,19}, {3,4,19},
+    {3,4,19}, {3,4,19}, {4,6,28}, {4,6,28}, {3,6,34}, {3,6,34}, {4,5,17}, {4,5,17},
+    {4,5,17}, {4,5,17}, {28,5,0}, {28,5,0}, {28,5,0}, {28,5,0}, {1,6,82}, {1,6,82},
+    {7,6,5}, {7,6,5}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41}, {1,2,41},
+    {1,2,41}, {1,2,41}, {1,1,33}, {2,1,11}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12},
+    {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12},
+    {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12},
+    {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12},
+    {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12},
+    {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12},
+    {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12},
+    {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12},
+    {3,3,12}, {3,3,12}, {3,3,12}, {3,3,12}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4},
+    {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4},
+    {7,5,4}, {7,5,4}, {7,5,4}, {7,5,4}, {2,5,37}, {2,5,37}, {2,5,37}, {2,5,37},
+    {2,5,37}, {2,5,37}, {2,5,37}, {2,5,37}, {2,5,37}, {2,5,37}, {2,5,37}, {2,5,37},
+    {2,5,37}, {2,5,37}, {2,5,37}, {2,5,37}, {1,5,68}, {1,5,68}, {1,5,68}, {1,5,68},
+    {1,5,68}, {1,5,68}, {1,5,68}, {1,5,68}, {1,5,68}, {1,5,68}, {1,5,68}, {1,5,68},
+    {1,5,68}, {1,5,68}, {1,5,68}, {1,5,68}, {3,5,23}, {3,5,23}, {3,5,23}, {3,5,23},
+    {3,5,23}, {3,5,23}, {3,5,23}, {3,5,23}, {3,5,23}, {3,5,23}, {3,5,23}, {3,5,23},
+    {3,5,23}, {3,5,23}, {3,5,23}, {3,5,23}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28},
+    {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28},
+    {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28},
+    {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28},
+    {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28},
+    {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28},
+    {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28},
+    {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28},
+    {2,3,28}, {2,3,28}, {2,3,28}, {2,3,28}, {4,4,10}, {4,4,10}, {4,4,10}, {4,4,10},
+    {4,4,10}, {4,4,10}, {4,4,10}, {4,4,10}, {4,4,10}, {4,4,10}, {4,4,10}, {4,4,10},
+    {4,4,10}, {4,4,10}, {4,4,10}, {4,4,10}, {4,4,10}, {4,4,10}, {4,4,10}, {4,4,10},
+    {4,4,10}, {4,4,10}, {4,4,10}, {4,4,10}, {4,4,10}, {4,4,10}, {4,4,10}, {4,4,10},
+    {4,4,10}, {4,4,10}, {4,4,10}, {4,4,10}, {4252,-1,0}, {9,9,8}, {7,9,22}, {7,9,23},
+    {7,9,24}, {1,9,103}, {5,9,38}, {3,9,43}, {6,8,29}, {6,8,29}, {52,8,0}, {52,8,0},
+    {5,8,35}, {5,8,35}, {7,8,15}, {7,8,15}, {2,8,65}, {2,8,65}, {66,8,0}, {66,8,0},
+    {1,8,109}, {1,8,109}, {1,8,97}, {1,8,97}, {6,7,16}, {6,7,16}, {6,7,16}, {6,7,16},
+    {3,7,37}, {3,7,37}, {3,7,37}, {3,7,37}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0},
+    {15,2,0}, {15,2,0}, {15,2,0}, {15,2,0}, {5,1,37}, {5,1,36}, {9,7,5}, {41,7,0},
+    {36,6,0}, {36,6,0}, {3,5,31}, {3,5,31}, {3,5,31}, {3,5,31}, {2,4,32}, {2,4,32},
+    {2,4,32}, {2,4,32}, {2,4,32}, {2,4,32}, {2,4,32}, {2,4,32}, {22,4,0}, {22,4,0},
+    {22,4,0}, {22,4,0}, {22,4,0}, {22,4,0}, {22,4,0}, {22,4,0}, {4,6,31}, {4,6,31},
+    {6,6,10}, {6,6,10}, {5,6,14}, {5,6,14}, {3,6,40}, {3,6,40}, {2,2,18}, {2,2,18},
+    {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18},
+    {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18},
+    {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18},
+    {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,1,12}, {2,1,12},
+    {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12},
+    {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12},
+    {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12},
+    {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12},
+    {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12},
+    {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12},
+    {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12},
+    {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {1,3,50}, {1,3,50},
+    {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50},
+    {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50},
+    {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50},
+    {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50},
+    {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50},
+    {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50},
+    {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50},
+    {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {1,3,50}, {0,3,1}, {0,3,1},
+    {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1},
+    {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1},
+    {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1},
+    {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1},
+    {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1},
+    {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1},
+    {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1},
+    {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {0,3,1}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2},
+    {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {5,2,2}, {1,3,49}, {1,3,49},
+    {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49},
+    {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49},
+    {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49},
+    {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49},
+    {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49},
+    {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49},
+    {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49},
+    {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {1,3,49}, {3,3,11}, {3,3,11},
+    {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11},
+    {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11},
+    {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11},
+    {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11},
+    {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11},
+    {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11},
+    {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11},
+    {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {1,5,73}, {1,5,73},
+    {1,5,73}, {1,5,73}, {1,5,73}, {1,5,73}, {1,5,73}, {1,5,73}, {1,5,73}, {1,5,73},
+    {1,5,73}, {1,5,73}, {1,5,73}, {1,5,73}, {1,5,73}, {1,5,73}, {4,5,16}, {4,5,16},
+    {4,5,16}, {4,5,16}, {4,5,16}, {4,5,16}, {4,5,16}, {4,5,16}, {4,5,16}, {4,5,16},
+    {4,5,16}, {4,5,16}, {4,5,16}, {4,5,16}, {4,5,16}, {4,5,16}, {5,6,11}, {5,6,11},
+    {5,6,11}, {5,6,11}, {5,6,11}, {5,6,11}, {5,6,11}, {5,6,11}, {69,8,0}, {69,8,0},
+    {63,9,0}, {3,9,46}, {6,7,18}, {6,7,18}, {6,7,18}, {6,7,18}, {4,5,15}, {4,5,15},
+    {4,5,15}, {4,5,15}, {4,5,15}, {4,5,15}, {4,5,15}, {4,5,15}, {4,5,15}, {4,5,15},
+    {4,5,15}, {4,5,15}, {4,5,15}, {4,5,15}, {4,5,15}, {4,5,15}, {5,5,10}, {5,5,10},
+    {5,5,10}, {5,5,10}, {5,5,10}, {5,5,10}, {5,5,10}, {5,5,10}, {5,5,10}, {5,5,10},
+    {5,5,10}, {5,5,10}, {5,5,10}, {5,5,10}, {5,5,10}, {5,5,10}, {2,5,41}, {2,5,41},
+    {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41},
+    {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41}, {2,5,41}, {4,4,9}, {4,4,9},
+    {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9},
+    {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9},
+    {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9},
+    {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {4,4,9}, {18,3,0}, {18,3,0},
+    {18,3,0}, {18,3,0}, {18,3,0}, {18,3,0}, {18,3,0}, {18,3,0}, {18,3,0}, {18,3,0},
+    {18,3,0}, {18,3,0}, {18,3,0}, {18,3,0}, {18,3,0}, {18,3,0}, {5,7,22}, {2,7,61},
+    {4,7,41}, {2,7,67}, {2,7,43}, {39,7,0}, {9,7,4}, {7,7,9}, {7,7,11}, {6,7,22},
+    {6,7,8}, {5,7,30}, {4,6,27}, {4,6,27}, {5,6,19}, {5,6,19}, {7,2,1}, {7,2,1},
+    {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1},
+    {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1},
+    {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1},
+    {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1}, {7,2,1}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34},
+    {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,1,34}, {1,3,53}, {1,3,53},
+    {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53},
+    {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53},
+    {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53},
+    {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53}, {1,3,53}, {4,6,26}, {4,6,26},
+    {4,6,26}, {4,6,26}, {5,6,17}, {5,6,17}, {5,6,17}, {5,6,17}, {5,5,12}, {5,5,12},
+    {5,5,12}, {5,5,12}, {5,5,12}, {5,5,12}, {5,5,12}, {5,5,12}, {3,4,27}, {3,4,27},
+    {3,4,27}, {3,4,27}, {3,4,27}, {3,4,27}, {3,4,27}, {3,4,27}, {3,4,27}, {3,4,27},
+    {3,4,27}, {3,4,27}, {3,4,27}, {3,4,27}, {3,4,27}, {3,4,27}, {11,4,1}, {11,4,1},
+    {11,4,1}, {11,4,1}, {11,4,1}, {11,4,1}, {11,4,1}, {11,4,1}, {11,4,1}, {11,4,1},
+    {11,4,1}, {11,4,1}, {11,4,1}, {11,4,1}, {11,4,1}, {11,4,1}, {8,5,3}, {8,5,3},
+    {8,5,3}, {8,5,3}, {8,5,3}, {8,5,3}, {8,5,3}, {8,5,3}, {8,6,5}, {8,6,5},
+    {8,6,5}, {8,6,5}, {1,8,106}, {3,8,45}, {9,8,6}, {6,8,30}, {2,4,34}, {2,4,34},
+    {2,4,34}, {2,4,34}, {2,4,34}, {2,4,34}, {2,4,34}, {2,4,34}, {2,4,34}, {2,4,34},
+    {2,4,34}, {2,4,34}, {2,4,34}, {2,4,34}, {2,4,34}, {2,4,34}, {3,4,21}, {3,4,21},
+    {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21},
+    {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21}, {2,2,19}, {2,2,19},
+    {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19},
+    {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19},
+    {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19},
+    {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19},
+    {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19},
+    {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19},
+    {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19},
+    {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {4,3,6}, {4,3,6},
+    {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6},
+    {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6},
+    {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6},
+    {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {4,3,6}, {3,3,13}, {3,3,13},
+    {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13},
+    {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13},
+    {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13},
+    {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13}, {3,3,13}, {1,1,35}, {12,1,0},
+    {7,8,21}, {8,8,12}, {60,8,0}, {1,8,108}, {2,7,56}, {2,7,56}, {2,7,60}, {2,7,60},
+    {7,7,17}, {7,7,17}, {2,7,62}, {2,7,62}, {7,7,14}, {7,7,14}, {2,7,57}, {2,7,57},
+    {5,7,39}, {5,7,39}, {1,7,96}, {1,7,96}, {6,7,28}, {6,7,28}, {8,7,9}, {8,7,9},
+    {56,7,0}, {56,7,0}, {8,7,10}, {8,7,10}, {5,7,27}, {5,7,27}, {44,7,0}, {44,7,0},
+    {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54},
+    {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54},
+    {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54},
+    {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54}, {1,3,54},
+    {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7},
+    {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7},
+    {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7},
+    {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7},
+    {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7},
+    {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7},
+    {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7},
+    {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7}, {3,2,7},
+    {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52},
+    {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52},
+    {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52},
+    {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52}, {1,3,52},
+    {10,7,3}, {10,7,3}, {13,7,2}, {13,7,2}, {5,6,28}, {5,6,28}, {5,6,28}, {5,6,28},
+    {2,6,48}, {2,6,48}, {2,6,48}, {2,6,48}, {53,7,0}, {53,7,0}, {1,8,105}, {67,8,0},
+    {3,4,24}, {3,4,24}, {3,4,24}, {3,4,24}, {3,4,24}, {3,4,24}, {3,4,24}, {3,4,24},
+    {3,4,24}, {3,4,24}, {3,4,24}, {3,4,24}, {3,4,24}, {3,4,24}, {3,4,24}, {3,4,24},
+    {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4},
+    {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4},
+    {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4},
+    {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4},
+    {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4},
+    {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4},
+    {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4},
+    {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4}, {4,2,4},
+    {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5},
+    {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5},
+    {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5},
+    {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5}, {3,1,5},
+    {5,4,6}, {5,4,6}, {5,4,6}, {5,4,6}, {2,6,44}, {1,6,94}, {1,6,88}, {1,6,90},
+    {5,3,4}, {5,3,4}, {5,3,4}, {5,3,4}, {5,3,4}, {5,3,4}, {5,3,4}, {5,3,4},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42}, {1,2,42},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36}, {1,1,36},
+    {1,6,91}, {3,6,36}, {1,6,87}, {35,6,0}, {3,5,29}, {3,5,29}, {9,5,2}, {9,5,2},
+    {1,4,63}, {1,4,63}, {1,4,63}, {1,4,63}, {5,5,9}, {5,5,9}, {31,5,0}, {31,5,0},
+    {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20},
+    {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20},
+    {9,3,1}, {9,3,1}, {9,3,1}, {9,3,1}, {9,3,1}, {9,3,1}, {9,3,1}, {9,3,1},
+    {9,3,1}, {9,3,1}, {9,3,1}, {9,3,1}, {9,3,1}, {9,3,1}, {9,3,1}, {9,3,1},
+    {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38}, {2,4,38},
+    {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39},
+    {2,3,29}, {2,3,29}, {2,3,29}, {2,3,29}, {2,3,29}, {2,3,29}, {2,3,29}, {2,3,29},
+    {2,3,29}, {2,3,29}, {2,3,29}, {2,3,29}, {2,3,29}, {2,3,29}, {2,3,29}, {2,3,29},
+    {1,3,51}, {1,3,51}, {1,3,51}, {1,3,51}, {1,3,51}, {1,3,51}, {1,3,51}, {1,3,51},
+    {1,3,51}, {1,3,51}, {1,3,51}, {1,3,51}, {1,3,51}, {1,3,51}, {1,3,51}, {1,3,51},
+    {1,7,100}, {4,7,35}, {1,7,99}, {19,7,1}, {2,7,50}, {48,7,0}, {5,7,32}, {2,7,59},
+    {4,7,33}, {4,7,32}, {1,6,89}, {1,6,89}, {37,6,0}, {37,6,0}, {38,6,0}, {38,6,0},
+    {3,6,41}, {3,6,41}, {4,6,23}, {4,6,23}, {6,6,13}, {6,6,13}, {5,6,20}, {5,6,20},
+    {3,4,20}, {3,4,20}, {3,4,20}, {3,4,20}, {3,4,20}, {3,4,20}, {3,4,20}, {3,4,20},
+    {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55},
+    {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55}, {1,3,55},
+    {4,5,18}, {4,5,18}, {4,5,18}, {4,5,18}, {5,6,18}, {5,6,18}, {8,6,4}, {8,6,4},
+    {25,4,0}, {25,4,0}, {25,4,0}, {25,4,0}, {25,4,0}, {25,4,0}, {25,4,0}, {25,4,0},
+    {1,1,38}, {2,1,13},
+};
+
+static const RL_VLC_ELEM coef5_rl_vlc[3420] = {
+    {1,8,24}, {1,8,24}, {512,-4,0}, {1,9,35}, {1,7,13}, {1,7,13}, {1,7,13}, {1,7,13},
+    {1,8,23}, {1,8,23}, {1,8,28}, {1,8,28}, {528,-6,0}, {592,-4,0}, {1,9,41}, {608,-3,0},
+    {1,8,25}, {1,8,25}, {2,9,4}, {616,-8,0}, {2,8,2}, {2,8,2}, {3,9,1}, {1,9,40},
+    {872,-5,0}, {1,9,36}, {1,8,26}, {1,8,26}, {904,-1,0}, {906,-8,0}, {1162,-4,0}, {1178,-7,0},
+    {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1},
+    {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1},
+    {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1},
+    {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1}, {1,4,1},
+    {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3},
+    {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3}, {1,5,3},
+    {2,7,1}, {2,7,1}, {2,7,1}, {2,7,1}, {1,7,14}, {1,7,14}, {1,7,14}, {1,7,14},
+    {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7}, {1,6,7},
+    {1,9,39}, {1,9,37}, {1306,-6,0}, {1,9,42}, {1,8,29}, {1,8,29}, {1,9,38}, {1370,-7,0},
+    {1,7,15}, {1,7,15}, {1,7,15}, {1,7,15}, {1498,-5,0}, {1530,-6,0}, {1594,-5,0}, {6,9,0},
+    {1,7,17}, {1,7,17}, {1,7,17}, {1,7,17}, {1,7,16}, {1,7,16}, {1,7,16}, {1,7,16},
+    {1,7,18}, {1,7,18}, {1,7,18}, {1,7,18}, {1626,-5,0}, {2,9,5}, {1658,-7,0}, {1786,-1,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0}, {1,2,0},
+    {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4},
+    {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4}, {1,5,4},
+    {3,6,0}, {3,6,0}, {3,6,0}, {3,6,0}, {3,6,0}, {3,6,0}, {3,6,0}, {3,6,0},
+    {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8}, {1,6,8},
+    {1788,-7,0}, {1916,-6,0}, {1,8,31}, {1,8,31}, {1,7,20}, {1,7,20}, {1,7,20}, {1,7,20},
+    {1980,-5,0}, {2012,-5,0}, {1,8,30}, {1,8,30}, {1,8,32}, {1,8,32}, {2044,-2,0}, {2048,-6,0},
+    {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9}, {1,6,9},
+    {1,7,19}, {1,7,19}, {1,7,19}, {1,7,19}, {5,8,0}, {5,8,0}, {2112,-6,0}, {2176,-5,0},
+    {2,8,3}, {2,8,3}, {1,8,33}, {1,8,33}, {1,7,21}, {1,7,21}, {1,7,21}, {1,7,21},
+    {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10}, {1,6,10},
+    {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5},
+    {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5}, {1,5,5},
+    {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0},
+    {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0},
+    {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0},
+    {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0}, {0,4,0},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2}, {1,4,2},
+    {1,9,43}, {2208,-5,0}, {2,9,6}, {2240,-5,0}, {4,7,0}, {4,7,0}, {4,7,0}, {4,7,0},
+    {1,6,11}, {1,6,11}, {1,6,11}, {1,6,11}, {1,6,11}, {1,6,11}, {1,6,11}, {1,6,11},
+    {2272,-4,0}, {2288,-9,0}, {1,8,34}, {1,8,34}, {2800,-5,0}, {2832,-3,0}, {1,9,47}, {1,9,44},
+    {1,6,12}, {1,6,12}, {1,6,12}, {1,6,12}, {1,6,12}, {1,6,12}, {1,6,12}, {1,6,12},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0}, {2,4,0},
+    {1,7,22}, {1,7,22}, {1,7,22}, {1,7,22}, {2840,-8,0}, {3096,-6,0}, {1,9,45}, {1,9,46},
+    {1,9,49}, {3160,-8,0}, {1,9,55}, {3416,-2,0}, {1,7,27}, {1,7,27}, {1,7,27}, {1,7,27},
+    {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6},
+    {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6}, {1,5,6},
+    {1,2,64}, {1,2,64}, {1,2,64}, {1,2,64}, {1,3,85}, {1,3,85}, {3,4,9}, {3,4,13},
+    {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52}, {1,1,52},
+    {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48},
+    {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48},
+    {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48},
+    {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48}, {1,1,48},
+    {3,6,41}, {1,6,209}, {1,6,167}, {2,6,59}, {1,6,134}, {1,6,150}, {1,6,170}, {4,6,15},
+    {2,4,41}, {2,4,41}, {2,4,41}, {2,4,41}, {1,5,119}, {1,5,119}, {1,5,149}, {1,5,149},
+    {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24}, {2,3,24},
+    {1,4,103}, {1,4,103}, {1,4,103}, {1,4,103}, {1,4,108}, {1,4,108}, {1,4,108}, {1,4,108},
+    {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56}, {1,1,56},
+    {1,2,71}, {1,2,71}, {1,2,71}, {1,2,71}, {1,3,80}, {1,3,80}, {4,4,4}, {1,4,101},
+    {7,1,0}, {7,1,0}, {7,1,0}, {7,1,0}, {2,2,14}, {2,2,14}, {2,3,28}, {1,3,77},
+    {5,8,16}, {1,8,187}, {5,7,9}, {5,7,9}, {1,7,203}, {1,7,203}, {1,7,158}, {1,7,158},
+    {1,7,163}, {1,7,163}, {1,7,183}, {1,7,183}, {1,7,185}, {1,7,185}, {1,7,189}, {1,7,189},
+    {6,6,3}, {6,6,3}, {6,6,3}, {6,6,3}, {24,6,0}, {24,6,0}, {24,6,0}, {24,6,0},
+    {1,6,157}, {1,6,157}, {1,6,157}, {1,6,157}, {4,6,19}, {4,6,19}, {4,6,19}, {4,6,19},
+    {1,6,155}, {1,6,155}, {1,6,155}, {1,6,155}, {1,6,200}, {1,6,200}, {1,6,200}, {1,6,200},
+    {1,5,129}, {1,5,129}, {1,5,129}, {1,5,129}, {1,5,129}, {1,5,129}, {1,5,129}, {1,5,129},
+    {9,5,1}, {9,5,1}, {9,5,1}, {9,5,1}, {9,5,1}, {9,5,1}, {9,5,1}, {9,5,1},
+    {4,5,13}, {4,5,13}, {4,5,13}, {4,5,13}, {4,5,13}, {4,5,13}, {4,5,13}, {4,5,13},
+    {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78},
+    {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78},
+    {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78},
+    {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78}, {1,3,78},
+    {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81},
+    {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81},
+    {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81},
+    {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81}, {1,3,81},
+    {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54},
+    {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54},
+    {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54},
+    {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54},
+    {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54},
+    {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54},
+    {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54},
+    {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54},
+    {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54},
+    {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54},
+    {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54},
+    {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54},
+    {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54},
+    {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54},
+    {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54},
+    {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54}, {1,1,54},
+    {1,3,76}, {1,3,76}, {1,3,76}, {1,3,76}, {1,3,94}, {1,3,94}, {1,3,94}, {1,3,94},
+    {1,5,130}, {1,5,128}, {15,4,0}, {15,4,0}, {1,3,86}, {1,3,86}, {1,3,86}, {1,3,86},
+    {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51},
+    {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51}, {1,1,51},
+    {1,1,50}, {3,1,2}, {2,4,36}, {2,4,36}, {2,4,36}, {2,4,36}, {2,4,36}, {2,4,36},
+    {2,4,36}, {2,4,36}, {2,4,36}, {2,4,36}, {2,4,36}, {2,4,36}, {2,4,36}, {2,4,36},
+    {2,4,36}, {2,4,36}, {1,7,192}, {1,7,192}, {1,8,206}, {1,8,177}, {4,6,34}, {4,6,34},
+    {4,6,34}, {4,6,34}, {1,6,174}, {1,6,174}, {1,6,174}, {1,6,174}, {2,6,70}, {2,6,70},
+    {2,6,70}, {2,6,70}, {4,6,26}, {4,6,26}, {4,6,26}, {4,6,26}, {4,6,18}, {4,6,18},
+    {4,6,18}, {4,6,18}, {1,5,142}, {1,5,142}, {1,5,142}, {1,5,142}, {1,5,142}, {1,5,142},
+    {1,5,142}, {1,5,142}, {4,5,14}, {4,5,14}, {4,5,14}, {4,5,14}, {4,5,14}, {4,5,14},
+    {4,5,14}, {4,5,14}, {2,5,49}, {2,5,49}, {2,5,49}, {2,5,49}, {2,5,49}, {2,5,49},
+    {2,5,49}, {2,5,49}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65},
+    {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65},
+    {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65},
+    {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65},
+    {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65},
+    {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65},
+    {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65},
+    {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65}, {1,2,65},
+    {1,2,65}, {1,2,65}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7}, {2,1,7},
+    {2,1,7}, {2,1,7}, {3,4,18}, {3,4,14}, {2,3,29}, {2,3,29}, {3,2,4}, {3,2,4},
+    {3,2,4}, {3,2,4}, {1,1,53}, {1,1,53}, {1,1,53}, {1,1,53}, {1,1,53}, {1,1,53},
+    {1,1,53}, {1,1,53}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69},
+    {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69},
+    {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69},
+    {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69}, {1,2,69},
+    {1,2,69}, {1,2,69}, {2,6,62}, {2,6,62}, {1,7,186}, {1,7,205}, {17,5,0}, {17,5,0},
+    {17,5,0}, {17,5,0}, {1,5,120}, {1,5,120}, {1,5,120}, {1,5,120}, {5,5,4}, {5,5,4},
+    {5,5,4}, {5,5,4}, {2,5,42}, {2,5,42}, {2,5,42}, {2,5,42}, {19,5,0}, {19,5,0},
+    {19,5,0}, {19,5,0}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106}, {1,4,106},
+    {1,4,106}, {1,4,106}, {1,4,114}, {1,4,114}, {1,4,114}, {1,4,114}, {1,4,114}, {1,4,114},
+    {1,4,114}, {1,4,114}, {20,5,0}, {20,5,0}, {20,5,0}, {20,5,0}, {1,7,204}, {1,7,202},
+    {1,7,194}, {1,7,198}, {4,7,31}, {4,7,22}, {30,6,0}, {30,6,0}, {5,6,10}, {5,6,10},
+    {2,6,53}, {2,6,53}, {1,6,153}, {1,6,153}, {2,6,63}, {2,6,63}, {4,6,17}, {4,6,17},
+    {2,6,58}, {2,6,58}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18},
+    {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18},
+    {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18},
+    {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18}, {2,2,18},
+    {2,2,18}, {2,2,18}, {1,6,148}, {25,6,0}, {2,5,56}, {2,5,56}, {3,5,25}, {3,5,25},
+    {2,5,55}, {2,5,55}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79}, {1,3,79},
+    {1,3,79}, {1,3,79}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72},
+    {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72}, {1,2,72},
+    {1,2,72}, {1,2,72}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57},
+    {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57},
+    {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57},
+    {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57}, {1,1,57},
+    {1,1,57}, {1,1,57}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6},
+    {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6}, {3,3,6},
+    {3,3,6}, {3,3,6}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23},
+    {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23}, {2,3,23},
+    {2,3,23}, {2,3,23}, {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0},
+    {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0},
+    {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0},
+    {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0}, {9,2,0},
+    {9,2,0}, {9,2,0}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20},
+    {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20},
+    {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20},
+    {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20}, {2,2,20},
+    {2,2,20}, {2,2,20}, {5,4,2}, {5,4,2}, {5,4,2}, {5,4,2}, {5,4,2}, {5,4,2},
+    {5,4,2}, {5,4,2}, {5,6,11}, {5,6,11}, {4,7,29}, {1,7,195}, {3,5,29}, {3,5,29},
+    {3,5,29}, {3,5,29}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3},
+    {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3}, {4,3,3},
+    {4,3,3}, {4,3,3}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68}, {1,2,68},
+    {1,2,68}, {1,2,68}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19}, {2,2,19},
+    {2,2,19}, {2,2,19}, {3,5,24}, {3,5,35}, {3,5,27}, {1,5,122}, {4,5,7}, {3,5,34},
+    {2,5,51}, {2,5,48}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17}, {2,2,17},
+    {2,2,17}, {2,2,17}, {3,4,19}, {3,4,19}, {3,4,19}, {3,4,19}, {7,6,3}, {5,6,5},
+    {3,6,32}, {1,6,208}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7}, {3,3,7},
+    {3,3,7}, {3,3,7}, {1,6,176}, {2,6,71}, {2,6,57}, {1,6,160}, {11,6,1}, {3,6,36},
+    {4,6,21}, {2,6,45}, {1,6,162}, {27,6,0}, {4,5,12}, {4,5,12}, {4,5,11}, {4,5,11},
+    {3,5,26}, {3,5,26}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60}, {1,1,60},
+    {1,1,60}, {1,1,60}, {2,5,50}, {2,5,52}, {7,4,1}, {7,4,1}, {1,4,102}, {1,4,102},
+    {16,4,0}, {16,4,0}, {2,3,30}, {2,3,30}, {2,3,30}, {2,3,30}, {1,3,95}, {1,3,95},
+    {1,3,95}, {1,3,95}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9}, {2,1,9},
+    {2,1,9}, {2,1,9}, {3,5,28}, {3,5,40}, {1,4,107}, {1,4,107}, {2,3,40}, {2,3,40},
+    {2,3,40}, {2,3,40}, {4,5,8}, {1,5,133}, {1,5,166}, {1,5,121}, {4,4,5}, {4,4,5},
+    {3,4,16}, {3,4,16}, {1,1,58}, {1,1,58}, {1,1,58}, {1,1,58}, {1,1,58}, {1,1,58},
+    {1,1,58}, {1,1,58}, {1,1,58}, {1,1,58}, {1,1,58}, {1,1,58}, {1,1,58}, {1,1,58},
+    {1,1,58}, {1,1,58}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62},
+    {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62},
+    {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62},
+    {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62},
+    {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62},
+    {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62},
+    {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62},
+    {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62}, {1,1,62},
+    {1,1,62}, {1,1,62}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15},
+    {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15},
+    {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15},
+    {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15}, {2,2,15},
+    {2,2,15}, {2,2,15}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39}, {2,4,39},
+    {2,4,39}, {2,4,39}, {3,7,37}, {1,7,197}, {1,7,196}, {4,7,37}, {2,7,66}, {31,7,0},
+    {38,7,0}, {36,7,0}, {6,3,1}, {6,3,1}, {6,3,1}, {6,3,1}, {6,3,1}, {6,3,1},
+    {6,3,1}, {6,3,1}, {6,3,1}, {6,3,1}, {6,3,1}, {6,3,1}, {6,3,1}, {6,3,1},
+    {6,3,1}, {6,3,1}, {4,1,1}, {1,1,59}, {14,3,0}, {14,3,0}, {14,3,0}, {14,3,0},
+    {14,3,0}, {14,3,0}, {14,3,0}, {14,3,0}, {14,3,0}, {14,3,0}, {14,3,0}, {14,3,0},
+    {14,3,0}, {14,3,0}, {14,3,0}, {14,3,0}, {1,3,93}, {1,3,93}, {1,3,93}, {1,3,93},
+    {1,3,93}, {1,3,93}, {1,3,93}, {1,3,93}, {1,3,93}, {1,3,93}, {1,3,93}, {1,3,93},
+    {1,3,93}, {1,3,93}, {1,3,93}, {1,3,93}, {12,3,0}, {12,3,0}, {12,3,0}, {12,3,0},
+    {12,3,0}, {12,3,0}, {12,3,0}, {12,3,0}, {12,3,0}, {12,3,0}, {12,3,0}, {12,3,0},
+    {12,3,0}, {12,3,0}, {12,3,0}, {12,3,0}, {33,7,0}, {4,7,25}, {1,7,175}, {2,7,65},
+    {37,6,0}, {37,6,0}, {1,6,179}, {1,6,179}, {26,6,0}, {26,6,0}, {1,6,173}, {1,6,173},
+    {1,6,159}, {1,6,159}, {1,6,172}, {1,6,172}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0},
+    {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0},
+    {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0},
+    {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0},
+    {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0},
+    {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0},
+    {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0},
+    {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0},
+    {8,1,0}, {8,1,0}, {8,1,0}, {8,1,0}, {1,2,84}, {1,2,84}, {1,2,84}, {1,2,84},
+    {1,2,84}, {1,2,84}, {1,2,84}, {1,2,84}, {1,2,84}, {1,2,84}, {1,2,84}, {1,2,84},
+    {1,2,84}, {1,2,84}, {1,2,84}, {1,2,84}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16},
+    {2,2,16}, {2,2,16}, {2,2,16}, {2,2,16}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5},
+    {3,2,5}, {3,2,5}, {3,2,5}, {3,2,5}, {12,6,1}, {1,6,201}, {1,6,212}, {1,6,213},
+    {1,5,131}, {1,5,131}, {1,5,139}, {1,5,139}, {1,5,138}, {1,5,138}, {1,5,169}, {1,5,169},
+    {1,5,140}, {1,5,140}, {4,6,16}, {3,6,31}, {1,1,61}, {1,1,61}, {1,1,61}, {1,1,61},
+    {1,1,61}, {1,1,61}, {1,1,61}, {1,1,61}, {1,1,61}, {1,1,61}, {1,1,61}, {1,1,61},
+    {1,1,61}, {1,1,61}, {1,1,61}, {1,1,61}, {1,2,74}, {1,2,74}, {1,2,74}, {1,2,74},
+    {1,2,74}, {1,2,74}, {1,2,74}, {1,2,74}, {1,4,116}, {1,4,116}, {23,5,0}, {1,5,161},
+    {2,3,34}, {2,3,34}, {2,3,34}, {2,3,34}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3},
+    {3,1,3}, {3,1,3}, {3,1,3}, {3,1,3}, {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73},
+    {1,2,73}, {1,2,73}, {1,2,73}, {1,2,73}, {10,5,1}, {2,5,43}, {1,4,117}, {1,4,117},
+    {1,3,87}, {1,3,87}, {1,3,87}, {1,3,87}, {1,1,63}, {1,1,63}, {2,2,21}, {10,2,0},
+    {3,4,17}, {3,4,17}, {3,4,17}, {3,4,17}, {1,5,147}, {1,5,147}, {3,6,38}, {1,6,156},
+    {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88}, {1,3,88},
+    {5,2,1}, {5,2,1}, {5,2,1}, {5,2,1}, {5,2,1}, {5,2,1}, {5,2,1}, {5,2,1},
+    {5,2,1}, {5,2,1}, {5,2,1}, {5,2,1}, {5,2,1}, {5,2,1}, {5,2,1}, {5,2,1},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8}, {2,1,8},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10}, {2,1,10},
+    {2,3,35}, {2,3,35}, {2,3,35}, {2,3,35}, {2,3,35}, {2,3,35}, {2,3,35}, {2,3,35},
+    {1,6,164}, {2,6,44}, {34,6,0}, {5,6,13}, {5,6,14}, {4,6,39}, {29,6,0}, {4,6,35},
+    {1,2,75}, {1,2,75}, {1,2,75}, {1,2,75}, {1,2,75}, {1,2,75}, {1,2,75}, {1,2,75},
+    {1,2,75}, {1,2,75}, {1,2,75}, {1,2,75}, {1,2,75}, {1,2,75}, {1,2,75}, {1,2,75},
+    {1,5,146}, {1,5,132}, {1,4,127}, {1,4,127}, {1,3,89}, {1,3,89}, {1,3,89}, {1,3,89},
+    {1,3,97}, {1,3,97}, {1,3,97}, {1,3,97}, {2,3,31}, {2,3,31}, {2,3,31}, {2,3,31},
+    {1,3,109}, {1,3,109}, {1,3,109}, {1,3,109}, {1,3,113}, {1,3,113}, {1,3,113}, {1,3,113},
+    {1,3,105}, {1,3,105}, {1,3,105}, {1,3,105}, {1,3,110}, {1,3,110}, {1,3,110}, {1,3,110},
+    {1,3,96}, {1,3,96}, {1,3,96}, {1,3,96}, {1,3,90}, {1,3,90}, {1,3,90}, {1,3,90},
+    {1,5,144}, {2,5,46}, {3,4,15}, {3,4,15}, {3,4,20}, {3,4,20}, {21,5,0}, {3,5,30},
+    {2,1,11}, {2,1,11}, {2,1,11}, {2,1,11}, {2,1,11}, {2,1,11}, {2,1,11}, {2,1,11},
+    {2,1,11}, {2,1,11}, {2,1,11}, {2,1,11}, {2,1,11}, {2,1,11}, {2,1,11}, {2,1,11},
+    {1,2,82}, {1,2,82}, {1,2,82}, {1,2,82}, {1,2,82}, {1,2,82}, {1,2,82}, {1,2,82},
+    {1,5,143}, {1,5,171}, {1,5,168}, {22,5,0}, {1,4,115}, {1,4,115}, {1,4,118}, {1,4,118},
+    {0,1,1}, {0,1,1}, {0,1,1}, {0,1,1}, {0,1,1}, {0,1,1}, {0,1,1}, {0,1,1},
+    {0,1,1}, {0,1,1}, {0,1,1}, {0,1,1}, {0,1,1}, {0,1,1}, {0,1,1}, {0,1,1},
+    {1,2,83}, {1,2,83}, {1,2,83}, {1,2,83}, {3,3,12}, {3,3,12}, {2,3,32}, {2,3,32},
+    {5,4,3}, {2,4,37}, {1,3,99}, {1,3,99}, {1,3,100}, {1,3,100}, {3,3,10}, {3,3,10},
+    {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8},
+    {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8},
+    {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8},
+    {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8},
+    {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8},
+    {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8},
+    {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8},
+    {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8}, {3,3,8},
+    {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111},
+    {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111},
+    {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111},
+    {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111},
+    {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111},
+    {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111},
+    {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111},
+    {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111}, {1,3,111},
+    {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33},
+    {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33},
+    {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33},
+    {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33},
+    {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33},
+    {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33},
+    {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33},
+    {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33}, {2,3,33},
+    {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98},
+    {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98},
+    {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98},
+    {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98},
+    {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98},
+    {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98},
+    {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98},
+    {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98}, {1,3,98},
+    {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27},
+    {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27},
+    {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27},
+    {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27},
+    {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27},
+    {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27},
+    {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27},
+    {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27},
+    {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27},
+    {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27},
+    {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27},
+    {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27},
+    {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27},
+    {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27},
+    {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27},
+    {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27}, {2,2,27},
+    {1,8,193}, {1,8,193}, {4,9,32}, {2,9,67}, {4,7,36}, {4,7,36}, {4,7,36}, {4,7,36},
+    {1,7,211}, {1,7,211}, {1,7,211}, {1,7,211}, {1,7,184}, {1,7,184}, {1,7,184}, {1,7,184},
+    {1,7,178}, {1,7,178}, {1,7,178}, {1,7,178}, {5,7,7}, {5,7,7}, {5,7,7}, {5,7,7},
+    {35,7,0}, {35,7,0}, {35,7,0}, {35,7,0}, {40,7,0}, {40,7,0}, {40,7,0}, {40,7,0},
+    {1,6,180}, {1,6,180}, {1,6,180}, {1,6,180}, {1,6,180}, {1,6,180}, {1,6,180}, {1,6,180},
+    {1,6,154}, {1,6,154}, {1,6,154}, {1,6,154}, {1,6,154}, {1,6,154}, {1,6,154}, {1,6,154},
+    {4,6,30}, {4,6,30}, {4,6,30}, {4,6,30}, {4,6,30}, {4,6,30}, {4,6,30}, {4,6,30},
+    {4,6,24}, {4,6,24}, {4,6,24}, {4,6,24}, {4,6,24}, {4,6,24}, {4,6,24}, {4,6,24},
+    {2,6,69}, {2,6,69}, {2,6,69}, {2,6,69}, {2,6,69}, {2,6,69}, {2,6,69}, {2,6,69},
+    {15,6,1}, {15,6,1}, {15,6,1}, {15,6,1}, {15,6,1}, {15,6,1}, {15,6,1}, {15,6,1},
+    {4,6,27}, {4,6,27}, {4,6,27}, {4,6,27}, {4,6,27}, {4,6,27}, {4,6,27}, {4,6,27},
+    {5,6,17}, {5,6,17}, {5,6,17}, {5,6,17}, {5,6,17}, {5,6,17}, {5,6,17}, {5,6,17},
+    {1,6,188}, {1,6,188}, {1,6,188}, {1,6,188}, {1,6,188}, {1,6,188}, {1,6,188}, {1,6,188},
+    {5,6,12}, {5,6,12}, {5,6,12}, {5,6,12}, {5,6,12}, {5,6,12}, {5,6,12}, {5,6,12},
+    {5,6,15}, {5,6,15}, {5,6,15}, {5,6,15}, {5,6,15}, {5,6,15}, {5,6,15}, {5,6,15},
+    {2,6,64}, {2,6,64}, {2,6,64}, {2,6,64}, {2,6,64}, {2,6,64}, {2,6,64}, {2,6,64},
+    {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12},
+    {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12}, {2,1,12},
+    {3,5,23}, {5,5,6}, {4,5,20}, {7,5,2}, {4,5,10}, {1,5,137}, {2,4,38}, {2,4,38},
+    {1,3,91}, {1,3,91}, {1,3,91}, {1,3,91}, {13,3,0}, {13,3,0}, {13,3,0}, {13,3,0},
+    {1,3,92}, {1,3,112}, {4,2,2}, {4,2,2}, {2,1,13}, {2,1,13}, {2,1,13}, {2,1,13},
+    {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6},
+    {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6}, {4,4,6},
+    {5,6,8}, {5,6,8}, {5,6,8}, {5,6,8}, {32,7,0}, {32,7,0}, {39,8,0}, {4,8,33},
+    {2,5,61}, {2,5,61}, {2,5,61}, {2,5,61}, {2,5,61}, {2,5,61}, {2,5,61}, {2,5,61},
+    {1,5,145}, {1,5,145}, {1,5,145}, {1,5,145}, {1,5,145}, {1,5,145}, {1,5,145}, {1,5,145},
+    {6,5,2}, {6,5,2}, {6,5,2}, {6,5,2}, {6,5,2}, {6,5,2}, {6,5,2}, {6,5,2},
+    {1,5,136}, {1,5,136}, {1,5,136}, {1,5,136}, {1,5,136}, {1,5,136}, {1,5,136}, {1,5,136},
+    {28,5,0}, {28,5,0}, {28,5,0}, {28,5,0}, {28,5,0}, {28,5,0}, {28,5,0}, {28,5,0},
+    {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21},
+    {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21}, {3,4,21},
+    {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123},
+    {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123}, {1,4,123},
+    {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1},
+    {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1}, {8,4,1},
+    {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9}, {4,5,9},
+    {1,6,152}, {1,6,152}, {1,6,152}, {1,6,152}, {1,6,199}, {1,6,199}, {1,6,199}, {1,6,199},
+    {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104},
+    {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104},
+    {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104},
+    {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104}, {1,3,104},
+    {1,4,141}, {1,4,141}, {1,4,141}, {1,4,141}, {1,4,141}, {1,4,141}, {1,4,141}, {1,4,141},
+    {1,4,141}, {1,4,141}, {1,4,141}, {1,4,141}, {1,4,141}, {1,4,141}, {1,4,141}, {1,4,141},
+    {1,4,125}, {1,4,125}, {1,4,125}, {1,4,125}, {1,4,125}, {1,4,125}, {1,4,125}, {1,4,125},
+    {1,4,125}, {1,4,125}, {1,4,125}, {1,4,125}, {1,4,125}, {1,4,125}, {1,4,125}, {1,4,125},
+    {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26},
+    {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26},
+    {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26},
+    {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26},
+    {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26},
+    {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26},
+    {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26},
+    {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26}, {2,2,26},
+    {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70},
+    {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70},
+    {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70},
+    {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70}, {1,1,70},
+    {1,4,124}, {1,4,124}, {1,4,124}, {1,4,124}, {1,4,126}, {1,4,126}, {1,4,126}, {1,4,126},
+    {3,6,33}, {1,6,182}, {1,6,210}, {1,6,181}, {1,6,207}, {4,6,28}, {1,5,151}, {1,5,151},
+    {1,5,190}, {1,5,190}, {2,5,60}, {2,5,60}, {2,5,54}, {2,5,54}, {1,5,165}, {1,5,165},
+    {1,5,135}, {1,5,135}, {3,5,39}, {3,5,39}, {3,4,22}, {3,4,22}, {3,4,22}, {3,4,22},
+    {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25},
+    {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25},
+    {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25},
+    {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25},
+    {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25},
+    {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25},
+    {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25},
+    {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25}, {2,2,25},
+    {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0},
+    {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0}, {18,4,0},
+    {2,5,47}, {2,5,47}, {2,5,47}, {2,5,47}, {2,5,47}, {2,5,47}, {2,5,47}, {2,5,47},
+    {4,6,23}, {4,6,23}, {4,6,23}, {4,6,23}, {4,8,38}, {2,8,68}, {1,7,191}, {1,7,191},
+    {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11},
+    {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11},
+    {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11},
+    {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11}, {3,3,11},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67}, {1,1,67},
+    {11,2,0}, {2,2,22}, {1,1,66}, {1,1,66},
+};
+
+static const RL_VLC_ELEM *const coef_rl_vlcs[6] = {
+    coef0_rl_vlc,
+    coef1_rl_vlc,
+    coef2_rl_vlc,
+    coef3_rl_vlc,
+    coef4_rl_vlc,
+    coef5_rl_vlc,
+};
+
+}
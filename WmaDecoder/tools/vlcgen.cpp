@@ -0,0 +1,158 @@
+/*
+ * Generate the WMA VLC decoding tables
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * @file vlcgen.cpp
+ * Build the VLC decoding tables of the codes in wmadata.h with
+ * init_vlc() and print them as Wma_wmavlc.h, so that the decoder does
+ * not have to build them when it is opened. It is not part of the
+ * library. To regenerate the tables, from the WmaDecoder directory:
+ *
+ *   g++ -include stdint.h -I. tools/vlcgen.cpp Wma_common.cpp Wma_mem.cpp \
+ *       Wma_utils.cpp Wma_dsputil*.cpp -o vlcgen
+ *   ./vlcgen > Wma_wmavlc.h
+ */
+#include "Wma_Decoder.h"
+#include "Wma_wmadata.h"
+
+using namespace WMADECODER_NAMESPACE;
+
+static void print_vlc(const char *name, const VLC *vlc)
+{
+    int i;
+
+    printf("static const VLC_TYPE %s[%d][2] = {\n", name, vlc->table_size);
+    for(i = 0; i < vlc->table_size; i++) {
+        if ((i & 7) == 0)
+            printf("   ");
+        printf(" {%d,%d},", vlc->table[i][0], vlc->table[i][1]);
+        if ((i & 7) == 7 || i == vlc->table_size - 1)
+            printf("\n");
+    }
+    printf("};\n\n");
+}
+
+/**
+ * Print the run/level table of a coefficient VLC, so that a single
+ * lookup gives both. Escape, EOB and invalid codes have a zero level
+ * and COEF_ESCAPE, COEF_EOB or COEF_INVALID as run.
+ */
+static int print_coef_vlc(const char *name, const CoefVLCTable *vlc_table)
+{
+    int n = vlc_table->n;
+    const uint16_t *levels_table = vlc_table->levels;
+    uint16_t *run_table, *level_table;
+    VLC vlc;
+    const uint16_t *p;
+    int i, l, j, level, run, code, len;
+
+    if (init_vlc(&vlc, COEF_VLC_BITS, n, vlc_table->huffbits, 1, 1,
+                 vlc_table->huffcodes, 4, 4) < 0)
+        return -1;
+
+    run_table = (uint16_t*)av_malloc(n * sizeof(uint16_t));
+    level_table = (uint16_t*)av_malloc(n * sizeof(uint16_t));
+    p = levels_table;
+    i = 2;
+    level = 1;
+    while (i < n) {
+        l = *p++;
+        for(j=0;j<l;j++) {
+            run_table[i] = j;
+            level_table[i] = level;
+            i++;
+        }
+        level++;
+    }
+
+    printf("static const RL_VLC_ELEM %s[%d] = {\n", name, vlc.table_size);
+    for(i = 0; i < vlc.table_size; i++) {
+        code = vlc.table[i][0];
+        len = vlc.table[i][1];
+        if (len == 0) {
+            level = 0;
+            run = COEF_INVALID;
+        } else if (len < 0) {
+            /* index of the subtable */
+            level = code;
+            run = 0;
+        } else if (code < 2) {
+            level = 0;
+            run = code ? COEF_EOB : COEF_ESCAPE;
+        } else {
+            level = level_table[code];
+            run = run_table[code];
+        }
+        if ((i & 7) == 0)
+            printf("   ");
+        printf(" {%d,%d,%d},", level, len, run);
+        if ((i & 7) == 7 || i == vlc.table_size - 1)
+            printf("\n");
+    }
+    printf("};\n\n");
+
+    free_vlc(&vlc);
+    av_free(run_table);
+    av_free(level_table);
+    return 0;
+}
+
+int main(void)
+{
+    VLC vlc;
+    char name[32];
+    int i;
+
+    printf("/**\n"
+           " * @file wmavlc.h\n"
+           " * WMA VLC decoding tables, generated by tools/vlcgen.cpp from the\n"
+           " * codes in wmadata.h. Do not edit.\n"
+           " */\n"
+           "\n"
+           "#include \"Wma_Decoder.h\"\n"
+           "\n"
+           "namespace WMADECODER_NAMESPACE\n"
+           "{\n"
+           "\n");
+
+    if (init_vlc(&vlc, EXP_VLC_BITS, sizeof(scale_huffbits),
+                 scale_huffbits, 1, 1, scale_huffcodes, 4, 4) < 0)
+        return 1;
+    print_vlc("scale_vlc_table", &vlc);
+    free_vlc(&vlc);
+
+    if (init_vlc(&vlc, HGAIN_VLC_BITS, sizeof(hgain_huffbits),
+                 hgain_huffbits, 1, 1, hgain_huffcodes, 2, 2) < 0)
+        return 1;
+    print_vlc("hgain_vlc_table", &vlc);
+    free_vlc(&vlc);
+
+    for(i = 0; i < 6; i++) {
+        snprintf(name, sizeof(name), "coef%d_rl_vlc", i);
+        if (print_coef_vlc(name, &coef_vlcs[i]) < 0)
+            return 1;
+    }
+
+    printf("static const RL_VLC_ELEM *const coef_rl_vlcs[6] = {\n");
+    for(i = 0; i < 6; i++)
+        printf("    coef%d_rl_vlc,\n", i);
+    printf("};\n"
+           "\n"
+           "}\n");
+    return 0;
+}
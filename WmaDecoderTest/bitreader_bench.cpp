@@ -0,0 +1,268 @@
+/*
+ * Compare the cached and the plain ALT bitstream readers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * @file bitreader_bench.cpp
+ * Time get_bits, get_bits_long and GET_VLC with the 64 bit cached
+ * reader and with the plain ALT reader, and check that both return the
+ * values that were written and stop at the same bit positions. The
+ * VLC codes are the exponent codes of the decoder. The readers are
+ * selected when Wma_common.h is included, so this file is built twice:
+ * once with DISABLE_CACHED_BITSTREAM_READER for the ALT reader, and once
+ * as is for the cached reader and main(). It is not part of the
+ * library. From the WmaDecoder directory:
+ *
+ *   g++ -O2 -include stdint.h -I. -DDISABLE_CACHED_BITSTREAM_READER \
+ *       -c ../WmaDecoderTest/bitreader_bench.cpp -o bitreader_alt.o
+ *   g++ -O2 -include stdint.h -I. ../WmaDecoderTest/bitreader_bench.cpp \
+ *       bitreader_alt.o -o bitreader_bench
+ *   ./bitreader_bench
+ *
+ * The exit status is 0 if both readers read everything right.
+ */
+#include <sys/time.h>
+#include "Wma_Decoder.h"
+#include "Wma_wmadata.h"
+#include "Wma_wmavlc.h"
+
+using namespace WMADECODER_NAMESPACE;
+
+#define NB_FIELDS (1 << 16)
+/* enough for NB_FIELDS fields of up to 32 bits */
+#define BUF_SIZE (NB_FIELDS * 4)
+
+#ifdef DISABLE_CACHED_BITSTREAM_READER
+#define READER(name) name##_alt
+#else
+#define READER(name) name##_cached
+#endif
+
+/* read nb_fields fields of the given widths, 1 to 17 bits with get_bits
+   or 1 to 32 bits with get_bits_long */
+void READER(read_fields)(const uint8_t *buf, int size_in_bits,
+                         const int *widths, int nb_fields, int use_long,
+                         uint32_t *values, int *positions);
+/* read nb_codes exponent VLC codes with GET_VLC, in a single reader
+   opening like decode_exp_vlc() */
+void READER(read_vlcs)(const uint8_t *buf, int size_in_bits, int nb_codes,
+                       int *codes, int *positions);
+
+/* get_bits_long() of Wma_common.cpp, which the library builds with the
+   cached reader only */
+static unsigned int bench_get_bits_long(GetBitContext *s, int n)
+{
+    if (n <= MIN_CACHE_BITS)
+        return get_bits(s, n);
+    else {
+        int ret = get_bits(s, 16) << (n - 16);
+        return ret | get_bits(s, n - 16);
+    }
+}
+
+void READER(read_fields)(const uint8_t *buf, int size_in_bits,
+                         const int *widths, int nb_fields, int use_long,
+                         uint32_t *values, int *positions)
+{
+    GetBitContext gb;
+    int i;
+
+    init_get_bits(&gb, buf, size_in_bits);
+    if (use_long) {
+        for(i = 0; i < nb_fields; i++) {
+            values[i] = bench_get_bits_long(&gb, widths[i]);
+            positions[i] = get_bits_count(&gb);
+        }
+    } else {
+        for(i = 0; i < nb_fields; i++) {
+            values[i] = get_bits(&gb, widths[i]);
+            positions[i] = get_bits_count(&gb);
+        }
+    }
+}
+
+void READER(read_vlcs)(const uint8_t *buf, int size_in_bits, int nb_codes,
+                       int *codes, int *positions)
+{
+    GetBitContext gb;
+    const VLC_TYPE (*table)[2] = scale_vlc_table;
+    int i, code;
+
+    init_get_bits(&gb, buf, size_in_bits);
+    {
+        OPEN_READER(re, &gb)
+        for(i = 0; i < nb_codes; i++) {
+            UPDATE_CACHE(re, &gb)
+            GET_VLC(code, re, &gb, table, EXP_VLC_BITS, 3)
+            codes[i] = code;
+            /* both readers keep the bit position in re_index */
+            positions[i] = re_index;
+        }
+        CLOSE_READER(re, &gb)
+    }
+}
+
+#ifndef DISABLE_CACHED_BITSTREAM_READER
+
+#define RUNS 200
+
+void read_fields_alt(const uint8_t *buf, int size_in_bits,
+                     const int *widths, int nb_fields, int use_long,
+                     uint32_t *values, int *positions);
+void read_vlcs_alt(const uint8_t *buf, int size_in_bits, int nb_codes,
+                   int *codes, int *positions);
+
+static uint8_t buf[BUF_SIZE + FF_INPUT_BUFFER_PADDING_SIZE];
+static int widths[NB_FIELDS];
+static uint32_t written[NB_FIELDS];
+static uint32_t values[2][NB_FIELDS];
+static int positions[2][NB_FIELDS];
+static int end_positions[NB_FIELDS];
+
+static int64_t gettime(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+/* msb first, like the WMA bitstream */
+static int write_bits(int pos, int n, uint32_t value)
+{
+    int i;
+
+    for(i = n - 1; i >= 0; i--) {
+        if ((value >> i) & 1)
+            buf[pos >> 3] |= 0x80 >> (pos & 7);
+        pos++;
+    }
+    return pos;
+}
+
+/* fill buf with nb random fields of 1 to max_width bits */
+static int make_fields(int max_width)
+{
+    int i, pos = 0;
+
+    memset(buf, 0, sizeof(buf));
+    for(i = 0; i < NB_FIELDS; i++) {
+        widths[i] = 1 + rand() % max_width;
+        written[i] = ((uint32_t)rand() << 16 ^ rand()) &
+                     (0xffffffffU >> (32 - widths[i]));
+        pos = write_bits(pos, widths[i], written[i]);
+        end_positions[i] = pos;
+    }
+    return pos;
+}
+
+/* fill buf with NB_FIELDS random exponent codes */
+static int make_vlcs(void)
+{
+    int i, pos = 0;
+
+    memset(buf, 0, sizeof(buf));
+    for(i = 0; i < NB_FIELDS; i++) {
+        written[i] = rand() % sizeof(scale_huffbits);
+        pos = write_bits(pos, scale_huffbits[written[i]],
+                         scale_huffcodes[written[i]]);
+        end_positions[i] = pos;
+    }
+    return pos;
+}
+
+/* return the number of fields either reader got wrong */
+static int check(const char *name, int nb)
+{
+    int r, i, fails = 0;
+
+    for(r = 0; r < 2; r++) {
+        for(i = 0; i < nb; i++) {
+            if (values[r][i] != written[i] ||
+                positions[r][i] != end_positions[i]) {
+                if (!fails)
+                    printf("%s: %s reader, field %d: read %u at %d, "
+                           "expected %u at %d\n", name,
+                           r ? "cached" : "alt", i, values[r][i],
+                           positions[r][i], written[i], end_positions[i]);
+                fails++;
+            }
+        }
+    }
+    return fails;
+}
+
+static void print_times(const char *name, int64_t t_alt, int64_t t_cached)
+{
+    printf("%-13s alt %6.2f ns/field  cached %6.2f ns/field  %+.0f%%\n",
+           name, t_alt * 1000.0 / NB_FIELDS, t_cached * 1000.0 / NB_FIELDS,
+           (double)(t_alt - t_cached) * 100 / t_alt);
+}
+
+int main(void)
+{
+    int64_t t, t_alt, t_cached;
+    int size, use_long, r, fails = 0;
+
+#ifndef CACHED_BITSTREAM_READER
+    printf("the cached reader is not enabled on this target, "
+           "both readers are the ALT one\n");
+#endif
+    srand(1);
+
+    for(use_long = 0; use_long < 2; use_long++) {
+        size = make_fields(use_long ? 32 : 17);
+        t_alt = t_cached = INT64_MAX;
+        for(r = 0; r < RUNS; r++) {
+            t = gettime();
+            read_fields_alt(buf, size, widths, NB_FIELDS, use_long,
+                            values[0], positions[0]);
+            t = gettime() - t;
+            if (t < t_alt)
+                t_alt = t;
+            t = gettime();
+            read_fields_cached(buf, size, widths, NB_FIELDS, use_long,
+                               values[1], positions[1]);
+            t = gettime() - t;
+            if (t < t_cached)
+                t_cached = t;
+        }
+        fails += check(use_long ? "get_bits_long" : "get_bits", NB_FIELDS);
+        print_times(use_long ? "get_bits_long" : "get_bits", t_alt, t_cached);
+    }
+
+    size = make_vlcs();
+    t_alt = t_cached = INT64_MAX;
+    for(r = 0; r < RUNS; r++) {
+        t = gettime();
+        read_vlcs_alt(buf, size, NB_FIELDS, (int *)values[0], positions[0]);
+        t = gettime() - t;
+        if (t < t_alt)
+            t_alt = t;
+        t = gettime();
+        read_vlcs_cached(buf, size, NB_FIELDS, (int *)values[1], positions[1]);
+        t = gettime() - t;
+        if (t < t_cached)
+            t_cached = t;
+    }
+    fails += check("GET_VLC", NB_FIELDS);
+    print_times("GET_VLC", t_alt, t_cached);
+
+    printf("%s\n", fails ? "FAILED" : "OK");
+    return fails != 0;
+}
+
+#endif /* DISABLE_CACHED_BITSTREAM_READER */
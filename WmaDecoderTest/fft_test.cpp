@@ -0,0 +1,202 @@
+/*
+ * Check the FFT and the MDCTs against direct transforms
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * @file fft_test.cpp
+ * Compare the C split radix FFT (fft_calc, forward and inverse) with a
+ * direct DFT for every size from 2^2 to 2^FFT_MAX_BITS, and the inverse
+ * and forward MDCTs built on it (ff_imdct_calc and ff_mdct_calc) with
+ * the direct MDCT formulas for the matching sizes, 16 to 4096 points.
+ * The references are computed in double precision. It is not part of
+ * the library. From the WmaDecoder directory:
+ *
+ *   g++ -O2 -include stdint.h -I. ../WmaDecoderTest/fft_test.cpp \
+ *       Wma_common.cpp Wma_mem.cpp Wma_utils.cpp Wma_dsputil*.cpp \
+ *       Wma_fft*.cpp Wma_mdct.cpp -o fft_test
+ *   ./fft_test
+ *
+ * The exit status is 0 if all the outputs are within MAX_ERROR of the
+ * references.
+ */
+#include "Wma_Decoder.h"
+#include "Wma_dsputil.h"
+
+using namespace WMADECODER_NAMESPACE;
+
+namespace WMADECODER_NAMESPACE {
+extern int fft_inits(FFTContext *s, int nbits, int inverse, int mm_flags);
+extern void fft_end(FFTContext *s);
+extern void fft_calc(FFTContext *s, FFTComplex *out, const FFTComplex *in);
+}
+
+/* largest error allowed, relative to the largest magnitude of the
+   reference output. The float transforms are at about 1e-7 */
+#define MAX_ERROR 1e-5
+
+#define MIN_BITS 2
+#define MAX_SIZE (4 << FFT_MAX_BITS)
+
+/* cos(2 * pi * i / (4 * MAX_SIZE)) */
+static double cos_tab[4 * MAX_SIZE];
+
+static FFTSample in[MAX_SIZE], out[MAX_SIZE];
+static double ref[MAX_SIZE];
+
+static double cos_4n(int i, int n)
+{
+    return cos_tab[(i & (4 * n - 1)) * (MAX_SIZE / n)];
+}
+
+/* largest error of out relative to the largest magnitude of ref */
+static double rel_error(const FFTSample *out, const double *ref, int n)
+{
+    double err = 0, max = 0;
+    int i;
+
+    for(i = 0; i < n; i++) {
+        if (fabs(ref[i]) > max)
+            max = fabs(ref[i]);
+        if (!(fabs(out[i] - ref[i]) <= err))
+            err = fabs(out[i] - ref[i]);
+    }
+    return err / max;
+}
+
+static int report(const char *name, int n, double err)
+{
+    printf("%-5s %5d: max relative error %g\n", name, n, err);
+    return !(err <= MAX_ERROR);
+}
+
+/* X[k] = sum x[j] exp(-+2 * i * pi * j * k / n) */
+static int test_fft(int nbits, int inverse)
+{
+    FFTContext s;
+    FFTComplex *x = (FFTComplex *)in;
+    FFTComplex *z = (FFTComplex *)out;
+    double re, im, c, si;
+    int n = 1 << nbits;
+    int j, k;
+
+    if (fft_inits(&s, nbits, inverse, 0) < 0) {
+        printf("fft %d: init failed\n", n);
+        return 1;
+    }
+    fft_calc(&s, z, x);
+    fft_end(&s);
+
+    for(k = 0; k < n; k++) {
+        re = im = 0;
+        for(j = 0; j < n; j++) {
+            c = cos_4n(4 * j * k, n);
+            si = cos_4n(4 * j * k - n, n);
+            if (!inverse)
+                si = -si;
+            re += x[j].re * c - x[j].im * si;
+            im += x[j].re * si + x[j].im * c;
+        }
+        ref[2 * k] = re;
+        ref[2 * k + 1] = im;
+    }
+    return report(inverse ? "ifft" : "fft", n, rel_error(out, ref, 2 * n));
+}
+
+/* the phase of the MDCT basis functions: the cosine of
+   2 * pi / n * (j + 1/2 + n/4) * (k + 1/2), in units of 2 * pi / 4n */
+static int mdct_phase(int j, int k, int n)
+{
+    return (2 * j + 1 + n / 2) * (2 * k + 1);
+}
+
+/* y[j] = -sum x[k] cos(2 * pi / n * (j + 1/2 + n/4) * (k + 1/2)),
+   n outputs from n/2 inputs */
+static int test_imdct(int nbits)
+{
+    MDCTContext m;
+    FFTSample *tmp;
+    double sum;
+    int n = 1 << nbits;
+    int j, k;
+
+    tmp = (FFTSample*)av_malloc(n / 2 * sizeof(FFTSample));
+    if (!tmp || ff_mdct_init(&m, nbits, 1, 0) < 0) {
+        printf("imdct %d: init failed\n", n);
+        return 1;
+    }
+    ff_imdct_calc(&m, out, in, tmp);
+    ff_mdct_end(&m);
+    av_free(tmp);
+
+    for(j = 0; j < n; j++) {
+        sum = 0;
+        for(k = 0; k < n / 2; k++)
+            sum -= in[k] * cos_4n(mdct_phase(j, k, n), n);
+        ref[j] = sum;
+    }
+    return report("imdct", n, rel_error(out, ref, n));
+}
+
+/* X[k] = sum x[j] cos(2 * pi / n * (j + 1/2 + n/4) * (k + 1/2)),
+   n/2 outputs from n inputs */
+static int test_mdct(int nbits)
+{
+    MDCTContext m;
+    FFTSample *tmp;
+    double sum;
+    int n = 1 << nbits;
+    int j, k;
+
+    tmp = (FFTSample*)av_malloc(n / 2 * sizeof(FFTSample));
+    if (!tmp || ff_mdct_init(&m, nbits, 0, 0) < 0) {
+        printf("mdct %d: init failed\n", n);
+        return 1;
+    }
+    ff_mdct_calc(&m, out, in, tmp);
+    ff_mdct_end(&m);
+    av_free(tmp);
+
+    for(k = 0; k < n / 2; k++) {
+        sum = 0;
+        for(j = 0; j < n; j++)
+            sum += in[j] * cos_4n(mdct_phase(j, k, n), n);
+        ref[k] = sum;
+    }
+    return report("mdct", n, rel_error(out, ref, n / 2));
+}
+
+int main(void)
+{
+    int i, nbits, fails = 0;
+
+    for(i = 0; i < 4 * MAX_SIZE; i++)
+        cos_tab[i] = cos(2 * M_PI * i / (4 * MAX_SIZE));
+
+    srand(1);
+    for(i = 0; i < MAX_SIZE; i++)
+        in[i] = 2.0 * rand() / RAND_MAX - 1.0;
+
+    for(nbits = MIN_BITS; nbits <= FFT_MAX_BITS; nbits++) {
+        fails += test_fft(nbits, 0);
+        fails += test_fft(nbits, 1);
+        fails += test_imdct(nbits + 2);
+        fails += test_mdct(nbits + 2);
+    }
+
+    printf("%s\n", fails ? "FAILED" : "OK");
+    return fails != 0;
+}
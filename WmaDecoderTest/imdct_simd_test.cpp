@@ -0,0 +1,150 @@
+/*
+ * Check the SIMD inverse MDCTs against the C version
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * @file imdct_simd_test.cpp
+ * Compare the inverse MDCTs of the SSE2 and AVX2 paths, mono and
+ * stereo (ff_imdct_calc and ff_imdct_calc2, with and without mid/side),
+ * with the C path for all the WMA block sizes, 256 to 4096 points. The
+ * path is selected with the mm_flags given to ff_mdct_init(); the ones
+ * mm_support() does not report are skipped. It is not part of the
+ * library. From the WmaDecoder directory:
+ *
+ *   g++ -O2 -include stdint.h -I. ../WmaDecoderTest/imdct_simd_test.cpp \
+ *       Wma_common.cpp Wma_mem.cpp Wma_utils.cpp Wma_dsputil*.cpp \
+ *       Wma_fft*.cpp Wma_mdct.cpp -o imdct_simd_test
+ *   ./imdct_simd_test
+ *
+ * The exit status is 0 if all the outputs are within MAX_ERROR of the C
+ * ones.
+ */
+#if defined(__SSE2__)
+/* must come before Wma_common.h, which redefines malloc and free */
+#include <immintrin.h>
+#endif
+#include "Wma_Decoder.h"
+#include "Wma_dsputil.h"
+
+using namespace WMADECODER_NAMESPACE;
+
+/* largest absolute difference allowed with the C output. The inputs are
+   in [-1, 1], so the outputs of the longest blocks are about 30 */
+#define MAX_ERROR 1e-4
+
+#define MIN_BITS 8
+#define MAX_BITS 12
+
+static const struct {
+    const char *name;
+    int mm_flags;
+} paths[] = {
+    { "sse2", MM_SSE2 },
+    { "avx2", MM_SSE2 | MM_AVX2 },
+};
+
+static double max_diff(const FFTSample *a, const FFTSample *b, int n)
+{
+    double d, m = 0;
+    int i;
+
+    for(i = 0; i < n; i++) {
+        d = fabs((double)a[i] - b[i]);
+        if (!(d <= m))
+            m = d;
+    }
+    return m;
+}
+
+/* return the number of failed checks at this size */
+static int test_size(int nbits, const FFTSample *in0, const FFTSample *in1)
+{
+    MDCTContext ref, mdct;
+    FFTSample *out_ref, *out, *tmp;
+    double err;
+    int n = 1 << nbits;
+    int i, ms, fails = 0;
+
+    out_ref = (FFTSample*)av_malloc(2 * n * sizeof(FFTSample));
+    out = (FFTSample*)av_malloc(2 * n * sizeof(FFTSample));
+    tmp = (FFTSample*)av_malloc(n * sizeof(FFTSample));
+    if (!out_ref || !out || !tmp || ff_mdct_init(&ref, nbits, 1, 0) < 0) {
+        printf("%5d: out of memory\n", n);
+        return 1;
+    }
+
+    for(i = 0; i < (int)(sizeof(paths) / sizeof(paths[0])); i++) {
+        if ((mm_support() & paths[i].mm_flags) != paths[i].mm_flags) {
+            printf("%5d %-4s: not supported, skipped\n", n, paths[i].name);
+            continue;
+        }
+        if (ff_mdct_init(&mdct, nbits, 1, paths[i].mm_flags) < 0) {
+            printf("%5d %-4s: init failed\n", n, paths[i].name);
+            fails++;
+            continue;
+        }
+
+        ff_imdct_calc(&ref, out_ref, in0, tmp);
+        ff_imdct_calc(&mdct, out, in0, tmp);
+        err = max_diff(out_ref, out, n);
+        printf("%5d %-4s %-9s max error %g\n", n, paths[i].name, "mono", err);
+        if (!(err <= MAX_ERROR))
+            fails++;
+
+        for(ms = 0; ms < 2; ms++) {
+            ff_imdct_calc2(&ref, out_ref, in0, in1, ms, tmp);
+            ff_imdct_calc2(&mdct, out, in0, in1, ms, tmp);
+            err = max_diff(out_ref, out, 2 * n);
+            printf("%5d %-4s %-9s max error %g\n", n, paths[i].name,
+                   ms ? "stereo ms" : "stereo", err);
+            if (!(err <= MAX_ERROR))
+                fails++;
+        }
+        ff_mdct_end(&mdct);
+    }
+
+    ff_mdct_end(&ref);
+    av_free(out_ref);
+    av_free(out);
+    av_free(tmp);
+    return fails;
+}
+
+int main(void)
+{
+    FFTSample *in0, *in1;
+    int i, nbits, fails = 0;
+
+    in0 = (FFTSample*)av_malloc((1 << (MAX_BITS - 1)) * sizeof(FFTSample));
+    in1 = (FFTSample*)av_malloc((1 << (MAX_BITS - 1)) * sizeof(FFTSample));
+    if (!in0 || !in1)
+        return 1;
+
+    srand(1);
+    for(nbits = MIN_BITS; nbits <= MAX_BITS; nbits++) {
+        for(i = 0; i < 1 << (nbits - 1); i++) {
+            in0[i] = 2.0 * rand() / RAND_MAX - 1.0;
+            in1[i] = 2.0 * rand() / RAND_MAX - 1.0;
+        }
+        fails += test_size(nbits, in0, in1);
+    }
+
+    av_free(in0);
+    av_free(in1);
+    printf("%s\n", fails ? "FAILED" : "OK");
+    return fails != 0;
+}
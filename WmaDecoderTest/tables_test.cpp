@@ -0,0 +1,144 @@
+/*
+ * Check the WMA dequantization tables against libm
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * @file tables_test.cpp
+ * Check every entry of the exponent table pow_tab and of the gain table
+ * gain_tab built by wma_init_tables() against pow(), and wma_gain() on
+ * both sides of each end of gain_tab, where it falls back to pow(). The
+ * decoder source is included, as the tables are private to it. It is
+ * not part of the library. From the WmaDecoder directory:
+ *
+ *   g++ -O2 -include stdint.h -I. ../WmaDecoderTest/tables_test.cpp \
+ *       Wma_common.cpp Wma_mem.cpp Wma_utils.cpp Wma_dsputil*.cpp \
+ *       Wma_fft*.cpp Wma_mdct.cpp -o tables_test -lpthread
+ *   ./tables_test
+ *
+ * The exit status is 0 if all the values are within the tolerances.
+ */
+#include "Wma_wmadec.cpp"
+
+using namespace WMADECODER_NAMESPACE;
+
+/* the decoder only uses it for its statistics, and Wma_futils.cpp,
+   which has it, needs most of the library */
+int64_t WMADECODER_NAMESPACE::av_gettime(void)
+{
+    return 0;
+}
+
+/* largest relative errors allowed: pow_tab is float, gain_tab double */
+#define POW_TAB_ERROR  1e-6
+#define GAIN_TAB_ERROR 1e-12
+
+static double rel_error(double v, double ref)
+{
+    return fabs(v - ref) / ref;
+}
+
+static int test_pow_tab(const WMATables *t)
+{
+    double err, max_err = 0;
+    int i, x, fails = 0;
+
+    for(i = 0; i < POW_TAB_SIZE; i++) {
+        x = i + POW_TAB_MIN;
+        err = rel_error(t->pow_tab[i], pow(10, x / 16.0));
+        if (!(err <= POW_TAB_ERROR)) {
+            printf("pow_tab[%d] (exponent %d): %.9g, error %g\n",
+                   i, x, t->pow_tab[i], err);
+            fails++;
+        }
+        if (err > max_err)
+            max_err = err;
+    }
+    printf("pow_tab:  exponents %d to %d, max relative error %g\n",
+           POW_TAB_MIN, POW_TAB_MIN + POW_TAB_SIZE - 1, max_err);
+    return fails;
+}
+
+static int test_gain_tab(const WMATables *t)
+{
+    double err, max_err = 0;
+    int i, x, fails = 0;
+
+    for(i = 0; i < GAIN_TAB_SIZE; i++) {
+        x = i + GAIN_TAB_MIN;
+        err = rel_error(t->gain_tab[i], pow(10, x * 0.05));
+        if (!(err <= GAIN_TAB_ERROR)) {
+            printf("gain_tab[%d] (gain %d): %.17g, error %g\n",
+                   i, x, t->gain_tab[i], err);
+            fails++;
+        }
+        if (err > max_err)
+            max_err = err;
+    }
+    printf("gain_tab: gains %d to %d, max relative error %g\n",
+           GAIN_TAB_MIN, GAIN_TAB_MIN + GAIN_TAB_SIZE - 1, max_err);
+    return fails;
+}
+
+/* the last two gains before the table, the first two and the last two
+   in it and the first two after it */
+static int test_gain_fallback(WMATables *t)
+{
+    static const int gains[] = {
+        GAIN_TAB_MIN - 2, GAIN_TAB_MIN - 1,
+        GAIN_TAB_MIN, GAIN_TAB_MIN + 1,
+        GAIN_TAB_MIN + GAIN_TAB_SIZE - 2, GAIN_TAB_MIN + GAIN_TAB_SIZE - 1,
+        GAIN_TAB_MIN + GAIN_TAB_SIZE, GAIN_TAB_MIN + GAIN_TAB_SIZE + 1,
+    };
+    WMADecodeContext s;
+    double v, err;
+    int i, fails = 0;
+
+    memset(&s, 0, sizeof(s));
+    s.tables = t;
+    for(i = 0; i < (int)(sizeof(gains) / sizeof(gains[0])); i++) {
+        v = wma_gain(&s, gains[i]);
+        err = rel_error(v, pow(10, gains[i] * 0.05));
+        printf("wma_gain(%d) = %.17g (%s), relative error %g\n", gains[i], v,
+               (unsigned)(gains[i] - GAIN_TAB_MIN) < GAIN_TAB_SIZE ?
+               "table" : "pow", err);
+        if (!(err <= GAIN_TAB_ERROR))
+            fails++;
+    }
+    return fails;
+}
+
+int main(void)
+{
+    WMATables *t;
+    int fails = 0;
+
+    t = (WMATables*)av_mallocz(sizeof(WMATables));
+    if (!t)
+        return 1;
+    t->frame_len_bits = 11;
+    t->use_exp_vlc = 1;
+    if (wma_init_tables(t, 0) < 0)
+        return 1;
+
+    fails += test_pow_tab(t);
+    fails += test_gain_tab(t);
+    fails += test_gain_fallback(t);
+
+    av_free(t);
+    printf("%s\n", fails ? "FAILED" : "OK");
+    return fails != 0;
+}